@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/hash_functions.cuh>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+#include <nvbench/range.cuh>
+
+namespace cudax = cuda::experimental;
+
+template <cuda::std::int32_t Words>
+struct large_key
+{
+  constexpr __host__ __device__ large_key(cuda::std::int32_t seed) noexcept
+  {
+    for (cuda::std::int32_t i = 0; i < Words; ++i)
+    {
+      data_[i] = seed;
+    }
+  }
+
+private:
+  cuda::std::int32_t data_[Words];
+};
+
+// benchmark comparing the throughput of hashing keys one by one and in bulk on the host
+template <typename HasherTag, typename Key>
+void hash_n_eval(nvbench::state& state, nvbench::type_list<HasherTag, Key>)
+{
+  using Hash     = typename HasherTag::template fn<Key>;
+  using result_t = decltype(std::declval<Hash>()(std::declval<Key>()));
+
+  auto const num_keys  = static_cast<cuda::std::size_t>(state.get_int64("NumInputs"));
+  auto const num_seeds = static_cast<cuda::std::size_t>(state.get_int64("NumSeeds"));
+  auto const method    = state.get_string("Method");
+
+  std::vector<Key> keys;
+  for (cuda::std::size_t i = 0; i < num_keys; ++i)
+  {
+    keys.push_back(Key(static_cast<cuda::std::int32_t>(i)));
+  }
+  std::vector<result_t> seeds(num_seeds);
+  for (cuda::std::size_t i = 0; i < num_seeds; ++i)
+  {
+    seeds[i] = static_cast<result_t>(i);
+  }
+  std::vector<result_t> hash_values(num_keys * num_seeds);
+
+  state.add_element_count(num_keys * num_seeds);
+  state.add_global_memory_reads<Key>(num_keys);
+  state.add_global_memory_writes<result_t>(num_keys * num_seeds);
+
+  Hash const hash{};
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (method == "hash_n")
+    {
+      hash.hash_n(cuda::std::span<Key const>{keys.data(), keys.size()},
+                  cuda::std::span<result_t const>{seeds.data(), seeds.size()},
+                  cuda::std::span<result_t>{hash_values.data(), hash_values.size()});
+    }
+    else
+    {
+      for (cuda::std::size_t j = 0; j < num_seeds; ++j)
+      {
+        Hash const seeded_hash{seeds[j]};
+        for (cuda::std::size_t i = 0; i < num_keys; ++i)
+        {
+          hash_values[i * num_seeds + j] = seeded_hash(keys[i]);
+        }
+      }
+    }
+  });
+}
+
+struct xxhash_32_tag
+{
+  template <typename Key>
+  using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::xxhash_32>;
+};
+
+struct xxhash_64_tag
+{
+  template <typename Key>
+  using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::xxhash_64>;
+};
+
+struct murmurhash3_32_tag
+{
+  template <typename Key>
+  using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::murmurhash3_32>;
+};
+
+NVBENCH_BENCH_TYPES(
+  hash_n_eval,
+  NVBENCH_TYPE_AXES(nvbench::type_list<xxhash_32_tag, xxhash_64_tag, murmurhash3_32_tag>,
+                    nvbench::type_list<cuda::std::int32_t, large_key<2>, large_key<4>, large_key<8>, large_key<16>>))
+  .set_name("hash_n_eval")
+  .set_type_axes_names({"Hash", "Key"})
+  .add_string_axis("Method", {"per_key", "hash_n"})
+  .add_int64_axis("NumSeeds", {1, 4})
+  .add_int64_power_of_two_axis("NumInputs", nvbench::range(16, 24, 4));
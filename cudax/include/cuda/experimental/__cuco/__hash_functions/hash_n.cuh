@@ -0,0 +1,243 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___HASH_FUNCTIONS_HASH_N_CUH
+#define _CUDAX___CUCO___HASH_FUNCTIONS_HASH_N_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstring/memcpy.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <nv/target>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief Vector registers of the host that hash one key per lane
+//!
+//! Every lane performs the same sequence of operations as the hash function does for a single key, so that the lanes
+//! produce the same hash values.
+//!
+//! @tparam _Word The type of the hash state, `::cuda::std::uint32_t` or `::cuda::std::uint64_t`
+template <typename _Word>
+struct __hash_lanes
+{
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  static constexpr size_t __bytes = _CCCL_SIMD_HOST_VECTOR_BYTES();
+  static constexpr size_t __lanes = __bytes / sizeof(_Word);
+
+  // Without a 64-bit vector multiplication the compiler emulates it with 32-bit ones, which is slower than hashing the
+  // keys one by one
+#  if defined(__AVX512DQ__)
+  static constexpr bool __enabled = true;
+#  else // ^^^ __AVX512DQ__ ^^^ / vvv !__AVX512DQ__ vvv
+  static constexpr bool __enabled = sizeof(_Word) == 4;
+#  endif // !__AVX512DQ__
+
+  typedef _Word __vector_t __attribute__((vector_size(__bytes)));
+
+  [[nodiscard]] _CCCL_HOST_API static __vector_t __splat(const _Word __value) noexcept
+  {
+    return __vector_t{} + __value;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector_t __rotl(const __vector_t __v, const int __shift) noexcept
+  {
+    return (__v << __shift) | (__v >> (static_cast<int>(sizeof(_Word) * 8) - __shift));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector_t __load(const ::cuda::std::byte* const __ptr) noexcept
+  {
+    __vector_t __result;
+    ::cuda::std::memcpy(&__result, __ptr, sizeof(__vector_t));
+    return __result;
+  }
+
+  //! @brief Loads a `_Load` from each of `__lanes` keys that are `_Stride` bytes apart, starting at `__offset` bytes
+  //! into the first key, and widens it to `_Word`
+  template <size_t _Stride, typename _Load>
+  [[nodiscard]] _CCCL_HOST_API static __vector_t
+  __gather(const ::cuda::std::byte* const __first, const size_t __offset) noexcept
+  {
+#  if _CCCL_HAS_BUILTIN(__builtin_convertvector)
+    if constexpr (_Stride == sizeof(_Load))
+    {
+      // The loads are contiguous, so they are loaded as a narrower vector and widened
+      typedef _Load __narrow_vector_t __attribute__((vector_size(__lanes * sizeof(_Load))));
+      __narrow_vector_t __narrow;
+      ::cuda::std::memcpy(&__narrow, __first + __offset, sizeof(__narrow_vector_t));
+      return __builtin_convertvector(__narrow, __vector_t);
+    }
+#  endif // _CCCL_HAS_BUILTIN(__builtin_convertvector)
+
+    _Word __values[__lanes];
+    for (size_t __lane = 0; __lane < __lanes; ++__lane)
+    {
+      _Load __value;
+      ::cuda::std::memcpy(&__value, __first + __lane * _Stride + __offset, sizeof(_Load));
+      __values[__lane] = static_cast<_Word>(__value);
+    }
+    __vector_t __result;
+    ::cuda::std::memcpy(&__result, __values, sizeof(__vector_t));
+    return __result;
+  }
+
+  //! @brief Selects the even (`_Odd == 0`) or odd (`_Odd == 1`) elements of the concatenation of `__lhs` and `__rhs`
+  template <size_t _Odd, size_t... _Is>
+  [[nodiscard]] _CCCL_HOST_API static __vector_t
+  __unzip(const __vector_t __lhs, const __vector_t __rhs, ::cuda::std::index_sequence<_Is...>) noexcept
+  {
+#  if _CCCL_COMPILER(CLANG)
+    return __builtin_shufflevector(__lhs, __rhs, (2 * _Is + _Odd)...);
+#  else // ^^^ _CCCL_COMPILER(CLANG) ^^^ / vvv !_CCCL_COMPILER(CLANG) vvv
+    return __builtin_shuffle(__lhs, __rhs, __vector_t{(2 * _Is + _Odd)...});
+#  endif // !_CCCL_COMPILER(CLANG)
+  }
+
+  //! @brief Loads the first `_Words` words of each of `__lanes` keys that are `_Stride` bytes apart, such that
+  //! `__blocks[__i]` holds the word `__i` of every key
+  //!
+  //! Keys of a power of two number of words are loaded as whole vectors, which are split into their even and odd
+  //! elements until every vector holds a single word of each key.
+  template <size_t _Stride, size_t _Words>
+  _CCCL_HOST_API static void
+  __load_blocks(const ::cuda::std::byte* const __first, __vector_t (&__blocks)[_Words]) noexcept
+  {
+    if constexpr (_Stride == _Words * sizeof(_Word) && (_Words & (_Words - 1)) == 0)
+    {
+      for (size_t __i = 0; __i < _Words; ++__i)
+      {
+        __blocks[__i] = __load(__first + __i * sizeof(__vector_t));
+      }
+
+      // Every pass moves the even words of each key in front of its odd words, so that after log2(_Words) passes the
+      // words are ordered by their index within the key
+      constexpr auto __pairs = ::cuda::std::make_index_sequence<__lanes>{};
+      for (size_t __n = _Words; __n > 1; __n /= 2)
+      {
+        __vector_t __next[_Words];
+        for (size_t __i = 0; __i < _Words / 2; ++__i)
+        {
+          __next[__i]              = __unzip<0>(__blocks[2 * __i], __blocks[2 * __i + 1], __pairs);
+          __next[__i + _Words / 2] = __unzip<1>(__blocks[2 * __i], __blocks[2 * __i + 1], __pairs);
+        }
+        ::cuda::std::memcpy(__blocks, __next, sizeof(__blocks));
+      }
+    }
+    else
+    {
+      for (size_t __i = 0; __i < _Words; ++__i)
+      {
+        __blocks[__i] = __gather<_Stride, _Word>(__first, __i * sizeof(_Word));
+      }
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+};
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+//! @brief Hashes as many keys as fill whole vector registers and returns the number of keys that were hashed
+template <typename _Key, typename _Word, typename _LaneFn>
+[[nodiscard]] _CCCL_HOST_API size_t __hash_n_lanes(
+  ::cuda::std::span<const _Key> __keys,
+  ::cuda::std::span<const _Word> __seeds,
+  ::cuda::std::span<_Word> __out,
+  _LaneFn __lane_fn) noexcept
+{
+  using _Lanes                 = __hash_lanes<_Word>;
+  constexpr size_t __num_words = sizeof(_Key) / sizeof(_Word);
+
+  const auto __bytes     = ::cuda::std::as_bytes(__keys).data();
+  const size_t __n       = __keys.size();
+  const size_t __n_seeds = __seeds.size();
+
+  // The words of the keys are shared by all seeds, the bytes that do not fill a whole word are loaded by __lane_fn
+  typename _Lanes::__vector_t __blocks[__num_words > 0 ? __num_words : 1];
+
+  size_t __i = 0;
+  for (; __i + _Lanes::__lanes <= __n; __i += _Lanes::__lanes)
+  {
+    const auto __first = __bytes + __i * sizeof(_Key);
+    if constexpr (__num_words > 0)
+    {
+      _Lanes::template __load_blocks<sizeof(_Key)>(__first, __blocks);
+    }
+
+    for (size_t __j = 0; __j < __n_seeds; ++__j)
+    {
+      const auto __h = __lane_fn(_Lanes{}, __first, __blocks, _Lanes::__splat(__seeds[__j]));
+      if (__n_seeds == 1)
+      {
+        ::cuda::std::memcpy(__out.data() + __i, &__h, sizeof(__h));
+      }
+      else
+      {
+        for (size_t __lane = 0; __lane < _Lanes::__lanes; ++__lane)
+        {
+          __out[(__i + __lane) * __n_seeds + __j] = __h[__lane];
+        }
+      }
+    }
+  }
+  return __i;
+}
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
+//! @brief Hashes every key with every seed, storing the hash of `__keys[__i]` with `__seeds[__j]` into
+//! `__out[__i * __seeds.size() + __j]`
+//!
+//! On the host the keys are hashed one per lane of a vector register by `__lane_fn`, which is passed the words of the
+//! keys as loaded by `__hash_lanes::__load_blocks`. The remaining keys and all keys on the device are hashed one by one
+//! with `_Hasher`.
+template <typename _Hasher, typename _Key, typename _Word, typename _LaneFn>
+_CCCL_HOST_DEVICE_API void __hash_n(
+  ::cuda::std::span<const _Key> __keys,
+  ::cuda::std::span<const _Word> __seeds,
+  ::cuda::std::span<_Word> __out,
+  [[maybe_unused]] _LaneFn __lane_fn) noexcept
+{
+  _CCCL_ASSERT(__out.size() >= __keys.size() * __seeds.size(), "The output must hold a hash per key and seed");
+
+  size_t __i = 0;
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__hash_lanes<_Word>::__enabled)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__i = ::cuda::experimental::cuco::__hash_n_lanes(__keys, __seeds, __out, __lane_fn);))
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
+  const size_t __n_seeds = __seeds.size();
+  for (size_t __j = 0; __j < __n_seeds; ++__j)
+  {
+    const _Hasher __hasher{__seeds[__j]};
+    for (size_t __k = __i; __k < __keys.size(); ++__k)
+    {
+      __out[__k * __n_seeds + __j] = __hasher(__keys[__k]);
+    }
+  }
+}
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___HASH_FUNCTIONS_HASH_N_CUH
@@ -40,6 +40,7 @@
 #include <cuda/std/cstdint>
 #include <cuda/std/span>
 
+#include <cuda/experimental/__cuco/__hash_functions/hash_n.cuh>
 #include <cuda/experimental/__cuco/__hash_functions/utils.cuh>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -114,6 +115,37 @@ struct _MurmurHash3_32
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`.
+  //!
+  //! On the host several keys are hashed at once in vector registers. The results are identical to calling this hash
+  //! function on each key.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, must hold at least `__keys.size()` values
+  _CCCL_HOST_DEVICE_API void
+  hash_n(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint32_t> __out) const noexcept
+  {
+    const ::cuda::std::uint32_t __seed[1] = {__seed_};
+    hash_n(__keys, ::cuda::std::span<const ::cuda::std::uint32_t>{__seed}, __out);
+  }
+
+  //! @brief Hashes every key of `__keys` once with each of `__seeds` instead of the seed of this hash function.
+  //!
+  //! The hash value of `__keys[i]` with `__seeds[j]` is stored into `__out[i * __seeds.size() + j]`.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __seeds The seeds to hash each key with
+  //! @param __out The resulting hash values, must hold at least `__keys.size() * __seeds.size()` values
+  _CCCL_HOST_DEVICE_API void hash_n(::cuda::std::span<const _Key> __keys,
+                                    ::cuda::std::span<const ::cuda::std::uint32_t> __seeds,
+                                    ::cuda::std::span<::cuda::std::uint32_t> __out) const noexcept
+  {
+    ::cuda::experimental::cuco::__hash_n<_MurmurHash3_32>(
+      __keys, __seeds, __out, [](auto __lanes, const ::cuda::std::byte* __first, const auto* __blocks, auto __seed) {
+        return __compute_hash_lanes<decltype(__lanes)>(__first, __blocks, __seed);
+      });
+  }
+
 private:
   template <class _Holder>
   [[nodiscard]] _CCCL_HOST_DEVICE_API ::cuda::std::uint32_t __compute_hash(_Holder __holder) const noexcept
@@ -164,6 +196,62 @@ private:
     return __h1;
   }
 
+  //! @brief Computes the same hash values as `__compute_hash`, for one key in each lane of `_Lanes`.
+  //!
+  //! @param __first The bytes of the first key, followed by the keys of the other lanes
+  //! @param __blocks The words of the keys, as loaded by `_Lanes::__load_blocks`
+  //! @param __seed The seed of each lane
+  template <class _Lanes>
+  [[nodiscard]] _CCCL_HOST_API static typename _Lanes::__vector_t __compute_hash_lanes(
+    const ::cuda::std::byte* __first,
+    const typename _Lanes::__vector_t* __blocks,
+    typename _Lanes::__vector_t __seed) noexcept
+  {
+    using __vector_t              = typename _Lanes::__vector_t;
+    constexpr size_t __size       = sizeof(_Key);
+    constexpr size_t __num_blocks = __size / __block_size;
+    constexpr size_t __tail_size  = __size % __block_size;
+
+    __vector_t __h1 = __seed;
+
+    //----------
+    // body
+    ::cuda::static_for<__num_blocks>([&](auto __i) {
+      __vector_t __k1 = __blocks[__i];
+      __k1 *= __c1;
+      __k1 = _Lanes::__rotl(__k1, 15);
+      __k1 *= __c2;
+      __h1 ^= __k1;
+      __h1 = _Lanes::__rotl(__h1, 13);
+      __h1 = __h1 * 5 + 0xe6546b64;
+    });
+
+    //----------
+    // tail
+    if constexpr (__tail_size > 0)
+    {
+      __vector_t __k1{};
+      ::cuda::static_for<__tail_size>([&](auto __i) {
+        __k1 ^= _Lanes::template __gather<__size, ::cuda::std::uint8_t>(__first, __num_blocks * __block_size + __i)
+             << (8 * __i);
+      });
+      __k1 *= __c1;
+      __k1 = _Lanes::__rotl(__k1, 15);
+      __k1 *= __c2;
+      __h1 ^= __k1;
+    }
+
+    //----------
+    // finalization
+    __h1 ^= static_cast<::cuda::std::uint32_t>(__size);
+    __h1 ^= __h1 >> 16;
+    __h1 *= 0x85ebca6b;
+    __h1 ^= __h1 >> 13;
+    __h1 *= 0xc2b2ae35;
+    __h1 ^= __h1 >> 16;
+    return __h1;
+  }
+
   [[nodiscard]] _CCCL_HOST_DEVICE_API ::cuda::std::uint32_t
   __compute_hash_span(::cuda::std::span<const _Key> __keys) const noexcept
   {
@@ -63,6 +63,7 @@
 #include <cuda/std/cstdint>
 #include <cuda/std/span>
 
+#include <cuda/experimental/__cuco/__hash_functions/hash_n.cuh>
 #include <cuda/experimental/__cuco/__hash_functions/utils.cuh>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -114,6 +115,37 @@ public:
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`.
+  //!
+  //! On the host several keys are hashed at once in vector registers. The results are identical to calling this hash
+  //! function on each key.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, must hold at least `__keys.size()` values
+  _CCCL_HOST_DEVICE_API void
+  hash_n(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint32_t> __out) const noexcept
+  {
+    const ::cuda::std::uint32_t __seed[1] = {__seed_};
+    hash_n(__keys, ::cuda::std::span<const ::cuda::std::uint32_t>{__seed}, __out);
+  }
+
+  //! @brief Hashes every key of `__keys` once with each of `__seeds` instead of the seed of this hash function.
+  //!
+  //! The hash value of `__keys[i]` with `__seeds[j]` is stored into `__out[i * __seeds.size() + j]`.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __seeds The seeds to hash each key with
+  //! @param __out The resulting hash values, must hold at least `__keys.size() * __seeds.size()` values
+  _CCCL_HOST_DEVICE_API void hash_n(::cuda::std::span<const _Key> __keys,
+                                    ::cuda::std::span<const ::cuda::std::uint32_t> __seeds,
+                                    ::cuda::std::span<::cuda::std::uint32_t> __out) const noexcept
+  {
+    ::cuda::experimental::cuco::__hash_n<_XXHash_32>(
+      __keys, __seeds, __out, [](auto __lanes, const ::cuda::std::byte* __first, const auto* __blocks, auto __seed) {
+        return __compute_hash_lanes<decltype(__lanes)>(__first, __blocks, __seed);
+      });
+  }
+
 private:
   //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint32_t`.
   //!
@@ -248,6 +280,68 @@ private:
     return __finalize(__h32);
   }
 
+  //! @brief Computes the same hash values as `__compute_hash`, for one key in each lane of `_Lanes`.
+  //!
+  //! @param __first The bytes of the first key, followed by the keys of the other lanes
+  //! @param __blocks The words of the keys, as loaded by `_Lanes::__load_blocks`
+  //! @param __seed The seed of each lane
+  template <class _Lanes>
+  [[nodiscard]] _CCCL_HOST_API static typename _Lanes::__vector_t __compute_hash_lanes(
+    const ::cuda::std::byte* __first,
+    const typename _Lanes::__vector_t* __blocks,
+    typename _Lanes::__vector_t __seed) noexcept
+  {
+    using __vector_t              = typename _Lanes::__vector_t;
+    constexpr size_t __size       = sizeof(_Key);
+    constexpr size_t __num_chunks = __size / __chunk_size;
+    constexpr size_t __num_blocks = __size / __block_size;
+    constexpr size_t __tail_size  = __size % __block_size;
+
+    size_t __offset = 0;
+    __vector_t __h32;
+
+    if constexpr (__num_chunks > 0)
+    {
+      __vector_t __v[4] = {__seed + (__prime1 + __prime2), __seed + __prime2, __seed, __seed - __prime1};
+      for (size_t __i = 0; __i < __num_chunks; ++__i)
+      {
+        ::cuda::static_for<4>([&](auto i) {
+          __v[i] += __blocks[__offset++] * __prime2;
+          __v[i] = _Lanes::__rotl(__v[i], 13);
+          __v[i] *= __prime1;
+        });
+      }
+      __h32 = _Lanes::__rotl(__v[0], 1) + _Lanes::__rotl(__v[1], 7) + _Lanes::__rotl(__v[2], 12)
+            + _Lanes::__rotl(__v[3], 18);
+    }
+    else
+    {
+      __h32 = __seed + __prime5;
+    }
+
+    __h32 += static_cast<::cuda::std::uint32_t>(__size);
+
+    for (; __offset < __num_blocks; ++__offset)
+    {
+      __h32 += __blocks[__offset] * __prime3;
+      __h32 = _Lanes::__rotl(__h32, 17) * __prime4;
+    }
+
+    for (size_t __i = 0; __i < __tail_size; ++__i)
+    {
+      __h32 += _Lanes::template __gather<__size, ::cuda::std::uint8_t>(__first, __num_blocks * __block_size + __i)
+             * __prime5;
+      __h32 = _Lanes::__rotl(__h32, 11) * __prime1;
+    }
+
+    __h32 ^= __h32 >> 15;
+    __h32 *= __prime2;
+    __h32 ^= __h32 >> 13;
+    __h32 *= __prime3;
+    __h32 ^= __h32 >> 16;
+    return __h32;
+  }
+
   [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint32_t
   __finalize(::cuda::std::uint32_t __h) const noexcept
   {
@@ -312,6 +406,37 @@ public:
     return __compute_hash_span(__keys);
   }
 
+  //! @brief Hashes every key of `__keys` into the corresponding element of `__out`.
+  //!
+  //! On the host several keys are hashed at once in vector registers. The results are identical to calling this hash
+  //! function on each key.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, must hold at least `__keys.size()` values
+  _CCCL_HOST_DEVICE_API void
+  hash_n(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint64_t> __out) const noexcept
+  {
+    const ::cuda::std::uint64_t __seed[1] = {__seed_};
+    hash_n(__keys, ::cuda::std::span<const ::cuda::std::uint64_t>{__seed}, __out);
+  }
+
+  //! @brief Hashes every key of `__keys` once with each of `__seeds` instead of the seed of this hash function.
+  //!
+  //! The hash value of `__keys[i]` with `__seeds[j]` is stored into `__out[i * __seeds.size() + j]`.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __seeds The seeds to hash each key with
+  //! @param __out The resulting hash values, must hold at least `__keys.size() * __seeds.size()` values
+  _CCCL_HOST_DEVICE_API void hash_n(::cuda::std::span<const _Key> __keys,
+                                    ::cuda::std::span<const ::cuda::std::uint64_t> __seeds,
+                                    ::cuda::std::span<::cuda::std::uint64_t> __out) const noexcept
+  {
+    ::cuda::experimental::cuco::__hash_n<_XXHash_64>(
+      __keys, __seeds, __out, [](auto __lanes, const ::cuda::std::byte* __first, const auto* __blocks, auto __seed) {
+        return __compute_hash_lanes<decltype(__lanes)>(__first, __blocks, __seed);
+      });
+  }
+
 private:
   //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint64_t`.
   //!
@@ -406,6 +531,86 @@ private:
     return __finalize(__h64);
   }
 
+  //! @brief Computes the same hash values as `__compute_hash_span` for a single key, for one key in each lane of
+  //! `_Lanes`.
+  //!
+  //! @param __first The bytes of the first key, followed by the keys of the other lanes
+  //! @param __blocks The words of the keys, as loaded by `_Lanes::__load_blocks`
+  //! @param __seed The seed of each lane
+  template <class _Lanes>
+  [[nodiscard]] _CCCL_HOST_API static typename _Lanes::__vector_t __compute_hash_lanes(
+    const ::cuda::std::byte* __first,
+    const typename _Lanes::__vector_t* __blocks,
+    typename _Lanes::__vector_t __seed) noexcept
+  {
+    using __vector_t        = typename _Lanes::__vector_t;
+    constexpr size_t __size = sizeof(_Key);
+
+    size_t __offset = 0;
+    __vector_t __h64;
+
+    // process data in 32-byte chunks
+    if constexpr (__size >= 32)
+    {
+      __vector_t __v[4] = {__seed + (__prime1 + __prime2), __seed + __prime2, __seed, __seed - __prime1};
+      for (; __offset + 32 <= __size; __offset += 32)
+      {
+        ::cuda::static_for<4>([&](auto i) {
+          __v[i] += __blocks[__offset / 8 + i] * __prime2;
+          __v[i] = _Lanes::__rotl(__v[i], 31);
+          __v[i] *= __prime1;
+        });
+      }
+
+      __h64 = _Lanes::__rotl(__v[0], 1) + _Lanes::__rotl(__v[1], 7) + _Lanes::__rotl(__v[2], 12)
+            + _Lanes::__rotl(__v[3], 18);
+
+      ::cuda::static_for<4>([&](auto i) {
+        __v[i] *= __prime2;
+        __v[i] = _Lanes::__rotl(__v[i], 31);
+        __v[i] *= __prime1;
+        __h64 ^= __v[i];
+        __h64 = __h64 * __prime1 + __prime4;
+      });
+    }
+    else
+    {
+      __h64 = __seed + __prime5;
+    }
+
+    __h64 += static_cast<::cuda::std::uint64_t>(__size);
+
+    // remaining data can be processed in 8-byte chunks
+    for (; __offset + 8 <= __size; __offset += 8)
+    {
+      __vector_t __k1 = __blocks[__offset / 8] * __prime2;
+      __k1            = _Lanes::__rotl(__k1, 31) * __prime1;
+      __h64 ^= __k1;
+      __h64 = _Lanes::__rotl(__h64, 27) * __prime1 + __prime4;
+    }
+
+    // remaining data can be processed in 4-byte chunks
+    if constexpr ((__size % 8) >= 4)
+    {
+      __h64 ^= _Lanes::template __gather<__size, ::cuda::std::uint32_t>(__first, __offset) * __prime1;
+      __h64 = _Lanes::__rotl(__h64, 23) * __prime2 + __prime3;
+      __offset += 4;
+    }
+
+    for (; __offset < __size; ++__offset)
+    {
+      __h64 ^= _Lanes::template __gather<__size, ::cuda::std::uint8_t>(__first, __offset) * __prime5;
+      __h64 = _Lanes::__rotl(__h64, 11) * __prime1;
+    }
+
+    __h64 ^= __h64 >> 33;
+    __h64 *= __prime2;
+    __h64 ^= __h64 >> 29;
+    __h64 *= __prime3;
+    __h64 ^= __h64 >> 32;
+    return __h64;
+  }
+
   // avalanche helper
   [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t __finalize(std::uint64_t __h) const noexcept
   {
@@ -53,6 +53,7 @@ class hash<_Key, hash_algorithm::xxhash_32> : private ::cuda::experimental::cuco
 public:
   using ::cuda::experimental::cuco::_XXHash_32<_Key>::_XXHash_32;
   using ::cuda::experimental::cuco::_XXHash_32<_Key>::operator();
+  using ::cuda::experimental::cuco::_XXHash_32<_Key>::hash_n;
 };
 
 template <typename _Key>
@@ -61,6 +62,7 @@ class hash<_Key, hash_algorithm::xxhash_64> : private ::cuda::experimental::cuco
 public:
   using ::cuda::experimental::cuco::_XXHash_64<_Key>::_XXHash_64;
   using ::cuda::experimental::cuco::_XXHash_64<_Key>::operator();
+  using ::cuda::experimental::cuco::_XXHash_64<_Key>::hash_n;
 };
 
 template <typename _Key>
@@ -69,6 +71,7 @@ class hash<_Key, hash_algorithm::murmurhash3_32> : private ::cuda::experimental:
 public:
   using ::cuda::experimental::cuco::_MurmurHash3_32<_Key>::_MurmurHash3_32;
   using ::cuda::experimental::cuco::_MurmurHash3_32<_Key>::operator();
+  using ::cuda::experimental::cuco::_MurmurHash3_32<_Key>::hash_n;
 };
 
 #if _CCCL_HAS_INT128()
@@ -52,6 +52,8 @@ struct task_scheduler;
 
 struct task_scheduler_domain;
 
+class thread_pool_context;
+
 namespace __detail
 {
 // The concrete type-erased sender returned by task_scheduler::schedule()
@@ -196,6 +198,12 @@ private:
   template <class>
   friend struct __detail::__task_bulk_sender;
   friend struct __detail::__task_sender;
+  friend class thread_pool_context;
+
+  // Used by execution contexts which implement __task_scheduler_backend directly
+  _CCCL_HOST_DEVICE_API explicit task_scheduler(__detail::__backend_ptr_t __backend) noexcept
+      : __backend_(_CCCL_MOVE(__backend))
+  {}
 
   __detail::__backend_ptr_t __backend_;
 };
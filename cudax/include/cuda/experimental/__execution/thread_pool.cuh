@@ -0,0 +1,359 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_THREAD_POOL
+#define __CUDAX_EXECUTION_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+
+#include <cuda/experimental/__execution/intrusive_queue.cuh>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution::__detail
+{
+// A unit of work executed by a __thread_pool worker.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_task : __immovable
+{
+  using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__pool_task*) noexcept;
+
+  _CCCL_HIDE_FROM_ABI __pool_task() = default;
+  _CCCL_HOST_API explicit __pool_task(__execute_fn_t* __execute_fn) noexcept
+      : __execute_fn_(__execute_fn)
+  {}
+
+  _CCCL_HOST_API void __execute() noexcept
+  {
+    (*__execute_fn_)(this);
+  }
+
+  __execute_fn_t* __execute_fn_ = nullptr;
+  __pool_task* __next_          = nullptr;
+};
+
+using __pool_task_queue _CCCL_NODEBUG_ALIAS = __intrusive_queue<&__pool_task::__next_>;
+
+// A bounded Chase-Lev work-stealing deque, using the memory orderings from Lê et
+// al., "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP'13).
+// Only the owning worker pushes and pops at the bottom; any thread may steal from
+// the top. A full deque rejects the push, and the caller falls back to the pool's
+// shared queue.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __work_stealing_deque : __immovable
+{
+  static constexpr ::cuda::std::ptrdiff_t __capacity = 1024;
+  static constexpr ::cuda::std::ptrdiff_t __mask     = __capacity - 1;
+  static_assert((__capacity & __mask) == 0, "the capacity must be a power of two");
+
+public:
+  _CCCL_HIDE_FROM_ABI __work_stealing_deque() = default;
+
+  [[nodiscard]] _CCCL_HOST_API auto __push(__pool_task* __task) noexcept -> bool
+  {
+    const ::cuda::std::ptrdiff_t __bottom = __bottom_.load(::cuda::std::memory_order_relaxed);
+    const ::cuda::std::ptrdiff_t __top    = __top_.load(::cuda::std::memory_order_acquire);
+
+    if (__bottom - __top >= __capacity)
+    {
+      return false;
+    }
+
+    __buffer_[__bottom & __mask].store(__task, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_release);
+    __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+    return true;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __pop() noexcept -> __pool_task*
+  {
+    const ::cuda::std::ptrdiff_t __bottom = __bottom_.load(::cuda::std::memory_order_relaxed) - 1;
+    __bottom_.store(__bottom, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    ::cuda::std::ptrdiff_t __top = __top_.load(::cuda::std::memory_order_relaxed);
+
+    if (__top > __bottom)
+    {
+      // the deque is empty
+      __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    __pool_task* __task = __buffer_[__bottom & __mask].load(::cuda::std::memory_order_relaxed);
+
+    if (__top == __bottom)
+    {
+      // this is the last task, so race the thieves for it
+      if (!__top_.compare_exchange_strong(
+            __top, __top + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+      {
+        __task = nullptr;
+      }
+      __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+    }
+
+    return __task;
+  }
+
+  // Returns nullptr if the deque is empty or if another thread won the race for
+  // the top task.
+  [[nodiscard]] _CCCL_HOST_API auto __steal() noexcept -> __pool_task*
+  {
+    ::cuda::std::ptrdiff_t __top = __top_.load(::cuda::std::memory_order_acquire);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    const ::cuda::std::ptrdiff_t __bottom = __bottom_.load(::cuda::std::memory_order_acquire);
+
+    if (__top >= __bottom)
+    {
+      return nullptr;
+    }
+
+    __pool_task* __task = __buffer_[__top & __mask].load(::cuda::std::memory_order_relaxed);
+
+    if (!__top_.compare_exchange_strong(
+          __top, __top + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+
+    return __task;
+  }
+
+private:
+  alignas(64) ::cuda::std::atomic<::cuda::std::ptrdiff_t> __top_{0};
+  alignas(64) ::cuda::std::atomic<::cuda::std::ptrdiff_t> __bottom_{0};
+  ::cuda::std::atomic<__pool_task*> __buffer_[__capacity] = {};
+};
+
+// A fixed set of worker threads, each owning a work-stealing deque. Tasks
+// submitted from a worker go to the bottom of its own deque, which keeps nested
+// work local; tasks submitted from any other thread go to a shared queue. Idle
+// workers steal from the other deques before going to sleep.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __thread_pool : __immovable
+{
+public:
+  _CCCL_HOST_API explicit __thread_pool(::cuda::std::size_t __num_threads)
+      : __workers_(::std::make_unique<__worker[]>(__num_threads == 0 ? 1 : __num_threads))
+      , __num_threads_(__num_threads == 0 ? 1 : __num_threads)
+  {
+    __threads_.reserve(__num_threads_);
+    for (::cuda::std::size_t __i = 0; __i < __num_threads_; ++__i)
+    {
+      __threads_.emplace_back([this, __i] {
+        __run(__i);
+      });
+    }
+  }
+
+  _CCCL_HOST_API ~__thread_pool()
+  {
+    __join();
+  }
+
+  // Waits for the submitted tasks to finish and stops the workers. Must not be
+  // called from a worker of this pool.
+  _CCCL_HOST_API void __join() noexcept
+  {
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __stopping_ = true;
+    }
+    __cv_.notify_all();
+
+    for (auto& __worker_thread : __threads_)
+    {
+      if (__worker_thread.joinable())
+      {
+        __worker_thread.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __num_threads() const noexcept -> ::cuda::std::size_t
+  {
+    return __num_threads_;
+  }
+
+  _CCCL_HOST_API void __submit(__pool_task* __task) noexcept
+  {
+    if (__current_pool_ != this || !__workers_[__current_index_].__deque_.__push(__task))
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __shared_queue_.push_back(__task);
+      __shared_queue_size_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+    }
+    __notify(1);
+  }
+
+  _CCCL_HOST_API void __submit(__pool_task_queue __tasks, ::cuda::std::size_t __count) noexcept
+  {
+    ::cuda::std::size_t __num_shared = __count;
+
+    if (__current_pool_ == this)
+    {
+      auto& __deque = __workers_[__current_index_].__deque_;
+      while (!__tasks.empty() && __deque.__push(__tasks.front()))
+      {
+        (void) __tasks.pop_front();
+        --__num_shared;
+      }
+    }
+
+    if (!__tasks.empty())
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __shared_queue_.append(::cuda::std::move(__tasks));
+      __shared_queue_size_.fetch_add(__num_shared, ::cuda::std::memory_order_relaxed);
+    }
+    __notify(__count);
+  }
+
+private:
+  struct __worker
+  {
+    __work_stealing_deque __deque_;
+  };
+
+  _CCCL_HOST_API void __notify(::cuda::std::size_t __count) noexcept
+  {
+    // A worker reads the epoch before it looks for work and only goes to sleep if
+    // the epoch is unchanged, so bumping it here cannot lose a wakeup.
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+
+    if (__num_sleeping_.load(::cuda::std::memory_order_seq_cst) != 0)
+    {
+      // synchronize with a worker which is about to wait
+      { ::std::lock_guard<::std::mutex> __lock{__mutex_}; }
+
+      if (__count == 1)
+      {
+        __cv_.notify_one();
+      }
+      else
+      {
+        __cv_.notify_all();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __pop_shared() noexcept -> __pool_task*
+  {
+    if (__shared_queue_size_.load(::cuda::std::memory_order_relaxed) == 0)
+    {
+      return nullptr;
+    }
+
+    ::std::lock_guard<::std::mutex> __lock{__mutex_};
+    if (__shared_queue_.empty())
+    {
+      return nullptr;
+    }
+    __shared_queue_size_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    return __shared_queue_.pop_front();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __find_task(::cuda::std::size_t __index) noexcept -> __pool_task*
+  {
+    if (__pool_task* __task = __workers_[__index].__deque_.__pop())
+    {
+      return __task;
+    }
+
+    if (__pool_task* __task = __pop_shared())
+    {
+      return __task;
+    }
+
+    // A steal fails spuriously when it loses a race, so make a second pass.
+    for (int __pass = 0; __pass < 2; ++__pass)
+    {
+      for (::cuda::std::size_t __i = 1; __i < __num_threads_; ++__i)
+      {
+        if (__pool_task* __task = __workers_[(__index + __i) % __num_threads_].__deque_.__steal())
+        {
+          return __task;
+        }
+      }
+    }
+
+    return nullptr;
+  }
+
+  _CCCL_HOST_API void __run(::cuda::std::size_t __index) noexcept
+  {
+    __current_pool_  = this;
+    __current_index_ = __index;
+
+    while (true)
+    {
+      const ::cuda::std::size_t __epoch = __epoch_.load(::cuda::std::memory_order_seq_cst);
+
+      if (__pool_task* __task = __find_task(__index))
+      {
+        __task->__execute();
+        continue;
+      }
+
+      ::std::unique_lock<::std::mutex> __lock{__mutex_};
+
+      if (__stopping_ && __shared_queue_.empty())
+      {
+        break;
+      }
+
+      __num_sleeping_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+      __cv_.wait(__lock, [&] {
+        return __stopping_ || __epoch_.load(::cuda::std::memory_order_seq_cst) != __epoch;
+      });
+      __num_sleeping_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    }
+
+    __current_pool_ = nullptr;
+  }
+
+  // The pool and worker index of the calling thread, if it is a pool worker.
+  inline static thread_local __thread_pool* __current_pool_      = nullptr;
+  inline static thread_local ::cuda::std::size_t __current_index_ = 0;
+
+  ::std::unique_ptr<__worker[]> __workers_;
+  ::cuda::std::size_t __num_threads_;
+
+  alignas(64) ::cuda::std::atomic<::cuda::std::size_t> __epoch_{0};
+  alignas(64) ::cuda::std::atomic<::cuda::std::size_t> __num_sleeping_{0};
+  alignas(64) ::cuda::std::atomic<::cuda::std::size_t> __shared_queue_size_{0};
+
+  ::std::mutex __mutex_;
+  ::std::condition_variable __cv_;
+  __pool_task_queue __shared_queue_; // guarded by __mutex_
+  bool __stopping_ = false; // guarded by __mutex_
+
+  ::std::vector<::std::thread> __threads_;
+};
+} // namespace cuda::experimental::execution::__detail
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_THREAD_POOL
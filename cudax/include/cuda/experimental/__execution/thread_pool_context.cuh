@@ -0,0 +1,355 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_THREAD_POOL_CONTEXT
+#define __CUDAX_EXECUTION_THREAD_POOL_CONTEXT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/task_scheduler.cuh>
+#include <cuda/experimental/__execution/thread_pool.cuh>
+#include <cuda/experimental/__utility/shared_ptr.cuh>
+
+#include <memory>
+#include <new>
+#include <thread>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+//! The task submitted to the pool by parallel_scheduler_backend::schedule. It lives in
+//! the storage provided by the caller if it fits, and on the heap otherwise.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_schedule_task : __pool_task
+{
+  _CCCL_HOST_API explicit __pool_schedule_task(receiver_proxy& __rcvr_proxy, bool __on_heap) noexcept
+      : __pool_task(&__execute_fn)
+      , __rcvr_proxy_(__rcvr_proxy)
+      , __on_heap_(__on_heap)
+  {}
+
+  _CCCL_HOST_API static void __execute_fn(__pool_task* __task) noexcept
+  {
+    auto* __self  = static_cast<__pool_schedule_task*>(__task);
+    auto& __proxy = __self->__rcvr_proxy_;
+    if (__self->__on_heap_)
+    {
+      delete __self;
+    }
+
+    // The completion may destroy the storage this task lives in, so the task must
+    // not be touched after this point.
+    if (execution::get_stop_token(__proxy.get_env()).stop_requested())
+    {
+      __proxy.set_stopped();
+    }
+    else
+    {
+      __proxy.set_value();
+    }
+  }
+
+  receiver_proxy& __rcvr_proxy_;
+  bool __on_heap_;
+};
+
+//! The shared state of a bulk operation running on the pool. The iteration space is
+//! cut into a few chunks per worker and one task per worker claims chunks from a
+//! shared counter until none are left, so idle workers balance the load of uneven
+//! chunks. The last task to finish frees the state and completes the operation.
+template <bool _Chunked>
+class _CCCL_TYPE_VISIBILITY_DEFAULT __pool_bulk_state
+{
+  // More chunks than workers lets the workers even out chunks of uneven cost.
+  static constexpr ::cuda::std::size_t __chunks_per_worker = 4;
+
+  struct __worker_task : __pool_task
+  {
+    _CCCL_HOST_API __worker_task() noexcept
+        : __pool_task(&__execute_fn)
+    {}
+
+    _CCCL_HOST_API static void __execute_fn(__pool_task* __task) noexcept
+    {
+      static_cast<__worker_task*>(__task)->__state_->__run();
+    }
+
+    __pool_bulk_state* __state_ = nullptr;
+  };
+
+public:
+  _CCCL_HOST_API __pool_bulk_state(
+    ::cuda::std::size_t __shape, ::cuda::std::size_t __num_workers, bulk_item_receiver_proxy& __rcvr_proxy)
+      : __rcvr_proxy_(__rcvr_proxy)
+      , __stop_token_(execution::get_stop_token(__rcvr_proxy.get_env()))
+      , __shape_(__shape)
+  {
+    const ::cuda::std::size_t __target_chunks = ::cuda::std::min(__shape, __num_workers * __chunks_per_worker);
+    __chunk_size_                             = __shape == 0 ? 1 : ::cuda::ceil_div(__shape, __target_chunks);
+    __num_chunks_                             = ::cuda::ceil_div(__shape, __chunk_size_);
+    __num_tasks_ = ::cuda::std::max<::cuda::std::size_t>(1, ::cuda::std::min(__num_workers, __num_chunks_));
+    __remaining_.store(__num_tasks_, ::cuda::std::memory_order_relaxed);
+
+    __tasks_ = ::std::make_unique<__worker_task[]>(__num_tasks_);
+    for (::cuda::std::size_t __i = 0; __i < __num_tasks_; ++__i)
+    {
+      __tasks_[__i].__state_ = this;
+    }
+  }
+
+  //! Submits the worker tasks to the pool. The state may be destroyed before this
+  //! returns.
+  _CCCL_HOST_API void __submit(__thread_pool& __pool) noexcept
+  {
+    const ::cuda::std::size_t __num_tasks = __num_tasks_;
+    __pool_task_queue __queue;
+    for (::cuda::std::size_t __i = 0; __i < __num_tasks; ++__i)
+    {
+      __queue.push_back(&__tasks_[__i]);
+    }
+    __pool.__submit(::cuda::std::move(__queue), __num_tasks);
+  }
+
+private:
+  _CCCL_HOST_API void __run() noexcept
+  {
+    while (true)
+    {
+      const ::cuda::std::size_t __chunk = __next_chunk_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+      if (__chunk >= __num_chunks_)
+      {
+        break;
+      }
+
+      if (__stop_token_.stop_requested())
+      {
+        __stopped_.store(true, ::cuda::std::memory_order_relaxed);
+        break;
+      }
+
+      const ::cuda::std::size_t __begin = __chunk * __chunk_size_;
+      const ::cuda::std::size_t __end   = ::cuda::std::min(__begin + __chunk_size_, __shape_);
+
+      if constexpr (_Chunked)
+      {
+        __rcvr_proxy_.execute(__begin, __end);
+      }
+      else
+      {
+        for (::cuda::std::size_t __i = __begin; __i < __end; ++__i)
+        {
+          __rcvr_proxy_.execute(__i, __i + 1);
+        }
+      }
+    }
+
+    // The last task to finish sees the effects of all the others.
+    if (__remaining_.fetch_sub(1, ::cuda::std::memory_order_acq_rel) == 1)
+    {
+      auto& __proxy        = __rcvr_proxy_;
+      const bool __stopped = __stopped_.load(::cuda::std::memory_order_relaxed) || __stop_token_.stop_requested();
+      delete this;
+
+      if (__stopped)
+      {
+        __proxy.set_stopped();
+      }
+      else
+      {
+        __proxy.set_value();
+      }
+    }
+  }
+
+  bulk_item_receiver_proxy& __rcvr_proxy_;
+  inplace_stop_token __stop_token_;
+  ::cuda::std::size_t __shape_;
+  ::cuda::std::size_t __chunk_size_  = 1;
+  ::cuda::std::size_t __num_chunks_  = 0;
+  ::cuda::std::size_t __num_tasks_   = 1;
+  ::std::unique_ptr<__worker_task[]> __tasks_;
+  ::cuda::std::atomic<::cuda::std::size_t> __next_chunk_{0};
+  ::cuda::std::atomic<::cuda::std::size_t> __remaining_{0};
+  ::cuda::std::atomic<bool> __stopped_{false};
+};
+
+//! A parallel_scheduler_backend that runs its work on a __thread_pool.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __thread_pool_backend final : public __task_scheduler_backend
+{
+public:
+  _CCCL_HOST_API explicit __thread_pool_backend(::cuda::std::size_t __num_threads)
+      : __pool_(__num_threads)
+  {}
+
+  _CCCL_HOST_DEVICE_API void
+  schedule(receiver_proxy& __rcvr_proxy, ::cuda::std::span<::cuda::std::byte> __storage) noexcept final override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__host_schedule(__rcvr_proxy, __storage);))
+  }
+
+  _CCCL_HOST_DEVICE_API void schedule_bulk_chunked(
+    size_t __size, bulk_item_receiver_proxy& __rcvr_proxy, ::cuda::std::span<::cuda::std::byte>) noexcept final override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__host_schedule_bulk<true>(__size, __rcvr_proxy);))
+  }
+
+  _CCCL_HOST_DEVICE_API void schedule_bulk_unchunked(
+    size_t __size, bulk_item_receiver_proxy& __rcvr_proxy, ::cuda::std::span<::cuda::std::byte>) noexcept final override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__host_schedule_bulk<false>(__size, __rcvr_proxy);))
+  }
+
+  [[nodiscard]]
+  _CCCL_HOST_DEVICE_API auto query(get_forward_progress_guarantee_t) const noexcept
+    -> forward_progress_guarantee final override
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  [[nodiscard]]
+  _CCCL_HOST_DEVICE_API bool __equal_to(const void*, ::cuda::std::__type_info_ref) final override
+  {
+    // there is no scheduler type other than task_scheduler that refers to a pool
+    return false;
+  }
+
+  _CCCL_HOST_API void __join() noexcept
+  {
+    __pool_.__join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __num_threads() const noexcept -> ::cuda::std::size_t
+  {
+    return __pool_.__num_threads();
+  }
+
+private:
+  _CCCL_HOST_API void __host_schedule(receiver_proxy& __rcvr_proxy, ::cuda::std::span<::cuda::std::byte> __storage)
+  {
+    _CCCL_TRY
+    {
+      const bool __in_situ =
+        __storage.size() >= sizeof(__pool_schedule_task)
+        && reinterpret_cast<::cuda::std::uintptr_t>(__storage.data()) % alignof(__pool_schedule_task) == 0;
+      auto* __task = __in_situ ? ::new (static_cast<void*>(__storage.data())) __pool_schedule_task(__rcvr_proxy, false)
+                               : new __pool_schedule_task(__rcvr_proxy, true);
+      __pool_.__submit(__task);
+    }
+    _CCCL_CATCH_ALL
+    {
+      __rcvr_proxy.set_error(execution::current_exception());
+    }
+  }
+
+  template <bool _Chunked>
+  _CCCL_HOST_API void __host_schedule_bulk(::cuda::std::size_t __size, bulk_item_receiver_proxy& __rcvr_proxy)
+  {
+    _CCCL_TRY
+    {
+      auto* __state = new __pool_bulk_state<_Chunked>(__size, __pool_.__num_threads(), __rcvr_proxy);
+      __state->__submit(__pool_);
+    }
+    _CCCL_CATCH_ALL
+    {
+      __rcvr_proxy.set_error(execution::current_exception());
+    }
+  }
+
+  __thread_pool __pool_;
+};
+} // namespace __detail
+
+//! @brief An execution context that runs work on a fixed set of worker threads.
+//!
+//! Every worker owns a lock-free work-stealing deque. Work started from a worker stays
+//! on that worker's deque unless an idle worker steals it, and work started from any
+//! other thread is distributed through a shared queue. `bulk_chunked` and
+//! `bulk_unchunked` operations are split into chunks which are spread across the
+//! workers, and stop requests on the receiver's `inplace_stop_token` are checked
+//! before every chunk.
+//!
+//! The schedulers returned by `get_scheduler` are `task_scheduler`s, so they can be
+//! used wherever a `task_scheduler` is expected. They must not be used after the
+//! context is joined or destroyed.
+class _CCCL_TYPE_VISIBILITY_DEFAULT thread_pool_context
+{
+public:
+  _CCCL_HOST_API thread_pool_context()
+      : thread_pool_context(::cuda::std::max(1u, ::std::thread::hardware_concurrency()))
+  {}
+
+  _CCCL_HOST_API explicit thread_pool_context(::cuda::std::size_t __num_threads)
+      : __backend_(experimental::__make_shared<__detail::__thread_pool_backend>(__num_threads))
+  {}
+
+  thread_pool_context(const thread_pool_context&)            = delete;
+  thread_pool_context& operator=(const thread_pool_context&) = delete;
+
+  _CCCL_HOST_API ~thread_pool_context() noexcept
+  {
+    join();
+  }
+
+  //! Waits for the started work to finish and stops the worker threads. Must not be
+  //! called from one of the workers.
+  _CCCL_HOST_API void join() noexcept
+  {
+    __backend_->__join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() const noexcept -> task_scheduler
+  {
+    return task_scheduler{__detail::__backend_ptr_t{__backend_}};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto num_threads() const noexcept -> ::cuda::std::size_t
+  {
+    return __backend_->__num_threads();
+  }
+
+private:
+  __shared_ptr<__detail::__thread_pool_backend> __backend_;
+};
+
+//! @brief Returns a scheduler for a process-wide thread pool with one worker per
+//! hardware thread. The pool is created on first use.
+[[nodiscard]] _CCCL_HOST_API inline auto get_parallel_scheduler() -> task_scheduler
+{
+  static thread_pool_context __context;
+  return __context.get_scheduler();
+}
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_THREAD_POOL_CONTEXT
@@ -40,6 +40,7 @@
 #include <cuda/experimental/__execution/task_scheduler.cuh>
 #include <cuda/experimental/__execution/then.cuh>
 #include <cuda/experimental/__execution/thread_context.cuh>
+#include <cuda/experimental/__execution/thread_pool_context.cuh>
 #include <cuda/experimental/__execution/trampoline_scheduler.cuh>
 #include <cuda/experimental/__execution/transform_completion_signatures.cuh>
 #include <cuda/experimental/__execution/transform_sender.cuh>
@@ -16,6 +16,9 @@
 #include <cuda/std/limits>
 #include <cuda/std/span>
 
+#include <cstdint>
+#include <vector>
+
 #include <cuda/experimental/__cuco/hash_functions.cuh>
 
 #include <testing.cuh>
@@ -245,3 +248,59 @@ TEST_CASE("Test Hasher's on host and device", "")
 #endif // _CCCL_HAS_INT128() && !(_CCCL_CUDA_COMPILER(NVCC, ==, 12, 0) && _CCCL_COMPILER(GCC))
   }
 }
+
+template <cudax::cuco::hash_algorithm Algorithm, typename Key, typename ResultT>
+void test_hash_n(ResultT seed)
+{
+  // Enough keys for several full vectors and a partial one
+  constexpr size_t num_keys = 67;
+
+  std::vector<Key> keys;
+  for (size_t i = 0; i < num_keys; ++i)
+  {
+    keys.push_back(Key(static_cast<int32_t>(i * 2654435761u)));
+  }
+  const cudax::cuco::hash<Key, Algorithm> hasher(seed);
+
+  std::vector<ResultT> out(num_keys);
+  hasher.hash_n(cuda::std::span<const Key>(keys.data(), keys.size()), cuda::std::span<ResultT>(out.data(), out.size()));
+  for (size_t i = 0; i < num_keys; ++i)
+  {
+    REQUIRE(out[i] == hasher(keys[i]));
+  }
+
+  const std::vector<ResultT> seeds = {0, 42, seed, cuda::std::numeric_limits<ResultT>::max()};
+  std::vector<ResultT> multi_out(num_keys * seeds.size());
+  hasher.hash_n(cuda::std::span<const Key>(keys.data(), keys.size()),
+                cuda::std::span<const ResultT>(seeds.data(), seeds.size()),
+                cuda::std::span<ResultT>(multi_out.data(), multi_out.size()));
+  for (size_t j = 0; j < seeds.size(); ++j)
+  {
+    const cudax::cuco::hash<Key, Algorithm> seeded_hasher(seeds[j]);
+    for (size_t i = 0; i < num_keys; ++i)
+    {
+      REQUIRE(multi_out[i * seeds.size() + j] == seeded_hasher(keys[i]));
+    }
+  }
+}
+
+template <cudax::cuco::hash_algorithm Algorithm, typename ResultT>
+void test_hash_n_keys(ResultT seed)
+{
+  test_hash_n<Algorithm, char>(seed);
+  test_hash_n<Algorithm, int32_t>(seed);
+  test_hash_n<Algorithm, int64_t>(seed);
+  test_hash_n<Algorithm, large_key<3>>(seed);
+  test_hash_n<Algorithm, large_key<4>>(seed);
+  test_hash_n<Algorithm, large_key<5>>(seed);
+  test_hash_n<Algorithm, large_key<8>>(seed);
+  test_hash_n<Algorithm, large_key<16>>(seed);
+  test_hash_n<Algorithm, large_key<32>>(seed);
+}
+
+TEST_CASE("Bulk hashing on the host matches hashing each key", "")
+{
+  test_hash_n_keys<cudax::cuco::hash_algorithm::xxhash_32>(uint32_t{12345});
+  test_hash_n_keys<cudax::cuco::hash_algorithm::xxhash_64>(uint64_t{12345});
+  test_hash_n_keys<cudax::cuco::hash_algorithm::murmurhash3_32>(uint32_t{12345});
+}
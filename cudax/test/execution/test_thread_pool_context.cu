@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/execution.cuh>
+
+#include <thread>
+#include <vector>
+
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+C2H_TEST("thread_pool_context runs work on a worker thread", "[scheduler][thread_pool_context]")
+{
+  ex::thread_pool_context ctx{4};
+  CHECK(ctx.num_threads() == 4);
+
+  auto sched = ctx.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+
+  auto sndr  = ex::starts_on(sched, ex::just() | ex::then([] {
+                                     return ::std::this_thread::get_id();
+                                   }));
+  auto [tid] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(tid != ::std::this_thread::get_id());
+}
+
+C2H_TEST("thread_pool_context runs every bulk_chunked index exactly once", "[scheduler][thread_pool_context]")
+{
+  ex::thread_pool_context ctx{4};
+  constexpr int shape = 10000;
+  std::vector<cuda::std::atomic<int>> counts(shape);
+
+  auto fn = [&](int begin, int end, int) {
+    for (int i = begin; i < end; ++i)
+    {
+      counts[i].fetch_add(1);
+    }
+  };
+  auto sndr  = ex::on(ctx.get_scheduler(), ex::just(42) | ex::bulk_chunked(ex::par, shape, fn));
+  auto [val] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(val == 42);
+
+  for (auto& count : counts)
+  {
+    CHECK(count.load() == 1);
+  }
+}
+
+C2H_TEST("thread_pool_context runs every bulk_unchunked index exactly once", "[scheduler][thread_pool_context]")
+{
+  ex::thread_pool_context ctx{4};
+  constexpr int shape = 10000;
+  std::vector<cuda::std::atomic<int>> counts(shape);
+
+  auto sndr = ex::on(ctx.get_scheduler(), ex::just() | ex::bulk_unchunked(ex::par, shape, [&](int i) {
+                                            counts[i].fetch_add(1);
+                                          }));
+  CHECK(ex::sync_wait(cuda::std::move(sndr)).has_value());
+
+  for (auto& count : counts)
+  {
+    CHECK(count.load() == 1);
+  }
+}
+
+C2H_TEST("thread_pool_context runs an empty bulk operation", "[scheduler][thread_pool_context]")
+{
+  ex::thread_pool_context ctx{2};
+  auto sndr = ex::on(ctx.get_scheduler(), ex::just() | ex::bulk(ex::par, 0, [](int) {}));
+  CHECK(ex::sync_wait(cuda::std::move(sndr)).has_value());
+}
+
+C2H_TEST("thread_pool_context honors stop requests", "[scheduler][thread_pool_context]")
+{
+  ex::thread_pool_context ctx{4};
+  ex::inplace_stop_source source;
+  source.request_stop();
+
+  cuda::std::atomic<int> count{0};
+  auto sndr = ex::on(ctx.get_scheduler(), ex::just() | ex::bulk(ex::par, 1000, [&](int) {
+                                            count.fetch_add(1);
+                                          }));
+  auto result =
+    ex::sync_wait(ex::write_env(cuda::std::move(sndr), ex::prop{ex::get_stop_token, source.get_token()}));
+  CHECK(!result.has_value());
+  CHECK(count.load() == 0);
+}
+
+C2H_TEST("get_parallel_scheduler returns the same scheduler every time", "[scheduler][thread_pool_context]")
+{
+  CHECK(ex::get_parallel_scheduler() == ex::get_parallel_scheduler());
+
+  auto sndr  = ex::starts_on(ex::get_parallel_scheduler(), ex::just(1) | ex::then([](int i) {
+                                                            return i + 1;
+                                                          }));
+  auto [val] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(val == 2);
+}
+} // namespace
@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/barrier>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+
+#include <thread>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+struct counter_barrier_t
+{
+  using type = cuda::barrier<cuda::thread_scope_system>;
+};
+
+struct tree_barrier_t
+{
+  using type = cuda::tree_barrier<cuda::thread_scope_system>;
+};
+
+constexpr int episodes = 1000;
+
+// Measures the time from the first arrival of a phase until every thread has been released, with the threads doing no
+// work in between the phases
+template <typename BarrierT>
+static void episode_latency(nvbench::state& state, nvbench::type_list<BarrierT>)
+{
+  const auto num_threads = static_cast<cuda::std::ptrdiff_t>(state.get_int64("Threads"));
+
+  typename BarrierT::type barrier(num_threads);
+
+  // The worker threads live as long as the benchmark and run `episodes` phases every time the round is advanced
+  cuda::std::atomic<int> round{0};
+  cuda::std::atomic<bool> stop{false};
+  std::vector<std::thread> workers;
+  for (cuda::std::ptrdiff_t i = 1; i < num_threads; ++i)
+  {
+    workers.emplace_back([&] {
+      for (int seen = 0;;)
+      {
+        round.wait(seen);
+        seen = round.load();
+        if (stop.load())
+        {
+          return;
+        }
+        for (int episode = 0; episode < episodes; ++episode)
+        {
+          barrier.arrive_and_wait();
+        }
+      }
+    });
+  }
+
+  state.add_element_count(episodes, "Episodes");
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    round.fetch_add(1);
+    round.notify_all();
+    for (int episode = 0; episode < episodes; ++episode)
+    {
+      barrier.arrive_and_wait();
+    }
+  });
+
+  stop.store(true);
+  round.fetch_add(1);
+  round.notify_all();
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+}
+
+NVBENCH_BENCH_TYPES(episode_latency, NVBENCH_TYPE_AXES(nvbench::type_list<counter_barrier_t, tree_barrier_t>))
+  .set_name("episode_latency")
+  .set_type_axes_names({"Barrier"})
+  .add_int64_power_of_two_axis("Threads", nvbench::range(1, 8, 1));
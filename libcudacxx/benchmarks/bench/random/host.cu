@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/random>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+// Compares filling a buffer on the host one value at a time with filling it in bulk
+
+template <typename Engine, typename T>
+static void fill_scalar(Engine& engine, cuda::std::span<T> out)
+{
+  for (auto& value : out)
+  {
+    value = engine();
+  }
+}
+
+template <typename Engine, typename Distribution>
+static void fill_scalar(Engine& engine, Distribution& dist, cuda::std::span<typename Distribution::result_type> out)
+{
+  for (auto& value : out)
+  {
+    value = dist(engine);
+  }
+}
+
+template <typename Engine>
+static void engine_throughput(nvbench::state& state, nvbench::type_list<Engine>)
+{
+  using result_type = typename Engine::result_type;
+  const auto size   = static_cast<cuda::std::size_t>(state.get_int64("Elements"));
+  const bool bulk   = state.get_string("Method") == "bulk";
+
+  Engine engine;
+  std::vector<result_type> out(size);
+
+  state.add_element_count(size);
+  state.add_global_memory_writes<result_type>(size);
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (bulk)
+    {
+      cuda::generate(engine, cuda::std::span<result_type>{out});
+    }
+    else
+    {
+      fill_scalar(engine, cuda::std::span<result_type>{out});
+    }
+  });
+}
+
+using engines = nvbench::type_list<cuda::std::philox4x32, cuda::std::philox4x64, cuda::pcg64>;
+
+NVBENCH_BENCH_TYPES(engine_throughput, NVBENCH_TYPE_AXES(engines))
+  .set_name("engine_throughput")
+  .set_type_axes_names({"Engine"})
+  .add_string_axis("Method", {"scalar", "bulk"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
+
+template <typename T>
+struct uniform_t
+{
+  using type = cuda::std::uniform_real_distribution<T>;
+};
+
+template <typename T>
+struct normal_t
+{
+  using type = cuda::std::normal_distribution<T>;
+};
+
+template <typename Engine, typename DistributionT>
+static void distribution_throughput(nvbench::state& state, nvbench::type_list<Engine, DistributionT>)
+{
+  using Distribution = typename DistributionT::type;
+  using result_type  = typename Distribution::result_type;
+  const auto size    = static_cast<cuda::std::size_t>(state.get_int64("Elements"));
+  const bool bulk    = state.get_string("Method") == "bulk";
+
+  Engine engine;
+  Distribution dist;
+  std::vector<result_type> out(size);
+
+  state.add_element_count(size);
+  state.add_global_memory_writes<result_type>(size);
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (bulk)
+    {
+      dist.generate(engine, cuda::std::span<result_type>{out});
+    }
+    else
+    {
+      fill_scalar(engine, dist, cuda::std::span<result_type>{out});
+    }
+  });
+}
+
+using distributions = nvbench::type_list<uniform_t<float>, uniform_t<double>, normal_t<float>, normal_t<double>>;
+
+NVBENCH_BENCH_TYPES(distribution_throughput,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<cuda::std::philox4x32, cuda::pcg64>, distributions))
+  .set_name("distribution_throughput")
+  .set_type_axes_names({"Engine", "Distribution"})
+  .add_string_axis("Method", {"scalar", "bulk"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
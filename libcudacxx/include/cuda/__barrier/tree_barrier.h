@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/__atomic/scopes.h>
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/__barrier/tree_barrier.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief A barrier for host threads that scales to many threads
+//!
+//! It has the same interface and semantics as `cuda::barrier`, but the arrivals are combined in a tree of nodes that
+//! are each shared by two threads, instead of all updating the same counter.
+template <thread_scope _Sco, class _CompletionF = ::cuda::std::__empty_completion>
+class tree_barrier : public ::cuda::std::__tree_barrier_base<_CompletionF, _Sco>
+{
+public:
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  _CCCL_HOST_API explicit tree_barrier(::cuda::std::ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : ::cuda::std::__tree_barrier_base<_CompletionF, _Sco>(__expected, __completion)
+  {}
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___RANDOM_GENERATE_H
+#define _CUDA___RANDOM_GENERATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__random/bulk_generate.h>
+#include <cuda/std/__random/is_valid.h>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief Fills `__out` with the next values of a random number engine
+//!
+//! The values and the state the engine is left in are the same as those of calling `__g()` for every element of
+//! `__out` in order. Engines with a member function `generate(span<result_type>)`, such as
+//! `cuda::std::philox_engine` and `cuda::pcg64_engine`, produce the values in bulk, the others one at a time.
+//!
+//! @param __g The engine to draw the values from
+//! @param __out The span to fill
+//!
+//! .. code-block:: c++
+//!
+//!    cuda::pcg64 rng;
+//!    cuda::std::uint64_t values[1024];
+//!    cuda::generate(rng, values);
+_CCCL_TEMPLATE(class _URng)
+_CCCL_REQUIRES(::cuda::std::__cccl_random_is_valid_urng<_URng>)
+_CCCL_API void generate(_URng& __g, ::cuda::std::span<typename _URng::result_type> __out)
+{
+  ::cuda::std::__generate_random_bits(__g, __out);
+}
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___RANDOM_GENERATE_H
@@ -29,7 +29,9 @@
 #include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/array>
+#include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -290,6 +292,48 @@ public:
     return __output_transform(__x_);
   }
 
+  //! @brief Fill `__out` with the next pseudo-random values, as if by calling `operator()` for every element in order.
+  //!
+  //! The values are produced by several interleaved streams, each of which steps the LCG state by as many values as
+  //! there are streams, so that their multiplications do not wait for each other.
+  //! @param __out The span to fill.
+  _CCCL_API constexpr void generate(::cuda::std::span<result_type> __out) noexcept
+  {
+    constexpr ::cuda::std::size_t __streams = 4;
+
+    const ::cuda::std::size_t __groups = __out.size() / __streams;
+    if (__groups >= 2)
+    {
+      // Stream __s produces the values __s, __s + __streams, __s + 2 * __streams, ...
+      __pcg64_uint128_t __x[__streams] = {};
+      __x[0]                           = __x_ * __multiplier + __increment;
+      for (::cuda::std::size_t __s = 1; __s < __streams; ++__s)
+      {
+        __x[__s] = __x[__s - 1] * __multiplier + __increment;
+      }
+      const auto [__mult, __plus] = __power_mod(__streams);
+      for (::cuda::std::size_t __group = 0; __group < __groups; ++__group)
+      {
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (::cuda::std::size_t __s = 0; __s < __streams; ++__s)
+        {
+          __out[__group * __streams + __s] = __output_transform(__x[__s]);
+        }
+        __x_ = __x[__streams - 1];
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (::cuda::std::size_t __s = 0; __s < __streams; ++__s)
+        {
+          __x[__s] = __x[__s] * __mult + __plus;
+        }
+      }
+      __out = __out.subspan(__groups * __streams);
+    }
+    for (auto& __value : __out)
+    {
+      __value = (*this)();
+    }
+  }
+
   //! @brief Advance the engine state by `__z` steps, discarding outputs.
   //! @param __z Number of values to discard.
   _CCCL_API constexpr void discard(unsigned long long __z) noexcept
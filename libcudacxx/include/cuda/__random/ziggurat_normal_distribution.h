@@ -0,0 +1,207 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___RANDOM_ZIGGURAT_NORMAL_DISTRIBUTION_H
+#define _CUDA___RANDOM_ZIGGURAT_NORMAL_DISTRIBUTION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__host_stdlib/istream>
+#include <cuda/std/__host_stdlib/ostream>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/is_valid.h>
+#include <cuda/std/__random/ziggurat.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief A normal distribution that is sampled with the Ziggurat method of Marsaglia and Tsang
+//!
+//! It has the same interface as `cuda::std::normal_distribution`, but draws most values from a single 64 bit word of
+//! the engine and a table lookup, instead of two uniform values, a square root and a logarithm. It does not cache a
+//! second value between calls. The values are computed in `double`, so `long double` values have the precision of
+//! `double`.
+//!
+//! .. code-block:: c++
+//!
+//!    cuda::pcg64 rng;
+//!    cuda::ziggurat_normal_distribution<float> dist{0.0f, 2.0f};
+//!    float value = dist(rng);
+template <class _RealType = double>
+class ziggurat_normal_distribution
+{
+  static_assert(::cuda::std::__cccl_random_is_valid_realtype<_RealType>,
+                "RealType must be a supported floating-point type");
+
+public:
+  // types
+  using result_type = _RealType;
+
+  class param_type
+  {
+    result_type __mean_;
+    result_type __stddev_;
+
+  public:
+    using distribution_type = ziggurat_normal_distribution;
+
+    _CCCL_API constexpr explicit param_type(result_type __mean = 0, result_type __stddev = 1) noexcept
+        : __mean_{__mean}
+        , __stddev_{__stddev}
+    {}
+
+    [[nodiscard]] _CCCL_API constexpr result_type mean() const noexcept
+    {
+      return __mean_;
+    }
+    [[nodiscard]] _CCCL_API constexpr result_type stddev() const noexcept
+    {
+      return __stddev_;
+    }
+
+    [[nodiscard]] _CCCL_API friend constexpr bool operator==(const param_type& __x, const param_type& __y) noexcept
+    {
+      return __x.__mean_ == __y.__mean_ && __x.__stddev_ == __y.__stddev_;
+    }
+#if _CCCL_STD_VER <= 2017
+    [[nodiscard]] _CCCL_API friend constexpr bool operator!=(const param_type& __x, const param_type& __y) noexcept
+    {
+      return !(__x == __y);
+    }
+#endif // _CCCL_STD_VER <= 2017
+  };
+
+private:
+  param_type __p_{};
+
+public:
+  // constructors and reset functions
+  _CCCL_API constexpr ziggurat_normal_distribution() noexcept
+      : ziggurat_normal_distribution{0}
+  {}
+  _CCCL_API constexpr explicit ziggurat_normal_distribution(result_type __mean,
+                                                            result_type __stddev = result_type{1}) noexcept
+      : __p_{param_type(__mean, __stddev)}
+  {}
+  _CCCL_API constexpr explicit ziggurat_normal_distribution(const param_type& __p) noexcept
+      : __p_{__p}
+  {}
+  _CCCL_API constexpr void reset() noexcept {}
+
+  // generating functions
+  template <class _URng>
+  [[nodiscard]] _CCCL_API result_type operator()(_URng& __g)
+  {
+    return (*this)(__g, __p_);
+  }
+  template <class _URng>
+  [[nodiscard]] _CCCL_API result_type operator()(_URng& __g, const param_type& __p)
+  {
+    static_assert(::cuda::std::__cccl_random_is_valid_urng<_URng>,
+                  "URng must meet the UniformRandomBitGenerator requirements");
+    ::cuda::std::__ziggurat_bits<_URng> __bits{__g, 64};
+    return static_cast<result_type>(::cuda::std::__ziggurat_normal(__bits)) * __p.stddev() + __p.mean();
+  }
+
+  // property functions
+  [[nodiscard]] _CCCL_API constexpr result_type mean() const noexcept
+  {
+    return __p_.mean();
+  }
+  [[nodiscard]] _CCCL_API constexpr result_type stddev() const noexcept
+  {
+    return __p_.stddev();
+  }
+
+  [[nodiscard]] _CCCL_API constexpr param_type param() const noexcept
+  {
+    return __p_;
+  }
+  _CCCL_API constexpr void param(const param_type& __p) noexcept
+  {
+    __p_ = __p;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr result_type min() noexcept
+  {
+    return -::cuda::std::numeric_limits<result_type>::infinity();
+  }
+  [[nodiscard]] _CCCL_API static constexpr result_type max() noexcept
+  {
+    return ::cuda::std::numeric_limits<result_type>::infinity();
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const ziggurat_normal_distribution& __x, const ziggurat_normal_distribution& __y) noexcept
+  {
+    return __x.__p_ == __y.__p_;
+  }
+#if _CCCL_STD_VER <= 2017
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator!=(const ziggurat_normal_distribution& __x, const ziggurat_normal_distribution& __y) noexcept
+  {
+    return !(__x == __y);
+  }
+#endif // _CCCL_STD_VER <= 2017
+
+#if _CCCL_HOSTED()
+  template <class _CharT, class _Traits>
+  friend ::std::basic_ostream<_CharT, _Traits>&
+  operator<<(::std::basic_ostream<_CharT, _Traits>& __os, const ziggurat_normal_distribution& __x)
+  {
+    using ostream_type                        = ::std::basic_ostream<_CharT, _Traits>;
+    using ios_base                            = typename ostream_type::ios_base;
+    const typename ios_base::fmtflags __flags = __os.flags();
+    const _CharT __fill                       = __os.fill(__os.widen(' '));
+    const auto __precision                    = __os.precision();
+    __os.flags(ios_base::dec | ios_base::left | ios_base::scientific);
+    __os.precision(::cuda::std::numeric_limits<result_type>::max_digits10);
+    __os << __x.mean() << __os.widen(' ') << __x.stddev();
+    __os.flags(__flags);
+    __os.fill(__fill);
+    __os.precision(__precision);
+    return __os;
+  }
+
+  template <class _CharT, class _Traits>
+  friend ::std::basic_istream<_CharT, _Traits>&
+  operator>>(::std::basic_istream<_CharT, _Traits>& __is, ziggurat_normal_distribution& __x)
+  {
+    using istream_type                        = ::std::basic_istream<_CharT, _Traits>;
+    using ios_base                            = typename istream_type::ios_base;
+    const typename ios_base::fmtflags __flags = __is.flags();
+    __is.flags(ios_base::dec | ios_base::skipws);
+    result_type __mean;
+    result_type __stddev;
+    __is >> __mean >> __stddev;
+    if (!__is.fail())
+    {
+      __x.param(param_type{__mean, __stddev});
+    }
+    __is.flags(__flags);
+    return __is;
+  }
+#endif // _CCCL_HOSTED()
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___RANDOM_ZIGGURAT_NORMAL_DISTRIBUTION_H
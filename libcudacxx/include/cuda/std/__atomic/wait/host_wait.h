@@ -0,0 +1,288 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___ATOMIC_WAIT_HOST_WAIT_H
+#define _CUDA_STD___ATOMIC_WAIT_HOST_WAIT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/order.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__chrono/duration.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+#if defined(_CCCL_HAS_THREAD_API_PTHREAD)
+
+// Threads waiting on an atomic of the host are parked in one of these slots, chosen by the address of the value they
+// wait on. On Linux, the value itself is the futex word when it is 32 bits wide, otherwise the threads sleep on the
+// version of their slot, which every notification of an address of the slot increments.
+inline constexpr size_t __atomic_host_wait_slots = 256;
+static_assert(__atomic_host_wait_slots == 256, "The slot index takes the top 8 bits of the hash");
+
+struct alignas(64) __atomic_host_wait_slot
+{
+  // Number of threads that are about to sleep or are sleeping on any address of this slot, so that notifications
+  // without waiters do not need to enter the kernel
+  uint32_t __waiters = 0;
+  uint32_t __version = 0;
+#  if !_CCCL_OS(LINUX)
+  __cccl_mutex_t __mutex     = _LIBCUDACXX_MUTEX_INITIALIZER;
+  __cccl_condvar_t __condvar = _LIBCUDACXX_CONDVAR_INITIALIZER;
+#  endif // !_CCCL_OS(LINUX)
+};
+
+// The table must be shared by every shared library of the process that waits on or notifies the same atomic, so it is
+// not hidden like the rest of the library
+[[nodiscard]] _CCCL_PUBLIC_HOST_API inline __atomic_host_wait_slot* __atomic_host_wait_table() noexcept
+{
+  static __atomic_host_wait_slot __table[__atomic_host_wait_slots];
+  return __table;
+}
+
+[[nodiscard]] _CCCL_HOST_API inline __atomic_host_wait_slot& __atomic_host_wait_slot_for(const volatile void* __addr)
+{
+  // Fibonacci hashing, so that neighbouring addresses land in different slots
+  const auto __key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(__addr));
+  return __atomic_host_wait_table()[(__key * 0x9E3779B97F4A7C15ull) >> 56];
+}
+
+// The address of the value a storage holds, which is the same for every atomic_ref of the same object
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+[[nodiscard]] _CCCL_HOST_API const volatile void* __atomic_host_wait_address(_Sto const volatile* __a)
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+[[nodiscard]] _CCCL_HOST_API const volatile void* __atomic_host_wait_address(_Sto const volatile* __a)
+{
+  return __a->__a_value.get();
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+[[nodiscard]] _CCCL_HOST_API const volatile void* __atomic_host_wait_address(_Sto const volatile* __a)
+{
+  return &__a->__a_value;
+}
+
+// Values are compared by their object representation, like `__nonatomic_compare_equal` does on the host
+template <typename _Tp>
+[[nodiscard]] _CCCL_HOST_API bool __atomic_host_equals(const _Tp& __lhs, const _Tp& __rhs)
+{
+  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+}
+
+#  if _CCCL_OS(LINUX)
+// Storages whose value is held in a single 32-bit word, which the waiters can sleep on directly
+template <typename _Sto>
+inline constexpr bool __atomic_host_wait_on_value =
+  _Sto::__tag == __atomic_tag::__atomic_small_tag
+  || (_Sto::__tag == __atomic_tag::__atomic_base_tag && sizeof(__atomic_underlying_t<_Sto>) == sizeof(uint32_t));
+#  else // ^^^ _CCCL_OS(LINUX) ^^^ / vvv !_CCCL_OS(LINUX) vvv
+template <typename _Sto>
+inline constexpr bool __atomic_host_wait_on_value = false;
+#  endif // !_CCCL_OS(LINUX)
+
+// Loads the 32-bit word that holds the value of the storage and returns whether the value equals `__val`
+template <typename _Sto, typename _Sco, __atomic_storage_is_base<_Sto> = 0>
+[[nodiscard]] _CCCL_HOST_API bool __atomic_host_load_word(
+  _Sto const volatile* __a, __atomic_underlying_remove_cv_t<_Sto> __val, memory_order __order, uint32_t& __word, _Sco)
+{
+  const auto __current = __atomic_load_dispatch(__a, __order, _Sco{});
+  ::cuda::std::memcpy(&__word, &__current, sizeof(__word));
+  return ::cuda::std::__atomic_host_equals(__current, __val);
+}
+
+template <typename _Sto, typename _Sco, __atomic_storage_is_small<_Sto> = 0>
+[[nodiscard]] _CCCL_HOST_API bool __atomic_host_load_word(
+  _Sto const volatile* __a, __atomic_underlying_remove_cv_t<_Sto> __val, memory_order __order, uint32_t& __word, _Sco)
+{
+  // Arithmetic on the proxy may carry into its upper bits, so it is the narrowed value that is compared
+  const auto __proxy = __atomic_load_dispatch(&__a->__a_value, __order, _Sco{});
+  ::cuda::std::memcpy(&__word, &__proxy, sizeof(__word));
+  const auto __current = __atomic_small_from_32<__atomic_underlying_remove_cv_t<_Sto>>(__proxy);
+  return ::cuda::std::__atomic_host_equals(__current, __val);
+}
+
+// Atomics of the system scope may be written by devices or by other processes, which do not notify the threads
+// sleeping in this process. Their waiters only sleep for a bounded time, which grows from the first to the last
+// timeout, and their futexes are shared between processes.
+template <typename _Sco>
+inline constexpr bool __atomic_host_wait_bounded = is_same_v<_Sco, __thread_scope_system_tag>;
+
+inline constexpr ::cuda::std::chrono::microseconds __atomic_host_wait_first_timeout{8};
+inline constexpr ::cuda::std::chrono::microseconds __atomic_host_wait_last_timeout{1000};
+
+//! @brief Sleeps until `*__a` may no longer equal `__val`
+//!
+//! Returns early on a notification of any address that shares the slot of `__a`, or spuriously, so the caller must
+//! check the value again.
+template <typename _Sto, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_host(
+  _Sto const volatile* __a, __atomic_underlying_remove_cv_t<_Sto> __val, memory_order __order, _Sco)
+{
+#  if !_CCCL_OS(LINUX)
+  // A condition variable cannot be shared with the writers of the value, so they are polled
+  if constexpr (__atomic_host_wait_bounded<_Sco>)
+  {
+    __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+    return;
+  }
+#  endif // !_CCCL_OS(LINUX)
+
+  const volatile void* __addr = __atomic_host_wait_address(__a);
+  auto& __slot                = __atomic_host_wait_slot_for(__addr);
+
+  // Registering as a waiter before checking the value pairs with the fence of the notifier, which either sees the
+  // waiter or made its new value visible to the check
+  __atomic_fetch_add_host(&__slot.__waiters, 1u, memory_order_seq_cst);
+  __atomic_thread_fence_host(memory_order_seq_cst);
+
+#  if _CCCL_OS(LINUX)
+  ::cuda::std::chrono::nanoseconds __timeout = __atomic_host_wait_first_timeout;
+  for (;;)
+  {
+    if constexpr (__atomic_host_wait_on_value<_Sto>)
+    {
+      uint32_t __word;
+      if (!::cuda::std::__atomic_host_load_word(__a, __val, __order, __word, _Sco{}))
+      {
+        break;
+      }
+      if constexpr (__atomic_host_wait_bounded<_Sco>)
+      {
+        ::cuda::std::__cccl_futex_wait_for(__addr, __word, __timeout, true);
+      }
+      else
+      {
+        ::cuda::std::__cccl_futex_wait(__addr, __word);
+      }
+    }
+    else
+    {
+      // The version lives in this process, so its futex is private even for values that are shared
+      const uint32_t __version = __atomic_load_host(&__slot.__version, memory_order_acquire);
+      if (!::cuda::std::__atomic_host_equals(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+      {
+        break;
+      }
+      if constexpr (__atomic_host_wait_bounded<_Sco>)
+      {
+        ::cuda::std::__cccl_futex_wait_for(&__slot.__version, __version, __timeout);
+      }
+      else
+      {
+        ::cuda::std::__cccl_futex_wait(&__slot.__version, __version);
+      }
+    }
+
+    if constexpr (!__atomic_host_wait_bounded<_Sco>)
+    {
+      break;
+    }
+    __timeout = (::cuda::std::min) (__timeout * 2, ::cuda::std::chrono::nanoseconds{__atomic_host_wait_last_timeout});
+  }
+#  else // ^^^ _CCCL_OS(LINUX) ^^^ / vvv !_CCCL_OS(LINUX) vvv
+  // The notifier takes the mutex before broadcasting, so it cannot slip between the check and the wait
+  pthread_mutex_lock(&__slot.__mutex);
+  if (::cuda::std::__atomic_host_equals(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+  {
+    pthread_cond_wait(&__slot.__condvar, &__slot.__mutex);
+  }
+  pthread_mutex_unlock(&__slot.__mutex);
+#  endif // !_CCCL_OS(LINUX)
+
+  __atomic_fetch_sub_host(&__slot.__waiters, 1u, memory_order_relaxed);
+}
+
+//! @brief Wakes one (`__all == false`) or all threads sleeping in `__atomic_try_wait_slow_host` on `__a`
+//!
+//! Threads sleeping on another address of the same slot may be woken as well, they go back to sleep after finding
+//! their value unchanged. Waiters in other processes are not counted in the slot, they wake up on their timeout.
+template <typename _Sto, typename _Sco>
+_CCCL_HOST_API void __atomic_notify_host(_Sto const volatile* __a, bool __all, _Sco)
+{
+#  if !_CCCL_OS(LINUX)
+  if constexpr (__atomic_host_wait_bounded<_Sco>)
+  {
+    return;
+  }
+#  endif // !_CCCL_OS(LINUX)
+
+  const volatile void* __addr = __atomic_host_wait_address(__a);
+  auto& __slot                = __atomic_host_wait_slot_for(__addr);
+
+  __atomic_thread_fence_host(memory_order_seq_cst);
+  if (__atomic_load_host(&__slot.__waiters, memory_order_relaxed) == 0)
+  {
+    return;
+  }
+
+#  if _CCCL_OS(LINUX)
+  if constexpr (__atomic_host_wait_on_value<_Sto>)
+  {
+    ::cuda::std::__cccl_futex_wake(__addr, __all ? INT_MAX : 1, __atomic_host_wait_bounded<_Sco>);
+  }
+  else
+  {
+    // Waiters on other addresses of the slot sleep on the same version, so waking a single thread could pick one of
+    // them and leave the waiter of this address asleep
+    __atomic_fetch_add_host(&__slot.__version, 1u, memory_order_release);
+    ::cuda::std::__cccl_futex_wake(&__slot.__version, INT_MAX);
+  }
+#  else // ^^^ _CCCL_OS(LINUX) ^^^ / vvv !_CCCL_OS(LINUX) vvv
+  (void) __all;
+  pthread_mutex_lock(&__slot.__mutex);
+  pthread_mutex_unlock(&__slot.__mutex);
+  pthread_cond_broadcast(&__slot.__condvar);
+#  endif // !_CCCL_OS(LINUX)
+}
+
+#else // ^^^ _CCCL_HAS_THREAD_API_PTHREAD ^^^ / vvv !_CCCL_HAS_THREAD_API_PTHREAD vvv
+
+// Without a way to park threads, waiters poll with a backoff and notifications have nothing to do
+template <typename _Sto, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_host(
+  _Sto const volatile* __a, __atomic_underlying_remove_cv_t<_Sto> __val, memory_order __order, _Sco)
+{
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+}
+
+template <typename _Sto, typename _Sco>
+_CCCL_HOST_API void __atomic_notify_host(_Sto const volatile*, bool, _Sco)
+{}
+
+#endif // !_CCCL_HAS_THREAD_API_PTHREAD
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___ATOMIC_WAIT_HOST_WAIT_H
@@ -23,6 +23,7 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/wait/host_wait.h>
 #include <cuda/std/__atomic/wait/polling.h>
 #include <cuda/std/cstring>
 
@@ -37,20 +38,22 @@ _CCCL_HOST_DEVICE_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_HOST_DEVICE_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_HOST_DEVICE_API inline void __atomic_notify_one([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a, false, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_HOST_DEVICE_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
+_CCCL_HOST_DEVICE_API inline void __atomic_notify_all([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a, true, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp>
@@ -161,6 +161,19 @@ private:
     return __try_wait_phase(__parity ? __phase_bit : 0);
   }
 
+  // On the host the waiters sleep on the barrier word until the last arrival notifies them. The other arrivals change
+  // the word without notifying, so a waiter whose word changed checks the phase again and waits for the new word.
+  // Arrivals on a device never notify the host, the atomic wait of the system scope sleeps for a bounded time for them.
+  _CCCL_HOST_API void __wait_phase_host(uint64_t __phase) const
+  {
+    uint64_t __current = __phase_arrived_expected.load(memory_order_acquire);
+    while ((__current & __phase_bit) == __phase)
+    {
+      __phase_arrived_expected.wait(__current, memory_order_acquire);
+      __current = __phase_arrived_expected.load(memory_order_acquire);
+    }
+  }
+
 public:
   _CCCL_HIDE_FROM_ABI __barrier_base() = default;
 
@@ -188,12 +201,17 @@ public:
   }
   _CCCL_HOST_DEVICE_API void wait(arrival_token&& __phase) const
   {
-    ::cuda::std::__cccl_thread_poll_with_backoff(
-      __barrier_poll_tester_phase<__barrier_base>(this, ::cuda::std::move(__phase)));
+    NV_IF_ELSE_TARGET(NV_IS_HOST,
+                      (__wait_phase_host(__phase & __phase_bit);),
+                      (::cuda::std::__cccl_thread_poll_with_backoff(
+                         __barrier_poll_tester_phase<__barrier_base>(this, ::cuda::std::move(__phase)));))
   }
   _CCCL_HOST_DEVICE_API void wait_parity(bool __parity) const
   {
-    ::cuda::std::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));
+    NV_IF_ELSE_TARGET(
+      NV_IS_HOST,
+      (__wait_phase_host(__parity ? __phase_bit : 0);),
+      (::cuda::std::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));))
   }
   _CCCL_HOST_DEVICE_API void arrive_and_wait()
   {
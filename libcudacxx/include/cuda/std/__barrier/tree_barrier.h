@@ -0,0 +1,191 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDA_STD___BARRIER_TREE_BARRIER_H
+#define __CUDA_STD___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/__new_>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4324) // structure was padded due to alignment specifier
+
+//! @brief Index of the calling thread, which spreads the threads arriving at a tree barrier over its leaves
+[[nodiscard]] _CCCL_HOST_API inline size_t __tree_barrier_thread_index() noexcept
+{
+  static atomic<size_t> __next_index{0};
+  static thread_local const size_t __index = __next_index.fetch_add(1, memory_order_relaxed);
+  return __index;
+}
+
+//! @brief A barrier that combines the arrivals in a binary tree of nodes instead of a single counter
+//!
+//! Every node is shared by two threads, or by the two nodes of the previous round whose arrivals it combines, so the
+//! arriving threads only contend on their own nodes. The last thread to reach the root runs the completion and starts
+//! the next phase. The design follows the tree barrier of libc++.
+template <class _CompletionF, thread_scope _Sco = thread_scope_system>
+class __tree_barrier_base
+{
+  using __phase_t = uint32_t;
+
+  // The expected count is at most max(), so no arrival climbs more than this number of rounds
+  static constexpr size_t __max_rounds = 32;
+
+  // A node holds one ticket per round, which counts the arrivals at the node in the current phase: the phase itself
+  // when nobody arrived yet, one more after the first arrival and two more once both arrived.
+  struct alignas(128) __node
+  {
+    __atomic_impl<__phase_t, _Sco> __tickets[__max_rounds];
+  };
+
+  __node* __nodes;
+  ptrdiff_t __expected;
+  __atomic_impl<ptrdiff_t, _Sco> __expected_adjustment;
+  _CompletionF __completion;
+  __atomic_impl<__phase_t, _Sco> __phase;
+
+public:
+  using arrival_token = __phase_t;
+
+private:
+  //! @brief Arrives at the tree in phase `__old` and returns whether the calling thread was the last one to arrive
+  [[nodiscard]] _CCCL_HOST_API bool __arrive_tree(__phase_t __old)
+  {
+    const __phase_t __half_step = __old + 1;
+    const __phase_t __full_step = __old + 2;
+
+    size_t __current_expected = static_cast<size_t>(__expected);
+    size_t __current          = ::cuda::std::__tree_barrier_thread_index();
+    for (size_t __round = 0;; ++__round)
+    {
+      if (__current_expected <= 1)
+      {
+        return true;
+      }
+      const size_t __end_node  = (__current_expected + 1) / 2;
+      const size_t __last_node = __end_node - 1;
+      __current %= __end_node;
+      for (;; ++__current)
+      {
+        if (__current == __end_node)
+        {
+          __current = 0;
+        }
+        auto& __ticket    = __nodes[__current].__tickets[__round];
+        __phase_t __state = __old;
+        if (__current == __last_node && (__current_expected & 1))
+        {
+          // The last node of an odd round has a single arrival, which climbs to the next round on its own
+          if (__ticket.compare_exchange_strong(__state, __full_step, memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        else if (__ticket.compare_exchange_strong(__state, __half_step, memory_order_acq_rel))
+        {
+          // The first arrival at a node is done, its partner carries both arrivals to the next round
+          return false;
+        }
+        else if (__state == __half_step && __ticket.compare_exchange_strong(__state, __full_step, memory_order_acq_rel))
+        {
+          break;
+        }
+        // The node is full, the arrival is taken by the next one
+      }
+      __current_expected = __end_node;
+      __current /= 2;
+    }
+  }
+
+public:
+  _CCCL_HOST_API explicit __tree_barrier_base(ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : __nodes(nullptr)
+      , __expected(__expected)
+      , __expected_adjustment(0)
+      , __completion(__completion)
+      , __phase(0)
+  {
+    _CCCL_ASSERT(__expected >= 0 && __expected <= max(), "Expected count out of range");
+    __nodes = new __node[(static_cast<size_t>(__expected) + 1) / 2]();
+  }
+
+  _CCCL_HOST_API ~__tree_barrier_base()
+  {
+    delete[] __nodes;
+  }
+
+  __tree_barrier_base(__tree_barrier_base const&)            = delete;
+  __tree_barrier_base& operator=(__tree_barrier_base const&) = delete;
+
+  /*discard*/ _CCCL_HOST_API arrival_token arrive(ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "Arrival count must be positive");
+    const auto __old = __phase.load(memory_order_relaxed);
+    for (; __update > 0; --__update)
+    {
+      if (__arrive_tree(__old))
+      {
+        __completion();
+        __expected += __expected_adjustment.load(memory_order_relaxed);
+        __expected_adjustment.store(0, memory_order_relaxed);
+        __phase.store(__old + 2, memory_order_release);
+        __phase.notify_all();
+      }
+    }
+    return __old;
+  }
+  _CCCL_HOST_API void wait(arrival_token&& __old) const
+  {
+    __phase.wait(__old, memory_order_acquire);
+  }
+  _CCCL_HOST_API void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+  _CCCL_HOST_API void arrive_and_drop()
+  {
+    __expected_adjustment.fetch_sub(1, memory_order_relaxed);
+    (void) arrive();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr ptrdiff_t max() noexcept
+  {
+    return numeric_limits<int32_t>::max();
+  }
+};
+
+_CCCL_DIAG_POP
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#endif // __CUDA_STD___BARRIER_TREE_BARRIER_H
@@ -0,0 +1,283 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FLOATING_POINT_DECIMAL_H
+#define _CUDA_STD___CHARCONV_FLOATING_POINT_DECIMAL_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The floating point conversions are implemented for the IEEE binary32 and binary64 formats
+template <class _Tp>
+inline constexpr bool __fp_charconv_is_supported_v =
+  __fp_format_of_v<_Tp> == __fp_format::__binary32 || __fp_format_of_v<_Tp> == __fp_format::__binary64;
+
+template <class _Tp>
+struct __fp_charconv_traits
+{
+  static constexpr __fp_format __format = __fp_format_of_v<_Tp>;
+  static constexpr bool __is_double     = __format == __fp_format::__binary64;
+
+  using __storage_type = __fp_storage_t<__format>;
+
+  static constexpr int __mant_nbits = __fp_mant_nbits_v<__format>;
+  static constexpr int __exp_nbits  = __fp_exp_nbits_v<__format>;
+  static constexpr int __exp_bias   = __fp_exp_bias_v<__format>;
+
+  // The most digits of the shortest representation that round trips
+  static constexpr int __max_shortest_digits = __is_double ? 17 : 9;
+
+  // The most significant digits of the exact decimal expansion of a value, or of the point halfway between two
+  // adjacent values, which is (2^54 - 1) * 2^-1075 for binary64 and (2^25 - 1) * 2^-150 for binary32
+  static constexpr int __max_exact_digits = __is_double ? 768 : 113;
+
+  // The 32-bit limbs the big integers of the exact decimal expansion need: the integral part has fewer than
+  // __exp_bias + 2 bits, and the fractional part has at most __exp_bias + __mant_nbits + 1 bits, which grow by 30 bits
+  // when they are multiplied by 10^9
+  static constexpr int __bigint_limbs = (__exp_bias + __mant_nbits + 64) / 32;
+};
+
+//! @brief The value m * 2^e split into its significand and binary exponent, and the sign and kind of the value.
+struct __fp_charconv_decomposed
+{
+  bool __negative_;
+  bool __inf_;
+  bool __nan_;
+  uint64_t __ieee_mant_; //!< The stored fraction bits.
+  int __ieee_exp_; //!< The stored biased exponent.
+  uint64_t __m_; //!< The significand including the implicit bit.
+  int __e_; //!< The binary exponent of the least significant bit of the significand.
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __fp_charconv_decomposed __fp_charconv_decompose(_Tp __value) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  const auto __bits       = static_cast<uint64_t>(::cuda::std::__fp_get_storage(__value));
+  const auto __ieee_mant  = __bits & ((uint64_t{1} << _Traits::__mant_nbits) - 1);
+  const auto __ieee_exp   = static_cast<int>((__bits >> _Traits::__mant_nbits) & ((1u << _Traits::__exp_nbits) - 1));
+  const bool __negative   = (__bits >> (_Traits::__mant_nbits + _Traits::__exp_nbits)) != 0;
+  constexpr int __exp_max = (1 << _Traits::__exp_nbits) - 1;
+
+  __fp_charconv_decomposed __ret{__negative, false, false, __ieee_mant, __ieee_exp, __ieee_mant, 0};
+  if (__ieee_exp == __exp_max)
+  {
+    __ret.__inf_ = (__ieee_mant == 0);
+    __ret.__nan_ = (__ieee_mant != 0);
+  }
+  else if (__ieee_exp == 0)
+  {
+    __ret.__e_ = 1 - _Traits::__exp_bias - _Traits::__mant_nbits;
+  }
+  else
+  {
+    __ret.__m_ = __ieee_mant | (uint64_t{1} << _Traits::__mant_nbits);
+    __ret.__e_ = __ieee_exp - _Traits::__exp_bias - _Traits::__mant_nbits;
+  }
+  return __ret;
+}
+
+//! @brief The leading digits of an exact decimal expansion. The value is d.ddd * 10^__exp10_, where the digits past the
+//! written ones are zeros unless __inexact_ is set.
+struct __fp_exact_decimal_result
+{
+  int __size_;
+  int __exp10_;
+  bool __inexact_;
+};
+
+struct __fp_exact_decimal_sink
+{
+  char* __digits_;
+  int __max_digits_;
+  __fp_exact_decimal_result __ret_;
+
+  _CCCL_API constexpr void __push(uint32_t __d) noexcept
+  {
+    if (__ret_.__size_ < __max_digits_)
+    {
+      __digits_[__ret_.__size_++] = static_cast<char>('0' + __d);
+    }
+    else if (__d != 0)
+    {
+      __ret_.__inexact_ = true;
+    }
+  }
+};
+
+//! @brief Writes the leading significant digits of the exact decimal expansion of m * 2^e, with m != 0, to
+//! [__digits, __digits + __max_digits). At most __max_fraction_digits digits after the decimal point are produced, the
+//! leading zeros of values below 1 included.
+//!
+//! The integral part is converted by dividing a big integer by 10^9, and the fractional part by multiplying it by 10^9
+//! and taking the 9 digits that move above the binary point, so that the expansion is exact for any value.
+template <int _Limbs>
+[[nodiscard]] _CCCL_API constexpr __fp_exact_decimal_result __fp_exact_decimal(
+  uint64_t __m, int __e, char* __digits, int __max_digits, int __max_fraction_digits) noexcept
+{
+  _CCCL_ASSERT(__m != 0, "the value must not be zero");
+  _CCCL_ASSERT(__max_digits > 0, "at least one digit must be requested");
+
+  constexpr uint32_t __pow10_9 = 1'000'000'000u;
+
+  __fp_exact_decimal_sink __sink{__digits, __max_digits, {0, -1, false}};
+  bool __has_integral = false;
+
+  // The integral part
+  if (__e >= 0 || (__e > -64 && (__m >> -__e) != 0))
+  {
+    uint32_t __x[_Limbs]{};
+    int __n = 0;
+    if (__e >= 0)
+    {
+      const int __w   = __e / 32;
+      const int __b   = __e % 32;
+      const auto __lo = __m << __b;
+      __x[__w]        = static_cast<uint32_t>(__lo);
+      __x[__w + 1]    = static_cast<uint32_t>(__lo >> 32);
+      __x[__w + 2]    = (__b == 0) ? 0u : static_cast<uint32_t>(__m >> (64 - __b));
+      __n             = __w + 3;
+    }
+    else
+    {
+      const auto __int = __m >> -__e;
+      __x[0]           = static_cast<uint32_t>(__int);
+      __x[1]           = static_cast<uint32_t>(__int >> 32);
+      __n              = 2;
+    }
+
+    // the groups of 9 digits, from the least significant one
+    uint32_t __groups[_Limbs + 1]{};
+    int __ngroups = 0;
+    while (__n > 0 && __x[__n - 1] == 0)
+    {
+      --__n;
+    }
+    while (__n > 0)
+    {
+      uint64_t __rem = 0;
+      for (int __i = __n - 1; __i >= 0; --__i)
+      {
+        const uint64_t __cur = (__rem << 32) | __x[__i];
+        __x[__i]             = static_cast<uint32_t>(__cur / __pow10_9);
+        __rem                = __cur % __pow10_9;
+      }
+      __groups[__ngroups++] = static_cast<uint32_t>(__rem);
+      while (__n > 0 && __x[__n - 1] == 0)
+      {
+        --__n;
+      }
+    }
+
+    int __top_digits = 1;
+    for (uint32_t __p = 10; __top_digits < 9 && __groups[__ngroups - 1] >= __p; __p *= 10)
+    {
+      ++__top_digits;
+    }
+    __sink.__ret_.__exp10_ = (__ngroups - 1) * 9 + __top_digits - 1;
+    __has_integral         = true;
+
+    for (int __i = __ngroups - 1; __i >= 0; --__i)
+    {
+      uint32_t __div = 100'000'000u;
+      for (int __j = (__i == __ngroups - 1) ? 9 - __top_digits : 0; __j > 0; --__j)
+      {
+        __div /= 10;
+      }
+      for (; __div != 0; __div /= 10)
+      {
+        __sink.__push(__groups[__i] / __div % 10);
+      }
+    }
+  }
+
+  // The fractional part, a big integer f of s bits that stands for f / 2^s
+  if (__e < 0)
+  {
+    const int __s = -__e;
+    const int __w = __s / 32;
+    const int __b = __s % 32;
+
+    uint32_t __x[_Limbs]{};
+    const auto __frac = (__s >= 64) ? __m : (__m & ((uint64_t{1} << __s) - 1));
+    __x[0]            = static_cast<uint32_t>(__frac);
+    __x[1]            = static_cast<uint32_t>(__frac >> 32);
+
+    bool __nonzero  = (__frac != 0);
+    int __positions = 0;
+    while (__nonzero)
+    {
+      if (__positions >= __max_fraction_digits || __sink.__ret_.__size_ >= __max_digits)
+      {
+        __sink.__ret_.__inexact_ = true;
+        break;
+      }
+
+      // after the multiplication the value is below 10^9 * 2^s, so it fits in the limbs up to __w + 1
+      uint64_t __carry = 0;
+      for (int __i = 0; __i <= __w + 1; ++__i)
+      {
+        const uint64_t __cur = uint64_t{__x[__i]} * __pow10_9 + __carry;
+        __x[__i]             = static_cast<uint32_t>(__cur);
+        __carry              = __cur >> 32;
+      }
+      const auto __group = static_cast<uint32_t>((__x[__w] | (uint64_t{__x[__w + 1]} << 32)) >> __b);
+      __x[__w] &= (uint32_t{1} << __b) - 1;
+      __x[__w + 1] = 0;
+
+      __nonzero = false;
+      for (int __i = 0; __i <= __w; ++__i)
+      {
+        __nonzero |= (__x[__i] != 0);
+      }
+
+      for (uint32_t __div = 100'000'000u; __div != 0; __div /= 10)
+      {
+        const uint32_t __d = __group / __div % 10;
+        if (++__positions > __max_fraction_digits)
+        {
+          __sink.__ret_.__inexact_ |= (__d != 0);
+        }
+        else if (!__has_integral && __sink.__ret_.__size_ == 0 && __d == 0)
+        {
+          --__sink.__ret_.__exp10_;
+        }
+        else
+        {
+          __sink.__push(__d);
+        }
+      }
+    }
+  }
+  return __sink.__ret_;
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FLOATING_POINT_DECIMAL_H
@@ -20,16 +20,16 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__cmath/ilog.h>
 #include <cuda/__cmath/neg.h>
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/countr.h>
 #include <cuda/std/__charconv/chars_format.h>
 #include <cuda/std/__charconv/from_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__limits/numeric_limits.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
-#include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
 #include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__type_traits/is_signed.h>
@@ -93,6 +93,102 @@ __from_chars_int_generic(const char* __first, const char* __last, _Tp& __value,
   return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
 }
 
+// Loads 8 characters into a 64-bit word, the first one into the lowest byte
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_load_8_chars(const char* __p) noexcept
+{
+  // spelled out, so that compilers merge it into a single load
+  return static_cast<uint64_t>(static_cast<unsigned char>(__p[0]))
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[1])) << 8
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[2])) << 16
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[3])) << 24
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[4])) << 32
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[5])) << 40
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[6])) << 48
+       | static_cast<uint64_t>(static_cast<unsigned char>(__p[7])) << 56;
+}
+
+// Returns a word with a non-zero byte for every byte of __word that is not a decimal digit. A digit is 0x30 to 0x39,
+// i.e. has a high nibble of 3, also after adding 6; the carries of the addition only change the bytes that follow the
+// first non-digit
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_non_digits(uint64_t __word) noexcept
+{
+  constexpr uint64_t __high = 0xF0F0F0F0F0F0F0F0ull;
+  return ((__word & __high) | (((__word + 0x0606060606060606ull) & __high) >> 4)) ^ 0x3333333333333333ull;
+}
+
+[[nodiscard]] _CCCL_API constexpr uint32_t __from_chars_parse_8_digits(uint64_t __word) noexcept
+{
+  // combine neighboring digits into numbers of 2 digits, those into numbers of 4 digits, and those into the result
+  __word = ((__word & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+  __word = ((__word & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+  return static_cast<uint32_t>(((__word & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_base10(const char* __first, const char* __last, _Tp& __value) noexcept
+{
+  const char* __it = __first;
+
+  // parse 8 characters at a time, as long as the number of digits cannot overflow
+  for (int __n = 8; __n <= numeric_limits<_Tp>::digits10 && __last - __it >= 8; __n += 8)
+  {
+    uint64_t __word             = ::cuda::std::__from_chars_load_8_chars(__it);
+    const uint64_t __non_digits = ::cuda::std::__from_chars_non_digits(__word);
+    if (__non_digits != 0)
+    {
+      // the digits end within the word; shift them to its high bytes, so that the low bytes are leading zeros
+      const int __digits = ::cuda::std::countr_zero(__non_digits) / 8;
+      if (__digits > 0)
+      {
+        __word <<= 8 * (8 - __digits);
+        __value = static_cast<_Tp>(__value * _Tp(::cuda::__power_of_10_32bit()[__digits - 1])
+                                   + _Tp(::cuda::std::__from_chars_parse_8_digits(__word)));
+        __it += __digits;
+      }
+      return {__it, (__it == __first) ? errc::invalid_argument : errc{}};
+    }
+    __value = static_cast<_Tp>(__value * _Tp(100000000u) + _Tp(::cuda::std::__from_chars_parse_8_digits(__word)));
+    __it += 8;
+  }
+
+  constexpr _Tp __max_div_10 = numeric_limits<_Tp>::max() / 10u;
+  constexpr _Tp __max_mod_10 = numeric_limits<_Tp>::max() % 10u;
+
+  bool __overflow = false;
+  for (; __it != __last; ++__it)
+  {
+    const int __digit = *__it - '0';
+    if (__digit < 0 || __digit > 9)
+    {
+      break;
+    }
+    if (!__overflow)
+    {
+      if (__value > __max_div_10 || (__value == __max_div_10 && _Tp(__digit) > __max_mod_10))
+      {
+        __overflow = true;
+      }
+      else
+      {
+        __value = static_cast<_Tp>(__value * _Tp(10u) + _Tp(__digit));
+      }
+    }
+  }
+  return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+{
+  if (__base == 10)
+  {
+    return ::cuda::std::__from_chars_int_base10(__first, __last, __value);
+  }
+  return ::cuda::std::__from_chars_int_generic(__first, __last, __value, __base);
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
@@ -107,7 +203,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   if constexpr (is_signed_v<_Tp>)
   {
     bool __neg = (__first < __last && *__first == '-');
-    __ret      = ::cuda::std::__from_chars_int_generic(__first + __neg, __last, __result, __base);
+    __ret      = ::cuda::std::__from_chars_int(__first + __neg, __last, __result, __base);
     if (__ret.ec == errc{})
     {
       const auto __max = ::cuda::uabs((__neg) ? numeric_limits<_Tp>::min() : numeric_limits<_Tp>::max());
@@ -123,7 +219,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   }
   else
   {
-    __ret = ::cuda::std::__from_chars_int_generic(__first, __last, __result, __base);
+    __ret = ::cuda::std::__from_chars_int(__first, __last, __result, __base);
   }
 
   if (__ret.ec == errc{})
@@ -150,20 +246,6 @@ from_chars(const char* __first, const char* __last, char& __value, int __base =
   return __ret;
 }
 
-_CCCL_TEMPLATE(class _Tp)
-_CCCL_REQUIRES(is_floating_point_v<_Tp>)
-[[nodiscard]] _CCCL_API constexpr from_chars_result
-from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
-{
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::from_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
-}
-
 _CCCL_END_NAMESPACE_CUDA_STD
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -0,0 +1,489 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_decimal.h>
+#include <cuda/std/__charconv/floating_point_tables.h>
+#include <cuda/std/__charconv/from_chars.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Exponents beyond this bound saturate, which is far beyond the range of any value
+inline constexpr int64_t __from_chars_fp_max_exponent = 1'000'000'000;
+
+template <class _Tp>
+struct __from_chars_fp_traits : __fp_charconv_traits<_Tp>
+{
+  using _Base = __fp_charconv_traits<_Tp>;
+
+  // w * 10^q with w < 2^64 is zero below __min_q and infinite above __max_q
+  static constexpr int __min_q = _Base::__is_double ? -342 : -65;
+  static constexpr int __max_q = _Base::__is_double ? 308 : 38;
+
+  // the range of q in which w * 10^q can be exactly halfway between two values
+  static constexpr int __min_q_round_to_even = _Base::__is_double ? -4 : -17;
+  static constexpr int __max_q_round_to_even = _Base::__is_double ? 23 : 10;
+
+  static constexpr int __inf_exp = (1 << _Base::__exp_nbits) - 1;
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr _Tp __from_chars_fp_make(bool __negative, uint64_t __exp_and_mant) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+  using _Up     = typename _Traits::__storage_type;
+  const auto __sign = static_cast<_Up>(__negative) << (_Traits::__mant_nbits + _Traits::__exp_nbits);
+  return ::cuda::std::__fp_from_storage<_Tp>(static_cast<_Up>(__sign | static_cast<_Up>(__exp_and_mant)));
+}
+
+// Compares the next characters case insensitively with a lower case string
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_fp_match(const char* __first, const char* __last, const char* __str) noexcept
+{
+  for (; *__str != '\0'; ++__first, ++__str)
+  {
+    if (__first == __last || (*__first | 0x20) != *__str)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+[[nodiscard]] _CCCL_API constexpr int __from_chars_fp_digit(char __c, bool __hex) noexcept
+{
+  if ('0' <= __c && __c <= '9')
+  {
+    return __c - '0';
+  }
+  const char __lower = static_cast<char>(__c | 0x20);
+  if (__hex && 'a' <= __lower && __lower <= 'f')
+  {
+    return __lower - 'a' + 10;
+  }
+  return -1;
+}
+
+// Parses the exponent after the marker, which is only consumed if it is followed by at least one digit
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_fp_parse_exponent(const char*& __first, const char* __last, char __marker, int64_t& __exp) noexcept
+{
+  const char* __it = __first;
+  if (__it == __last || (*__it | 0x20) != __marker)
+  {
+    return false;
+  }
+  ++__it;
+  const bool __negative = (__it != __last && *__it == '-');
+  if (__it != __last && (*__it == '-' || *__it == '+'))
+  {
+    ++__it;
+  }
+  if (__it == __last || __from_chars_fp_digit(*__it, false) < 0)
+  {
+    return false;
+  }
+  int64_t __value = 0;
+  for (; __it != __last && __from_chars_fp_digit(*__it, false) >= 0; ++__it)
+  {
+    if (__value < __from_chars_fp_max_exponent)
+    {
+      __value = __value * 10 + (*__it - '0');
+    }
+  }
+  __exp   = __negative ? -__value : __value;
+  __first = __it;
+  return true;
+}
+
+//! @brief The significant digits of a decimal or hex number, which were parsed from the characters.
+struct __from_chars_fp_digits
+{
+  const char* __end_; //!< The end of the parsed characters.
+  const char* __first_digit_; //!< The first significant digit, or null if all digits are zeros.
+  const char* __last_digit_; //!< The end of the digits of the significand.
+  uint64_t __w_; //!< The first significant digits, as many as fit.
+  int __w_digits_; //!< The number of digits in __w_.
+  bool __truncated_; //!< Whether nonzero digits follow the ones in __w_.
+  int64_t __exp_; //!< The exponent of the first significant digit, in the base of the digits.
+};
+
+// Parses [digits][.digits][exponent], with at least one digit, and returns a null end if there is no number
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_digits
+__from_chars_fp_parse_digits(const char* __first, const char* __last, chars_format __fmt) noexcept
+{
+  const bool __hex       = (__fmt == chars_format::hex);
+  const int __base       = __hex ? 16 : 10;
+  const int __max_digits = __hex ? 16 : 19;
+
+  __from_chars_fp_digits __ret{nullptr, nullptr, nullptr, 0, 0, false, -1};
+
+  const char* __it = __first;
+  bool __any_digit = false;
+  int64_t __int_digits = 0; // the digits of the integral part from the first significant one
+  int64_t __leading_zeros = 0; // the zeros after the decimal point before the first significant digit
+  for (bool __fraction = false; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__fraction)
+    {
+      __fraction = true;
+      continue;
+    }
+    const int __d = ::cuda::std::__from_chars_fp_digit(*__it, __hex);
+    if (__d < 0)
+    {
+      break;
+    }
+    __any_digit = true;
+    if (__ret.__first_digit_ == nullptr)
+    {
+      if (__d == 0)
+      {
+        __leading_zeros += __fraction;
+        continue;
+      }
+      __ret.__first_digit_ = __it;
+    }
+    __int_digits += !__fraction && __int_digits < __from_chars_fp_max_exponent;
+    if (__ret.__w_digits_ < __max_digits)
+    {
+      __ret.__w_ = __ret.__w_ * __base + __d;
+      ++__ret.__w_digits_;
+    }
+    else
+    {
+      __ret.__truncated_ |= (__d != 0);
+    }
+  }
+  if (!__any_digit)
+  {
+    return __ret;
+  }
+  __ret.__last_digit_ = __it;
+
+  int64_t __exp = 0;
+  if (__fmt == chars_format::hex)
+  {
+    (void) ::cuda::std::__from_chars_fp_parse_exponent(__it, __last, 'p', __exp);
+  }
+  else if (__fmt != chars_format::fixed)
+  {
+    if (!::cuda::std::__from_chars_fp_parse_exponent(__it, __last, 'e', __exp) && __fmt == chars_format::scientific)
+    {
+      return __ret;
+    }
+  }
+  __ret.__end_ = __it;
+  __ret.__exp_ = (__int_digits > 0) ? __int_digits - 1 : -__leading_zeros - 1;
+  if (__hex)
+  {
+    // the exponent of hex numbers is binary
+    __ret.__exp_ = 4 * __ret.__exp_ + __exp;
+  }
+  else
+  {
+    __ret.__exp_ += __exp;
+  }
+  return __ret;
+}
+
+//! @brief The stored biased exponent and fraction bits of a value.
+struct __from_chars_fp_adjusted
+{
+  uint64_t __mant_;
+  int __power2_;
+};
+
+//! @brief Rounds w * 10^q, with w != 0 the exact significand, to the nearest value with the Eisel-Lemire algorithm.
+//!
+//! w is multiplied by the 128-bit truncated power of 10 from the table, whose low half is only needed when the high
+//! half of the product is too close to a rounding boundary. See D. Lemire, "Number Parsing at a Gigabyte per Second",
+//! and N. Mushtak and D. Lemire, "Fast Number Parsing Without Fallback" for the proof that no fallback is needed.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_adjusted
+__from_chars_fp_eisel_lemire(int64_t __q, uint64_t __w) noexcept
+{
+  using _Traits             = __from_chars_fp_traits<_Tp>;
+  constexpr int __mant_bits = _Traits::__mant_nbits;
+
+  if (__q < _Traits::__min_q)
+  {
+    return {0, 0};
+  }
+  if (__q > _Traits::__max_q)
+  {
+    return {0, _Traits::__inf_exp};
+  }
+
+  const int __lz = ::cuda::std::countl_zero(__w);
+  __w <<= __lz;
+
+  // the table is truncated, but the algorithm needs the negative powers down to 10^-27 rounded up, so that the products
+  // of halfway points with them are detected as exact below
+  const int __index     = 2 * (static_cast<int>(__q) - __fp_pow10_table_min);
+  const bool __round_up = (__q >= -27 && __q < 0);
+  const uint64_t __p_lo = ::cuda::std::__fp_pow10_table[__index + 1] + __round_up;
+  const uint64_t __p_hi = ::cuda::std::__fp_pow10_table[__index] + (__round_up && __p_lo == 0);
+
+  uint64_t __hi = ::cuda::mul_hi(__w, __p_hi);
+  uint64_t __lo = __w * __p_hi;
+
+  constexpr uint64_t __precision_mask = ~uint64_t{0} >> (__mant_bits + 3);
+  if ((__hi & __precision_mask) == __precision_mask)
+  {
+    const uint64_t __second_hi = ::cuda::mul_hi(__w, __p_lo);
+    __lo += __second_hi;
+    __hi += (__second_hi > __lo);
+  }
+
+  const int __upper_bit = static_cast<int>(__hi >> 63);
+  const int __shift     = __upper_bit + 64 - __mant_bits - 3;
+  uint64_t __mant       = __hi >> __shift;
+  // floor(log2(10^q)) + 63 is the binary exponent of the top bit of the product
+  int __power2 = ((((152170 + 65536) * static_cast<int>(__q)) >> 16) + 63) + __upper_bit - __lz + _Traits::__exp_bias;
+
+  if (__power2 <= 0)
+  {
+    // subnormal, or rounding up to the smallest normal value
+    if (-__power2 + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __mant >>= -__power2 + 1;
+    __mant += (__mant & 1);
+    __mant >>= 1;
+    return {__mant, (__mant < (uint64_t{1} << __mant_bits)) ? 0 : 1};
+  }
+
+  // a product that is exactly halfway between two values rounds to even, which only happens for a few exponents
+  if (__lo <= 1 && __q >= _Traits::__min_q_round_to_even && __q <= _Traits::__max_q_round_to_even
+      && (__mant & 3) == 1 && (__mant << __shift) == __hi)
+  {
+    __mant &= ~uint64_t{1};
+  }
+  __mant += (__mant & 1);
+  __mant >>= 1;
+  if (__mant >= (uint64_t{2} << __mant_bits))
+  {
+    __mant = uint64_t{1} << __mant_bits;
+    ++__power2;
+  }
+  __mant &= ~(uint64_t{1} << __mant_bits);
+  if (__power2 >= _Traits::__inf_exp)
+  {
+    return {0, _Traits::__inf_exp};
+  }
+  return {__mant, __power2};
+}
+
+//! @brief Decides between the value below and the one above the decimal digits, when they were too many to round them
+//! with the truncated significand, by comparing them with the exact expansion of the point halfway between both values.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr uint64_t
+__from_chars_fp_round_digits(const __from_chars_fp_digits& __digits, uint64_t __below) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  const auto __ieee_exp  = static_cast<int>(__below >> _Traits::__mant_nbits);
+  const auto __ieee_mant = __below & ((uint64_t{1} << _Traits::__mant_nbits) - 1);
+  const uint64_t __m     = (__ieee_exp == 0) ? __ieee_mant : __ieee_mant | (uint64_t{1} << _Traits::__mant_nbits);
+  const int __e          = ((__ieee_exp == 0) ? 1 : __ieee_exp) - _Traits::__exp_bias - _Traits::__mant_nbits;
+
+  char __half[_Traits::__max_exact_digits]{};
+  const auto __r = ::cuda::std::__fp_exact_decimal<_Traits::__bigint_limbs>(
+    2 * __m + 1, __e - 1, __half, _Traits::__max_exact_digits, INT_MAX);
+
+  int __cmp = (__digits.__exp_ < __r.__exp10_) ? -1 : (__digits.__exp_ > __r.__exp10_) ? 1 : 0;
+  int __i   = 0;
+  for (const char* __it = __digits.__first_digit_; __cmp == 0 && __it != __digits.__last_digit_; ++__it)
+  {
+    if (*__it == '.')
+    {
+      continue;
+    }
+    const char __h = (__i < __r.__size_) ? __half[__i] : '0';
+    __cmp          = (*__it < __h) ? -1 : (*__it > __h) ? 1 : 0;
+    ++__i;
+  }
+  for (; __cmp == 0 && __i < __r.__size_; ++__i)
+  {
+    __cmp = (__half[__i] != '0') ? -1 : 0;
+  }
+
+  // ties round to even
+  return (__cmp > 0 || (__cmp == 0 && (__below & 1) != 0)) ? __below + 1 : __below;
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_fp_decimal(const __from_chars_fp_digits& __digits) noexcept
+{
+  const int64_t __q = __digits.__exp_ - (__digits.__w_digits_ - 1);
+  const auto __am   = ::cuda::std::__from_chars_fp_eisel_lemire<_Tp>(__q, __digits.__w_);
+  auto __bits       = (uint64_t{static_cast<uint32_t>(__am.__power2_)} << __fp_charconv_traits<_Tp>::__mant_nbits)
+              | __am.__mant_;
+  if (__digits.__truncated_)
+  {
+    // the digits lie between w * 10^q and (w + 1) * 10^q, which round to the same value in most cases
+    const auto __above = ::cuda::std::__from_chars_fp_eisel_lemire<_Tp>(__q, __digits.__w_ + 1);
+    if (__above.__mant_ != __am.__mant_ || __above.__power2_ != __am.__power2_)
+    {
+      __bits = ::cuda::std::__from_chars_fp_round_digits<_Tp>(__digits, __bits);
+    }
+  }
+  return __bits;
+}
+
+// Rounds the hex digits to the nearest value, half to even
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_fp_hex(const __from_chars_fp_digits& __digits) noexcept
+{
+  using _Traits             = __from_chars_fp_traits<_Tp>;
+  constexpr int __mant_bits = _Traits::__mant_nbits;
+
+  // normalize w, so that its top bit has the binary exponent __e
+  const int __lz    = ::cuda::std::countl_zero(__digits.__w_);
+  const uint64_t __w = __digits.__w_ << __lz;
+  const int64_t __e  = __digits.__exp_ - 4 * (__digits.__w_digits_ - 1) + (63 - __lz);
+  if (__e > _Traits::__exp_bias)
+  {
+    return uint64_t{_Traits::__inf_exp} << __mant_bits;
+  }
+
+  // the bits below the significand, which are more for subnormal values
+  const int64_t __shift = (63 - __mant_bits) + ((__e < 1 - _Traits::__exp_bias) ? 1 - _Traits::__exp_bias - __e : 0);
+  if (__shift > 64)
+  {
+    return 0;
+  }
+  const uint64_t __mant = (__shift == 64) ? 0 : __w >> __shift;
+  const uint64_t __rem  = (__shift == 64) ? __w : __w & ((uint64_t{1} << __shift) - 1);
+  const uint64_t __half = uint64_t{1} << (__shift - 1);
+  const bool __up       = __rem > __half || (__rem == __half && (__digits.__truncated_ || (__mant & 1) != 0));
+
+  if (__shift > 63 - __mant_bits)
+  {
+    // a subnormal value, which becomes the smallest normal one when it rounds up to 2^mant_bits
+    return __mant + __up;
+  }
+  uint64_t __rounded = __mant + __up;
+  int64_t __biased   = __e + _Traits::__exp_bias;
+  if (__rounded == (uint64_t{2} << __mant_bits))
+  {
+    __rounded >>= 1;
+    ++__biased;
+  }
+  if (__biased >= _Traits::__inf_exp)
+  {
+    return uint64_t{_Traits::__inf_exp} << __mant_bits;
+  }
+  return (static_cast<uint64_t>(__biased) << __mant_bits) | (__rounded & ((uint64_t{1} << __mant_bits) - 1));
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_fp(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  static_assert(__fp_charconv_is_supported_v<_Tp>,
+                "cuda::std::from_chars supports floating point types of the IEEE binary32 and binary64 formats only");
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+
+  using _Traits               = __from_chars_fp_traits<_Tp>;
+  constexpr uint64_t __inf    = uint64_t{_Traits::__inf_exp} << _Traits::__mant_nbits;
+  constexpr uint64_t __qnan   = __inf | (uint64_t{1} << (_Traits::__mant_nbits - 1));
+
+  const char* __it      = __first;
+  const bool __negative = (__it != __last && *__it == '-');
+  __it += __negative;
+
+  if (::cuda::std::__from_chars_fp_match(__it, __last, "inf"))
+  {
+    __it += ::cuda::std::__from_chars_fp_match(__it, __last, "infinity") ? 8 : 3;
+    __value = ::cuda::std::__from_chars_fp_make<_Tp>(__negative, __inf);
+    return {__it, errc{}};
+  }
+  if (::cuda::std::__from_chars_fp_match(__it, __last, "nan"))
+  {
+    // the optional n-char-sequence in parentheses is ignored
+    __it += 3;
+    if (__it != __last && *__it == '(')
+    {
+      const char* __p = __it + 1;
+      while (__p != __last
+             && (::cuda::std::__from_chars_fp_digit(*__p, false) >= 0 || *__p == '_'
+                 || ('a' <= (*__p | 0x20) && (*__p | 0x20) <= 'z')))
+      {
+        ++__p;
+      }
+      if (__p != __last && *__p == ')')
+      {
+        __it = __p + 1;
+      }
+    }
+    __value = ::cuda::std::__from_chars_fp_make<_Tp>(__negative, __qnan);
+    return {__it, errc{}};
+  }
+
+  const auto __digits = ::cuda::std::__from_chars_fp_parse_digits(__it, __last, __fmt);
+  if (__digits.__end_ == nullptr)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  uint64_t __bits = 0;
+  if (__digits.__first_digit_ != nullptr)
+  {
+    __bits = (__fmt == chars_format::hex)
+             ? ::cuda::std::__from_chars_fp_hex<_Tp>(__digits)
+             : ::cuda::std::__from_chars_fp_decimal<_Tp>(__digits);
+    if (__bits == 0 || __bits >= __inf)
+    {
+      return {__digits.__end_, errc::result_out_of_range};
+    }
+  }
+  __value = ::cuda::std::__from_chars_fp_make<_Tp>(__negative, __bits);
+  return {__digits.__end_, errc{}};
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
+{
+  return ::cuda::std::__from_chars_fp(__first, __last, __value, __fmt);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
@@ -20,14 +20,17 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__cmath/ilog.h>
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/has_single_bit.h>
 #include <cuda/std/__charconv/chars_format.h>
 #include <cuda/std/__charconv/to_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
-#include <cuda/std/__type_traits/always_false.h>
+#include <cuda/std/__limits/numeric_limits.h>
 #include <cuda/std/__type_traits/conditional.h>
-#include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
 #include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__type_traits/is_signed.h>
@@ -98,6 +101,76 @@ _CCCL_API constexpr void __to_chars_int_generic(char* __last, _Tp __value, int _
   } while (__value != 0);
 }
 
+// The decimal digits of 00 to 99, so that two digits are emitted per division
+_CCCL_GLOBAL_CONSTANT char __to_chars_digit_pairs[] =
+  "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+  "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr int __to_chars_int_width_base10(_Tp __v) noexcept
+{
+  return (__v == 0u) ? 1 : ::cuda::ilog10(__v) + 1;
+}
+
+template <class _Tp>
+_CCCL_API constexpr void __to_chars_int_base10(char* __last, _Tp __value) noexcept
+{
+  if constexpr (sizeof(_Tp) > sizeof(uint64_t))
+  {
+    // split off the low 18 digits, so that the rest is converted with 64-bit divisions; adding 10^18 keeps their
+    // leading zeros, and its leading 1 is overwritten by the next digits
+    constexpr uint64_t __pow10_18 = 1'000'000'000'000'000'000ull;
+    while (__value > numeric_limits<uint64_t>::max())
+    {
+      ::cuda::std::__to_chars_int_base10(__last, static_cast<uint64_t>(__value % __pow10_18) + __pow10_18);
+      __last -= 18;
+      __value /= __pow10_18;
+    }
+    ::cuda::std::__to_chars_int_base10(__last, static_cast<uint64_t>(__value));
+  }
+  else
+  {
+    while (__value >= 100u)
+    {
+      const auto __pair = static_cast<int>(__value % 100u) * 2;
+      __value /= 100u;
+      *--__last = ::cuda::std::__to_chars_digit_pairs[__pair + 1];
+      *--__last = ::cuda::std::__to_chars_digit_pairs[__pair];
+    }
+    if (__value >= 10u)
+    {
+      const auto __pair = static_cast<int>(__value) * 2;
+      *--__last         = ::cuda::std::__to_chars_digit_pairs[__pair + 1];
+      *--__last         = ::cuda::std::__to_chars_digit_pairs[__pair];
+    }
+    else
+    {
+      *--__last = static_cast<char>('0' + static_cast<int>(__value));
+    }
+  }
+}
+
+// Bases that are powers of 2 take a fixed number of bits per digit
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr int __to_chars_int_width_pow2(_Tp __v, int __base) noexcept
+{
+  const int __shift = ::cuda::std::countr_zero(static_cast<unsigned>(__base));
+  const int __bits  = numeric_limits<_Tp>::digits - ::cuda::std::countl_zero(static_cast<_Tp>(__v | 1u));
+  return (__bits + __shift - 1) / __shift;
+}
+
+template <class _Tp>
+_CCCL_API constexpr void __to_chars_int_pow2(char* __last, _Tp __value, int __base) noexcept
+{
+  const int __shift = ::cuda::std::countr_zero(static_cast<unsigned>(__base));
+  const auto __mask = static_cast<_Tp>(__base - 1);
+  do
+  {
+    *--__last = ::cuda::std::__to_chars_value_to_char(static_cast<int>(__value & __mask), __base);
+    __value >>= __shift;
+  } while (__value != 0);
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
@@ -116,8 +189,13 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
   }
   else
   {
+    using _Up = ::cuda::std::conditional_t<sizeof(_Tp) >= sizeof(uint32_t), _Tp, uint32_t>;
+
     const ptrdiff_t __cap = __last - __first;
-    const int __n         = ::cuda::std::__to_chars_int_width(__value, __base);
+    const bool __pow2     = ::cuda::std::has_single_bit(static_cast<unsigned>(__base));
+    const int __n         = (__base == 10) ? ::cuda::std::__to_chars_int_width_base10(static_cast<_Up>(__value))
+                          : (__pow2)       ? ::cuda::std::__to_chars_int_width_pow2(static_cast<_Up>(__value), __base)
+                                           : ::cuda::std::__to_chars_int_width(__value, __base);
 
     if (__n > __cap)
     {
@@ -126,7 +204,18 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
 
     char* __new_last = __first + __n;
 
-    ::cuda::std::__to_chars_int_generic(__new_last, __value, __base);
+    if (__base == 10)
+    {
+      ::cuda::std::__to_chars_int_base10(__new_last, static_cast<_Up>(__value));
+    }
+    else if (__pow2)
+    {
+      ::cuda::std::__to_chars_int_pow2(__new_last, static_cast<_Up>(__value), __base);
+    }
+    else
+    {
+      ::cuda::std::__to_chars_int_generic(__new_last, __value, __base);
+    }
 
     return {__new_last, errc{}};
   }
@@ -147,47 +236,6 @@ to_chars(char* __first, char* __last, char __value, int __base = 10) noexcept
 
 _CCCL_API constexpr to_chars_result to_chars(char*, char*, bool, int = 10) noexcept = delete;
 
-_CCCL_TEMPLATE(class _Tp)
-_CCCL_REQUIRES(is_floating_point_v<_Tp>)
-[[nodiscard]] _CCCL_API constexpr to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
-{
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  return {};
-}
-
-_CCCL_TEMPLATE(class _Tp)
-_CCCL_REQUIRES(is_floating_point_v<_Tp>)
-[[nodiscard]] _CCCL_API constexpr to_chars_result
-to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
-{
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
-}
-
-_CCCL_TEMPLATE(class _Tp)
-_CCCL_REQUIRES(is_floating_point_v<_Tp>)
-[[nodiscard]] _CCCL_API constexpr to_chars_result
-to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
-{
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  (void) __prec;
-  return {};
-}
-
 _CCCL_END_NAMESPACE_CUDA_STD
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -0,0 +1,598 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_decimal.h>
+#include <cuda/std/__charconv/floating_point_tables.h>
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief The shortest decimal d * 10^k that rounds to the value.
+struct __to_chars_fp_shortest_result
+{
+  uint64_t __digits_;
+  int __exp10_;
+};
+
+// floor(log2(10^e)) for e in [-1233, 1233]
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_floor_log2_pow10(int __e) noexcept
+{
+  return (__e * 1741647) >> 19;
+}
+
+// Computes round_to_odd(g * cp / 2^(2 * bits)), g being the table entry of the power of 10 rounded up
+template <class _Up>
+[[nodiscard]] _CCCL_API constexpr _Up __to_chars_fp_round_to_odd(int __k, _Up __cp) noexcept
+{
+  const int __index = 2 * (__k - __fp_pow10_table_min);
+  if constexpr (sizeof(_Up) == sizeof(uint64_t))
+  {
+    const uint64_t __g_lo = ::cuda::std::__fp_pow10_table[__index + 1] + 1;
+    const uint64_t __g_hi = ::cuda::std::__fp_pow10_table[__index] + (__g_lo == 0);
+
+    const uint64_t __x_hi = ::cuda::mul_hi(__g_lo, __cp);
+    uint64_t __y_lo       = __g_hi * __cp;
+    uint64_t __y_hi       = ::cuda::mul_hi(__g_hi, __cp);
+    __y_lo += __x_hi;
+    __y_hi += (__y_lo < __x_hi);
+    return __y_hi | (__y_lo > 1);
+  }
+  else
+  {
+    const uint64_t __g   = ::cuda::std::__fp_pow10_table[__index] + 1;
+    const uint64_t __b01 = uint64_t{__cp} * static_cast<uint32_t>(__g);
+    const uint64_t __b11 = uint64_t{__cp} * (__g >> 32);
+    const uint64_t __hi  = __b11 + (__b01 >> 32);
+    return static_cast<uint32_t>(__hi >> 32) | (static_cast<uint32_t>(__hi) > 1);
+  }
+}
+
+//! @brief Finds the shortest decimal that rounds to a finite nonzero value with the Schubfach algorithm.
+//!
+//! The bounds of the rounding interval are scaled by a power of 10 from the table, which is exact enough for rounding
+//! to odd to decide which of the at most two candidates, with one digit less or at full length, lies in the interval.
+//! See R. Giulietti, "The Schubfach way to render doubles".
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_shortest_result
+__to_chars_fp_shortest(const __fp_charconv_decomposed& __d) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+  using _Up     = typename _Traits::__storage_type;
+
+  const auto __c = static_cast<_Up>(__d.__m_);
+  const int __q  = __d.__e_;
+
+  __to_chars_fp_shortest_result __ret{};
+
+  // integers below 2^digits are their own shortest representation
+  if (__d.__ieee_exp_ != 0 && __q <= 0 && -__q <= _Traits::__mant_nbits
+      && (__c & ((_Up{1} << -__q) - 1)) == 0)
+  {
+    __ret = {static_cast<uint64_t>(__c >> -__q), 0};
+  }
+  else
+  {
+    const bool __is_even       = (__c % 2 == 0);
+    const bool __lower_closer  = (__d.__ieee_mant_ == 0 && __d.__ieee_exp_ > 1);
+    const _Up __cbl            = 4 * __c - 2 + __lower_closer;
+    const _Up __cb             = 4 * __c;
+    const _Up __cbr            = 4 * __c + 2;
+
+    // floor(log10(2^q)), or floor(log10(3/4 * 2^q)) when the lower bound is closer
+    const int __k = (__q * 1262611 - (__lower_closer ? 524031 : 0)) >> 22;
+    const int __h = __q + ::cuda::std::__to_chars_fp_floor_log2_pow10(-__k) + 1;
+
+    const _Up __vbl = ::cuda::std::__to_chars_fp_round_to_odd<_Up>(-__k, static_cast<_Up>(__cbl << __h));
+    const _Up __vb  = ::cuda::std::__to_chars_fp_round_to_odd<_Up>(-__k, static_cast<_Up>(__cb << __h));
+    const _Up __vbr = ::cuda::std::__to_chars_fp_round_to_odd<_Up>(-__k, static_cast<_Up>(__cbr << __h));
+
+    const _Up __lower = __vbl + !__is_even;
+    const _Up __upper = __vbr - !__is_even;
+
+    const _Up __s = __vb / 4;
+    bool __done   = false;
+    if (__s >= 10)
+    {
+      const _Up __sp        = __s / 10;
+      const bool __up_in    = __lower <= 40 * __sp;
+      const bool __wp_in    = 40 * __sp + 40 <= __upper;
+      if (__up_in != __wp_in)
+      {
+        __ret  = {static_cast<uint64_t>(__sp + __wp_in), __k + 1};
+        __done = true;
+      }
+    }
+    if (!__done)
+    {
+      const bool __u_in = __lower <= 4 * __s;
+      const bool __w_in = 4 * __s + 4 <= __upper;
+      if (__u_in != __w_in)
+      {
+        __ret = {static_cast<uint64_t>(__s + __w_in), __k};
+      }
+      else
+      {
+        const _Up __mid       = 4 * __s + 2;
+        const bool __round_up = __vb > __mid || (__vb == __mid && (__s & 1) != 0);
+        __ret                 = {static_cast<uint64_t>(__s + __round_up), __k};
+      }
+    }
+  }
+
+  while (__ret.__digits_ % 10 == 0)
+  {
+    __ret.__digits_ /= 10;
+    ++__ret.__exp10_;
+  }
+  return __ret;
+}
+
+// Writes the sign, and returns whether it fits
+[[nodiscard]] _CCCL_API constexpr bool __to_chars_fp_write_sign(char*& __first, char* __last, bool __negative) noexcept
+{
+  if (__negative)
+  {
+    if (__first == __last)
+    {
+      return false;
+    }
+    *__first++ = '-';
+  }
+  return true;
+}
+
+// Writes the exponent of the scientific and the hex formats, which has a sign and at least __min_digits digits
+_CCCL_API constexpr void
+__to_chars_fp_write_exponent(char*& __first, char __marker, int __exp, int __min_digits) noexcept
+{
+  *__first++      = __marker;
+  *__first++      = (__exp < 0) ? '-' : '+';
+  const auto __ue = static_cast<uint32_t>((__exp < 0) ? -__exp : __exp);
+  const int __n   = ::cuda::std::max(::cuda::std::__to_chars_int_width_base10(__ue), __min_digits);
+  __first += __n;
+  char* __it = __first;
+  for (uint32_t __v = __ue; __it != __first - __n; __v /= 10)
+  {
+    *--__it = static_cast<char>('0' + __v % 10);
+  }
+}
+
+[[nodiscard]] _CCCL_API constexpr char* __to_chars_fp_fill_zeros(char* __first, ptrdiff_t __n) noexcept
+{
+  for (; __n > 0; --__n)
+  {
+    *__first++ = '0';
+  }
+  return __first;
+}
+
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_exponent_width(int __exp, int __min_digits) noexcept
+{
+  const auto __ue = static_cast<uint32_t>((__exp < 0) ? -__exp : __exp);
+  return 2 + ::cuda::std::max(::cuda::std::__to_chars_int_width_base10(__ue), __min_digits);
+}
+
+//! @brief Writes the decimal d.ddd * 10^__exp10 with the digits [__digits, __digits + __size) in fixed notation with
+//! __frac_digits digits after the decimal point, padding with zeros.
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_write_fixed(
+  char* __first,
+  char* __last,
+  bool __negative,
+  const char* __digits,
+  int __size,
+  int __exp10,
+  int __frac_digits) noexcept
+{
+  const ptrdiff_t __int_digits = (__size == 0 || __exp10 < 0) ? 1 : ptrdiff_t{__exp10} + 1;
+  const ptrdiff_t __width =
+    ptrdiff_t{__negative} + __int_digits + ((__frac_digits > 0) ? ptrdiff_t{__frac_digits} + 1 : 0);
+  if (__last - __first < __width)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  (void) ::cuda::std::__to_chars_fp_write_sign(__first, __last, __negative);
+  if (__size == 0 || __exp10 < 0)
+  {
+    *__first++ = '0';
+  }
+  else
+  {
+    for (int __i = 0; __i <= __exp10; ++__i)
+    {
+      *__first++ = (__i < __size) ? __digits[__i] : '0';
+    }
+  }
+  if (__frac_digits > 0)
+  {
+    *__first++ = '.';
+    // the digits after the decimal point are the ones from index __exp10 + 1 on, preceded by zeros for values below 1
+    const ptrdiff_t __from    = ptrdiff_t{__exp10} + 1;
+    const ptrdiff_t __written =
+      ::cuda::std::min(ptrdiff_t{__frac_digits}, ::cuda::std::max(__size - __from, ptrdiff_t{0}));
+    for (ptrdiff_t __j = 0; __j < __written; ++__j)
+    {
+      *__first++ = (__from + __j < 0) ? '0' : __digits[__from + __j];
+    }
+    __first = ::cuda::std::__to_chars_fp_fill_zeros(__first, __frac_digits - __written);
+  }
+  return {__first, errc{}};
+}
+
+//! @brief Writes the decimal d.ddd * 10^__exp10 with the digits [__digits, __digits + __size) in scientific notation
+//! with __frac_digits digits after the decimal point, padding with zeros.
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_write_scientific(
+  char* __first,
+  char* __last,
+  bool __negative,
+  const char* __digits,
+  int __size,
+  int __exp10,
+  int __frac_digits) noexcept
+{
+  const ptrdiff_t __width = ptrdiff_t{__negative} + 1 + ((__frac_digits > 0) ? ptrdiff_t{__frac_digits} + 1 : 0)
+                          + ::cuda::std::__to_chars_fp_exponent_width(__exp10, 2);
+  if (__last - __first < __width)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  (void) ::cuda::std::__to_chars_fp_write_sign(__first, __last, __negative);
+  *__first++ = (__size == 0) ? '0' : __digits[0];
+  if (__frac_digits > 0)
+  {
+    *__first++ = '.';
+    const int __written = ::cuda::std::min(__frac_digits, ::cuda::std::max(__size - 1, 0));
+    for (int __j = 1; __j <= __written; ++__j)
+    {
+      *__first++ = __digits[__j];
+    }
+    __first = ::cuda::std::__to_chars_fp_fill_zeros(__first, ptrdiff_t{__frac_digits} - __written);
+  }
+  ::cuda::std::__to_chars_fp_write_exponent(__first, 'e', __exp10, 2);
+  return {__first, errc{}};
+}
+
+//! @brief Writes the value in hex notation, with the shortest number of hex digits if __prec is negative.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_hex(char* __first, char* __last, const __fp_charconv_decomposed& __d, int __prec) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  // the fraction bits are shifted left to fill whole hex digits
+  constexpr int __nibbles = (_Traits::__mant_nbits + 3) / 4;
+
+  uint64_t __frac = __d.__ieee_mant_ << (4 * __nibbles - _Traits::__mant_nbits);
+  int __lead      = (__d.__ieee_exp_ != 0) ? 1 : 0;
+  int __exp2      = (__d.__ieee_exp_ != 0) ? __d.__ieee_exp_ - _Traits::__exp_bias : 1 - _Traits::__exp_bias;
+  if (__d.__m_ == 0)
+  {
+    __exp2 = 0;
+  }
+
+  int __count = __nibbles;
+  if (__prec < 0)
+  {
+    while (__count > 0 && (__frac & 0xf) == 0)
+    {
+      __frac >>= 4;
+      --__count;
+    }
+  }
+  else if (__prec < __nibbles)
+  {
+    // round half to even at the last hex digit kept; the leading digit may become 2, which is not renormalized
+    const int __drop      = 4 * (__nibbles - __prec);
+    const uint64_t __rem  = __frac & ((uint64_t{1} << __drop) - 1);
+    const uint64_t __half = uint64_t{1} << (__drop - 1);
+    __frac >>= __drop;
+    const bool __odd = (__prec == 0) ? (__lead & 1) != 0 : (__frac & 1) != 0;
+    if (__rem > __half || (__rem == __half && __odd))
+    {
+      if (++__frac == (uint64_t{1} << (4 * __prec)))
+      {
+        __frac = 0;
+        ++__lead;
+      }
+    }
+    __count = __prec;
+  }
+
+  const int __zeros = (__prec > __count) ? __prec - __count : 0;
+  const ptrdiff_t __width =
+    ptrdiff_t{__d.__negative_} + 1 + ((__count + __zeros > 0) ? ptrdiff_t{__count} + __zeros + 1 : 0)
+    + ::cuda::std::__to_chars_fp_exponent_width(__exp2, 1);
+  if (__last - __first < __width)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  (void) ::cuda::std::__to_chars_fp_write_sign(__first, __last, __d.__negative_);
+  *__first++ = static_cast<char>('0' + __lead);
+  if (__count + __zeros > 0)
+  {
+    *__first++ = '.';
+    for (int __i = __count - 1; __i >= 0; --__i)
+    {
+      *__first++ = ::cuda::std::__to_chars_value_to_char(static_cast<int>((__frac >> (4 * __i)) & 0xf), 16);
+    }
+    __first = ::cuda::std::__to_chars_fp_fill_zeros(__first, __zeros);
+  }
+  ::cuda::std::__to_chars_fp_write_exponent(__first, 'p', __exp2, 1);
+  return {__first, errc{}};
+}
+
+//! @brief Rounds the exact digits to __keep digits, half to even.
+_CCCL_API constexpr void __to_chars_fp_round(char* __digits, __fp_exact_decimal_result& __r, int __keep) noexcept
+{
+  if (__keep >= __r.__size_)
+  {
+    return;
+  }
+
+  bool __sticky = __r.__inexact_;
+  for (int __i = __keep + 1; __i < __r.__size_; ++__i)
+  {
+    __sticky |= (__digits[__i] != '0');
+  }
+  const char __rd  = __digits[__keep];
+  const bool __odd = (__keep > 0) && ((__digits[__keep - 1] - '0') & 1) != 0;
+
+  __r.__size_    = __keep;
+  __r.__inexact_ = false;
+  if (__rd > '5' || (__rd == '5' && (__sticky || __odd)))
+  {
+    int __i = __keep - 1;
+    for (; __i >= 0 && __digits[__i] == '9'; --__i)
+    {
+      __digits[__i] = '0';
+    }
+    if (__i >= 0)
+    {
+      ++__digits[__i];
+    }
+    else
+    {
+      // all digits were nines, or none was kept
+      __digits[0] = '1';
+      __r.__size_ = (__keep > 0) ? __keep : 1;
+      ++__r.__exp10_;
+    }
+  }
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_shortest(char* __first, char* __last, const __fp_charconv_decomposed& __d, chars_format __fmt) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<_Tp>(__first, __last, __d, -1);
+  }
+
+  // the digits of the shortest representation
+  char __buf[20]{};
+  int __size  = 0;
+  int __exp10 = 0;
+  if (__d.__m_ != 0)
+  {
+    const auto __r = ::cuda::std::__to_chars_fp_shortest<_Tp>(__d);
+    __size         = ::cuda::std::__to_chars_int_width_base10(__r.__digits_);
+    __exp10        = __r.__exp10_ + __size - 1;
+    ::cuda::std::__to_chars_int_base10(__buf + __size, __r.__digits_);
+  }
+  else
+  {
+    __buf[0] = '0';
+    __size   = 1;
+  }
+
+  bool __scientific = false;
+  if (__fmt == chars_format::scientific)
+  {
+    __scientific = true;
+  }
+  else if (__fmt == chars_format::general)
+  {
+    // like %g with the default precision of 6, but keeping all the digits
+    __scientific = __exp10 < -4 || __exp10 >= 6;
+  }
+  else if (__fmt != chars_format::fixed)
+  {
+    // without a format, the shorter of the fixed and the scientific notation, preferring fixed
+    const int __sci_width   = __size + (__size > 1) + ::cuda::std::__to_chars_fp_exponent_width(__exp10, 2);
+    const int __fixed_width = (__exp10 < 0) ? __size + 1 - __exp10 : (__exp10 >= __size - 1) ? __exp10 + 1 : __size + 1;
+    __scientific            = __sci_width < __fixed_width;
+  }
+
+  if (__scientific)
+  {
+    return ::cuda::std::__to_chars_fp_write_scientific(
+      __first, __last, __d.__negative_, __buf, __size, __exp10, __size - 1);
+  }
+
+  if (__d.__e_ > 0)
+  {
+    // large integers are written exactly, instead of padding the shortest digits with zeros
+    constexpr int __max_integral_digits = (_Traits::__exp_bias + 1) * 30103 / 100000 + 1;
+    char __exact[__max_integral_digits]{};
+    const auto __r = ::cuda::std::__fp_exact_decimal<_Traits::__bigint_limbs>(
+      __d.__m_, __d.__e_, __exact, __max_integral_digits, 0);
+    return ::cuda::std::__to_chars_fp_write_fixed(
+      __first, __last, __d.__negative_, __exact, __r.__size_, __r.__exp10_, 0);
+  }
+  const int __frac_digits = (__size - 1 - __exp10 > 0) ? __size - 1 - __exp10 : 0;
+  return ::cuda::std::__to_chars_fp_write_fixed(
+    __first, __last, __d.__negative_, __buf, __size, __exp10, __frac_digits);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_precision(
+  char* __first, char* __last, const __fp_charconv_decomposed& __d, chars_format __fmt, int __prec) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<_Tp>(__first, __last, __d, __prec);
+  }
+
+  // the number of significant digits kept, or of digits after the decimal point in fixed notation
+  const int __keep = (__fmt == chars_format::general) ? ((__prec == 0) ? 1 : __prec) : __prec;
+
+  char __buf[_Traits::__max_exact_digits]{};
+  __fp_exact_decimal_result __r{0, 0, false};
+  if (__d.__m_ != 0)
+  {
+    if (__fmt == chars_format::fixed)
+    {
+      __r = ::cuda::std::__fp_exact_decimal<_Traits::__bigint_limbs>(
+        __d.__m_, __d.__e_, __buf, _Traits::__max_exact_digits, (__keep < INT_MAX) ? __keep + 1 : __keep);
+      if (__r.__size_ > 0 && __r.__size_ - 1 - __r.__exp10_ > __keep)
+      {
+        ::cuda::std::__to_chars_fp_round(__buf, __r, __r.__exp10_ + 1 + __keep);
+      }
+      else if (__r.__size_ == 0)
+      {
+        // below 10^-(keep + 1), which rounds to zero
+        __r = {0, 0, false};
+      }
+    }
+    else
+    {
+      // the significant digits kept, and one more to round
+      const int __significant =
+        (__fmt == chars_format::scientific && __keep < _Traits::__max_exact_digits) ? __keep + 1 : __keep;
+      const int __max_digits =
+        (__significant < _Traits::__max_exact_digits) ? __significant + 1 : _Traits::__max_exact_digits;
+      __r = ::cuda::std::__fp_exact_decimal<_Traits::__bigint_limbs>(__d.__m_, __d.__e_, __buf, __max_digits, INT_MAX);
+      ::cuda::std::__to_chars_fp_round(__buf, __r, __significant);
+    }
+  }
+
+  if (__fmt == chars_format::fixed)
+  {
+    return ::cuda::std::__to_chars_fp_write_fixed(
+      __first, __last, __d.__negative_, __buf, __r.__size_, __r.__exp10_, __keep);
+  }
+  if (__fmt == chars_format::scientific)
+  {
+    return ::cuda::std::__to_chars_fp_write_scientific(
+      __first, __last, __d.__negative_, __buf, __r.__size_, __r.__exp10_, __keep);
+  }
+
+  // general is like %g, without trailing zeros
+  while (__r.__size_ > 0 && __buf[__r.__size_ - 1] == '0')
+  {
+    --__r.__size_;
+  }
+  const int __size = (__r.__size_ == 0) ? 1 : __r.__size_;
+  if (__r.__size_ == 0)
+  {
+    __buf[0] = '0';
+  }
+  if (__r.__exp10_ < -4 || __r.__exp10_ >= __keep)
+  {
+    return ::cuda::std::__to_chars_fp_write_scientific(
+      __first, __last, __d.__negative_, __buf, __size, __r.__exp10_, __size - 1);
+  }
+  const int __frac_digits = (__size - 1 - __r.__exp10_ > 0) ? __size - 1 - __r.__exp10_ : 0;
+  return ::cuda::std::__to_chars_fp_write_fixed(
+    __first, __last, __d.__negative_, __buf, __size, __r.__exp10_, __frac_digits);
+}
+
+// Dispatches the conversions, with a negative precision for the shortest representation, and an empty format for
+// the overload without one
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
+{
+  static_assert(__fp_charconv_is_supported_v<_Tp>,
+                "cuda::std::to_chars supports floating point types of the IEEE binary32 and binary64 formats only");
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+
+  const auto __d = ::cuda::std::__fp_charconv_decompose(__value);
+  if (__d.__inf_ || __d.__nan_)
+  {
+    const char* __str = __d.__inf_ ? "inf" : "nan";
+    if (!::cuda::std::__to_chars_fp_write_sign(__first, __last, __d.__negative_) || __last - __first < 3)
+    {
+      return {__last, errc::value_too_large};
+    }
+    for (int __i = 0; __i < 3; ++__i)
+    {
+      *__first++ = __str[__i];
+    }
+    return {__first, errc{}};
+  }
+
+  if (__prec < 0)
+  {
+    return ::cuda::std::__to_chars_fp_shortest<_Tp>(__first, __last, __d, __fmt);
+  }
+  return ::cuda::std::__to_chars_fp_precision<_Tp>(__first, __last, __d, __fmt, __prec);
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API constexpr to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
+{
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, chars_format{}, -1);
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
+{
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, -1);
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
+{
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, (__prec < 0) ? 6 : __prec);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
@@ -0,0 +1,261 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+#define _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/copy_backward.h>
+#include <cuda/std/__algorithm/find.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_decimal.h>
+#include <cuda/std/__charconv/to_chars_floating_point.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__format/format_integral.h>
+#include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/to_underlying.h>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! The most digits before the decimal point of a value in fixed notation.
+template <class _Tp>
+inline constexpr int __fmt_fp_max_integral_v = numeric_limits<_Tp>::max_exponent10 + 1;
+
+//! The most digits after the decimal point that are not zero, which are the ones of the smallest subnormal value.
+//! Larger precisions only add zeros, which are written without storing them in the buffer.
+template <class _Tp>
+inline constexpr int __fmt_fp_max_fractional_v = numeric_limits<_Tp>::digits - numeric_limits<_Tp>::min_exponent;
+
+template <class _Tp>
+inline constexpr int __fmt_fp_buffer_size_v =
+  1 // Reserve space for the sign.
+  + __fmt_fp_max_integral_v<_Tp> // The digits before the decimal point.
+  + 1 // Reserve space for the decimal point.
+  + __fmt_fp_max_fractional_v<_Tp> // The digits after the decimal point.
+  + 6; // Reserve space for the exponent, which is at most 'p-1022' or 'e+308'.
+
+//! Writes the value with __num_trailing_zeros zeros inserted before its exponent, or at its end when it has none.
+template <class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_HOST_DEVICE_API _OutIt __fmt_write_using_trailing_zeros(
+  const char* __first,
+  const char* __last,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_CharT> __specs,
+  const char* __exponent,
+  size_t __num_trailing_zeros)
+{
+  _CCCL_ASSERT(__first <= __exponent && __exponent <= __last, "Not a valid range");
+
+  const size_t __size = static_cast<size_t>(__last - __first) + __num_trailing_zeros;
+  __fmt_padding_size_result __padding{0, 0};
+  if (__size < __specs.__width_)
+  {
+    __padding =
+      ::cuda::std::__fmt_padding_size(__size, __specs.__width_, __fmt_spec_alignment{__specs.__std_.__alignment_});
+  }
+
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__before_, __specs.__fill_);
+  __out_it = ::cuda::std::__fmt_copy(__first, __exponent, ::cuda::std::move(__out_it));
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __num_trailing_zeros, _CharT{'0'});
+  __out_it = ::cuda::std::__fmt_copy(__exponent, __last, ::cuda::std::move(__out_it));
+  return ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__after_, __specs.__fill_);
+}
+
+template <class _CharT, class _FmtCtx>
+[[nodiscard]] _CCCL_HOST_DEVICE_API typename _FmtCtx::iterator
+__fmt_format_fp_non_finite(bool __negative, bool __isnan, _FmtCtx& __ctx, __fmt_parsed_spec<_CharT> __specs)
+{
+  const bool __upper = __specs.__std_.__type_ == __fmt_spec_type::__hexfloat_upper_case
+                    || __specs.__std_.__type_ == __fmt_spec_type::__scientific_upper_case
+                    || __specs.__std_.__type_ == __fmt_spec_type::__fixed_upper_case
+                    || __specs.__std_.__type_ == __fmt_spec_type::__general_upper_case;
+  const char* __str = __isnan ? (__upper ? "NAN" : "nan") : (__upper ? "INF" : "inf");
+
+  char __buffer[4];
+  char* __last = ::cuda::std::__fmt_insert_sign(__buffer, __negative, __fmt_spec_sign{__specs.__std_.__sign_});
+  for (int __i = 0; __i < 3; ++__i)
+  {
+    *__last++ = __str[__i];
+  }
+
+  // [format.string.std]/13
+  // A zero (0) character preceding the width field pads the field with leading zeros (following any indication of
+  // sign or base) to the field width, except when applied to an infinity or NaN.
+  if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+  {
+    __specs.__alignment_ = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+  }
+  return ::cuda::std::__fmt_write(__buffer, __last, __ctx.out(), __specs);
+}
+
+template <class _Tp, class _CharT, class _FmtCtx>
+[[nodiscard]] _CCCL_HOST_DEVICE_API typename _FmtCtx::iterator
+__fmt_format_fp(_Tp __value, _FmtCtx& __ctx, __fmt_parsed_spec<_CharT> __specs)
+{
+  static_assert(__fp_charconv_is_supported_v<_Tp>);
+
+  const auto __d = ::cuda::std::__fp_charconv_decompose(__value);
+  if (__d.__inf_ || __d.__nan_)
+  {
+    return ::cuda::std::__fmt_format_fp_non_finite(__d.__negative_, __d.__nan_, __ctx, __specs);
+  }
+
+  char __buffer[__fmt_fp_buffer_size_v<_Tp>];
+  char* __first = ::cuda::std::__fmt_insert_sign(__buffer, __d.__negative_, __fmt_spec_sign{__specs.__std_.__sign_});
+  char* const __end = __buffer + __fmt_fp_buffer_size_v<_Tp>;
+
+  // The sign has been written, so the absolute value is converted. The end of the buffer is kept free for a decimal
+  // point inserted by the alternate form.
+  const _Tp __abs     = __d.__negative_ ? -__value : __value;
+  const int __max     = __fmt_fp_max_fractional_v<_Tp>;
+  const int __prec    = ::cuda::std::min(__specs.__precision_, __max);
+  size_t __num_zeros  = 0;
+  char __exponent_chr = 'e';
+  bool __general      = false;
+
+  to_chars_result __r{};
+  switch (__specs.__std_.__type_)
+  {
+    case __fmt_spec_type::__default:
+      if (__specs.__has_precision())
+      {
+        __general = true;
+        __r       = ::cuda::std::to_chars(__first, __end - 1, __abs, chars_format::general, __prec);
+      }
+      else
+      {
+        __r = ::cuda::std::to_chars(__first, __end - 1, __abs);
+      }
+      break;
+    case __fmt_spec_type::__hexfloat_lower_case:
+    case __fmt_spec_type::__hexfloat_upper_case:
+      __exponent_chr = 'p';
+      if (__specs.__has_precision())
+      {
+        __num_zeros = static_cast<size_t>(__specs.__precision_ - __prec);
+        __r         = ::cuda::std::to_chars(__first, __end - 1, __abs, chars_format::hex, __prec);
+      }
+      else
+      {
+        __r = ::cuda::std::to_chars(__first, __end - 1, __abs, chars_format::hex);
+      }
+      break;
+    case __fmt_spec_type::__scientific_lower_case:
+    case __fmt_spec_type::__scientific_upper_case:
+      __num_zeros = static_cast<size_t>(__specs.__precision_ - __prec);
+      __r         = ::cuda::std::to_chars(__first, __end - 1, __abs, chars_format::scientific, __prec);
+      break;
+    case __fmt_spec_type::__fixed_lower_case:
+    case __fmt_spec_type::__fixed_upper_case:
+      __num_zeros = static_cast<size_t>(__specs.__precision_ - __prec);
+      __r         = ::cuda::std::to_chars(__first, __end - 1, __abs, chars_format::fixed, __prec);
+      break;
+    case __fmt_spec_type::__general_lower_case:
+    case __fmt_spec_type::__general_upper_case:
+      __general = true;
+      __r       = ::cuda::std::to_chars(__first, __end - 1, __abs, chars_format::general, __prec);
+      break;
+    default:
+      _CCCL_UNREACHABLE();
+  }
+  _CCCL_ASSERT(__r.ec == errc(0), "Internal buffer too small");
+
+  char* __last     = __r.ptr;
+  char* __exponent = ::cuda::std::find(__first, __last, __exponent_chr);
+
+  if (__specs.__std_.__alternate_form_)
+  {
+    // The alternate form always has a decimal point
+    if (::cuda::std::find(__first, __exponent, '.') == __exponent)
+    {
+      ::cuda::std::copy_backward(__exponent, __last, __last + 1);
+      *__exponent++ = '.';
+      ++__last;
+    }
+
+    // and the general format keeps its trailing zeros, so that it has as many significant digits as the precision
+    if (__general)
+    {
+      const int __precision = (__specs.__precision_ == 0) ? 1 : __specs.__precision_;
+
+      int __digits        = 0;
+      bool __significant  = false;
+      const char* __digit = __first;
+      for (; __digit != __exponent; ++__digit)
+      {
+        __significant |= (*__digit != '0' && *__digit != '.');
+        __digits += (__significant && *__digit != '.');
+      }
+      // zero has a single significant digit
+      __digits    = ::cuda::std::max(__digits, 1);
+      __num_zeros = (__precision > __digits) ? static_cast<size_t>(__precision - __digits) : 0;
+    }
+  }
+
+  if (__specs.__std_.__type_ == __fmt_spec_type::__hexfloat_upper_case
+      || __specs.__std_.__type_ == __fmt_spec_type::__scientific_upper_case
+      || __specs.__std_.__type_ == __fmt_spec_type::__general_upper_case)
+  {
+    for (char* __it = __first; __it != __last; ++__it)
+    {
+      *__it = ::cuda::std::__fmt_hex_to_upper(*__it);
+    }
+    if (__exponent != __last)
+    {
+      *__exponent = (__exponent_chr == 'p') ? 'P' : 'E';
+    }
+  }
+
+  auto __out_it = __ctx.out();
+  if (__fmt_spec_alignment{__specs.__alignment_} != __fmt_spec_alignment::__zero_padding)
+  {
+    __first = __buffer;
+  }
+  else
+  {
+    // __buffer contains [sign]data
+    //                         ^ location of __first
+    // The zero padding is done like:
+    // - Write [sign]
+    // - Write data right aligned with '0' as fill character.
+    __out_it                  = ::cuda::std::__fmt_copy(__buffer, __first, ::cuda::std::move(__out_it));
+    __specs.__alignment_      = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+    __specs.__fill_.__data[0] = _CharT{'0'};
+    __specs.__width_ -= ::cuda::std::min(static_cast<uint32_t>(__first - __buffer), __specs.__width_);
+  }
+
+  if (__num_zeros == 0)
+  {
+    return ::cuda::std::__fmt_write(__first, __last, ::cuda::std::move(__out_it), __specs);
+  }
+  return ::cuda::std::__fmt_write_using_trailing_zeros(
+    __first, __last, ::cuda::std::move(__out_it), __specs, __exponent, __num_zeros);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
@@ -20,8 +20,11 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__charconv/floating_point_decimal.h>
+#include <cuda/std/__format/format_floating_point.h>
 #include <cuda/std/__format/format_spec_parser.h>
 #include <cuda/std/__format/formatter.h>
+#include <cuda/std/__type_traits/conditional.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -59,9 +62,11 @@ struct __fmt_formatter_fp
   template <class _Tp, class _FmtCtx>
   _CCCL_HOST_DEVICE_API typename _FmtCtx::iterator format(_Tp __value, _FmtCtx& __ctx) const
   {
-    _CCCL_ASSERT(false, "formatter</*floating-point-type*/>::format() is not implemented");
-    (void) __value;
-    return __ctx.out();
+    const auto __specs = __parser_.__get_parsed_std_spec(__ctx);
+
+    // The long double formats that are not binary64 are formatted as double, as to_chars doesn't support them
+    using _Up = conditional_t<__fp_charconv_is_supported_v<_Tp>, _Tp, double>;
+    return ::cuda::std::__fmt_format_fp(static_cast<_Up>(__value), __ctx, __specs);
   }
 
 private:
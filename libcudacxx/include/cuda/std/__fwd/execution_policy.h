@@ -56,6 +56,9 @@ enum __execution_backend : uint8_t
 #if _CCCL_HAS_BACKEND_TBB()
   __tbb = 1 << 2,
 #endif // _CCCL_HAS_BACKEND_TBB()
+#if _CCCL_HAS_BACKEND_HOST()
+  __host = 1 << 3,
+#endif // _CCCL_HAS_BACKEND_HOST()
 };
 
 //! @brief Extracts the execution backend from the stored _Policy
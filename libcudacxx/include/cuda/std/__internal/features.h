@@ -106,6 +106,29 @@
 
 #define _CCCL_HAS_SIMD_F32X2() (_CCCL_HAS_SIMD_F32X2_INTRINSICS() || _CCCL_HAS_SIMD_F32X2_PTX())
 
+// Size in bytes of the vector registers of the host ISA, which determines the width of the native simd ABI. nvcc
+// preprocesses host and device code with the host compiler, so the width is the same in both compilation passes.
+// clang-cuda does not guarantee that, so we keep the scalar native ABI there.
+#if _CCCL_COMPILER(NVRTC) || _CCCL_CUDA_COMPILER(CLANG) || defined(CCCL_DISABLE_SIMD_HOST_VECTOR)
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 0
+#elif defined(__AVX512F__)
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 64
+#elif defined(__AVX2__)
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 32
+#elif defined(__SSE2__) || defined(__ARM_NEON) || _CCCL_ARCH(X86_64) || _CCCL_ARCH(ARM64)
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 16
+#else // ^^^ 128-bit vector ISA ^^^ / vvv no known vector ISA vvv
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 0
+#endif // ^^^ no known vector ISA ^^^
+
+// The host operations of cuda::std::simd are implemented with the generic vector extensions of GCC and clang, which
+// lower to SSE, AVX2, AVX-512 or NEON instructions depending on the target
+#if _CCCL_SIMD_HOST_VECTOR_BYTES() != 0 && (_CCCL_COMPILER(GCC) || _CCCL_COMPILER(CLANG))
+#  define _CCCL_HAS_SIMD_HOST_VECTOR() 1
+#else // ^^^ has host vector extensions ^^^ / vvv no host vector extensions vvv
+#  define _CCCL_HAS_SIMD_HOST_VECTOR() 0
+#endif // ^^^ no host vector extensions ^^^
+
 // Third party libraries
 
 #if (__has_include(<dlpack/dlpack.h>) || __has_include(<dlpack.h>)) && \
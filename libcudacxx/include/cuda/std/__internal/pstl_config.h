@@ -26,8 +26,10 @@
 #define _CCCL_HAS_BACKEND_CUDA() _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
 #define _CCCL_HAS_BACKEND_OMP()  0
 #define _CCCL_HAS_BACKEND_TBB()  0
+#define _CCCL_HAS_BACKEND_HOST() _CCCL_HOSTED()
 
-#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+#define _CCCL_HAS_PSTL_BACKEND() \
+  (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB() || _CCCL_HAS_BACKEND_HOST())
 
 #include <cuda/std/__cccl/epilogue.h>
 
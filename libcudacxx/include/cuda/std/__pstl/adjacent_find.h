@@ -31,8 +31,8 @@
 #  include <cuda/std/__execution/policy.h>
 #  include <cuda/std/__functional/operations.h>
 #  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
 #  include <cuda/std/__iterator/next.h>
-#  include <cuda/std/__iterator/prev.h>
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -41,6 +41,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -66,11 +69,18 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND is_execution_po
       return __first;
     }
 
-    auto __zipped_ret = __dispatch(
-      __policy,
-      ::cuda::zip_iterator{__first, ::cuda::std::next(__first)},
-      ::cuda::zip_iterator{::cuda::std::prev(__last), __last},
-      ::cuda::zip_function{::cuda::std::move(__pred)});
+    // The end of the pairs is computed from the count, as __last cannot be decremented if it is a forward iterator
+    const auto __count       = ::cuda::std::distance(__first, __last);
+    auto __zipped_first      = ::cuda::zip_iterator{__first, ::cuda::std::next(__first)};
+    const auto __zipped_last = ::cuda::std::next(__zipped_first, __count - 1);
+    auto __zipped_ret        = __dispatch(
+      __policy, ::cuda::std::move(__zipped_first), __zipped_last, ::cuda::zip_function{::cuda::std::move(__pred)});
+
+    // If no adjacent pair matches we must return __last rather than the first iterator of the end of the zipped range
+    if (__zipped_ret == __zipped_last)
+    {
+      return __last;
+    }
     return ::cuda::std::get<0>(__zipped_ret.__iterators());
   }
   else
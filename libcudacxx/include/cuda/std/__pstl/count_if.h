@@ -43,6 +43,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/reduce.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/reduce.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
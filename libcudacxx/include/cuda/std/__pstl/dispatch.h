@@ -95,6 +95,13 @@ template <__pstl_algorithm _Algorithm, class _Policy>
   {
     return __pstl_dispatch<_Algorithm, __backend>{};
   }
+#if _CCCL_HAS_BACKEND_HOST()
+  // Policies that do not request any backend, e.g. the standard policies, run on the host threads
+  else if constexpr (__backend == __execution_backend::__none)
+  {
+    return __pstl_dispatch<_Algorithm, __execution_backend::__host>{};
+  }
+#endif // _CCCL_HAS_BACKEND_HOST()
   else
   {
     // No dispatch found, return invalid to signal serial execution
@@ -39,6 +39,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/generate_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/generate_n.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -53,7 +56,7 @@ struct __fill_constant_value
       : __val_(__val)
   {}
 
-  [[nodiscard]] _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr const _Tp& operator()() const noexcept
+  [[nodiscard]] _CCCL_API _CCCL_FORCEINLINE constexpr const _Tp& operator()() const noexcept
   {
     return __val_;
   }
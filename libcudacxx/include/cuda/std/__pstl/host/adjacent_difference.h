@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
+#define _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__numeric/adjacent_difference.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&, _InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      // The parallel overloads require that input and output do not overlap, so every element is independent
+      const auto __count = ::cuda::std::distance(__first, __last);
+      __result[0]        = __first[0];
+      __host_parallel_for_range<_Policy>(__count - 1, [&](auto __begin, const auto __end) {
+        for (; __begin != __end; ++__begin)
+        {
+          __result[__begin + 1] = __func(__first[__begin + 1], __first[__begin]);
+        }
+      });
+      return __result + __count;
+    }
+    else
+    {
+      return ::cuda::std::adjacent_difference(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), ::cuda::std::move(__func));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
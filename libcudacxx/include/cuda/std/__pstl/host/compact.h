@@ -0,0 +1,183 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_COMPACT_H
+#define _CUDA_STD___PSTL_HOST_COMPACT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/readable_traits.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Stable stream compaction. Calls __write(__i, __pos) for every __i in [0, __count) for which __select(__i)
+//! holds, where __pos is the number of selected indices in front of __i. __select is called exactly once per index.
+//! Returns the number of selected indices.
+template <class _Policy, class _Size, class _Select, class _Write>
+[[nodiscard]] _CCCL_HOST_API _Size __host_copy_selected(const _Size __count, _Select __select, _Write __write)
+{
+  const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+  if (__num_parts == 1)
+  {
+    _Size __pos = 0;
+    for (_Size __i = 0; __i < __count; ++__i)
+    {
+      if (__select(__i))
+      {
+        __write(__i, __pos++);
+      }
+    }
+    return __pos;
+  }
+
+  // First count the selected indices of every partition, then write them to their final position
+  __host_temporary_buffer<bool> __flags{static_cast<size_t>(__count)};
+  __host_temporary_buffer<_Size> __offsets{__num_parts};
+  __host_parallel_for(__num_parts, [&](const size_t __part) {
+    const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+    const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+    _Size __selected    = 0;
+    for (_Size __i = __begin; __i < __end; ++__i)
+    {
+      const bool __flag = static_cast<bool>(__select(__i));
+      __flags.__construct(static_cast<size_t>(__i), __flag);
+      __selected += __flag;
+    }
+    __offsets.__construct(__part, __selected);
+  });
+
+  _Size __total = 0;
+  for (size_t __part = 0; __part < __num_parts; ++__part)
+  {
+    const _Size __selected = __offsets[__part];
+    __offsets[__part]      = __total;
+    __total += __selected;
+  }
+
+  __host_parallel_for(__num_parts, [&](const size_t __part) {
+    const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+    const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+    _Size __pos         = __offsets[__part];
+    for (_Size __i = __begin; __i < __end; ++__i)
+    {
+      if (__flags[static_cast<size_t>(__i)])
+      {
+        __write(__i, __pos++);
+      }
+    }
+  });
+  return __total;
+}
+
+//! @brief A contiguous run of elements that needs to be moved from offset __src_ to offset __dst_
+template <class _Size>
+struct __host_segment
+{
+  _Size __src_;
+  _Size __dst_;
+  _Size __size_;
+};
+
+//! @brief Moves every segment within the range starting at __first to its destination. The destinations must not
+//! overlap each other but may overlap the sources, so the elements are staged in a temporary buffer.
+template <class _Iter, class _Size>
+_CCCL_HOST_API void
+__host_relocate_segments(_Iter __first, const __host_segment<_Size>* __segments, const size_t __num_segments)
+{
+  _Size __buffer_size = 0;
+  for (size_t __seg = 0; __seg < __num_segments; ++__seg)
+  {
+    if (__segments[__seg].__src_ != __segments[__seg].__dst_)
+    {
+      __buffer_size = ::cuda::std::max(__buffer_size, __segments[__seg].__dst_ + __segments[__seg].__size_);
+    }
+  }
+  if (__buffer_size == 0)
+  {
+    return;
+  }
+
+  using _Tp = iter_value_t<_Iter>;
+  __host_temporary_buffer<_Tp> __buffer{static_cast<size_t>(__buffer_size)};
+  __host_parallel_for(__num_segments, [&](const size_t __seg) {
+    const auto& __segment = __segments[__seg];
+    if (__segment.__src_ != __segment.__dst_)
+    {
+      for (_Size __i = 0; __i < __segment.__size_; ++__i)
+      {
+        __buffer.__construct(static_cast<size_t>(__segment.__dst_ + __i), ::cuda::std::move(__first[__segment.__src_ + __i]));
+      }
+    }
+  });
+  __host_parallel_for(__num_segments, [&](const size_t __seg) {
+    const auto& __segment = __segments[__seg];
+    if (__segment.__src_ != __segment.__dst_)
+    {
+      for (_Size __i = 0; __i < __segment.__size_; ++__i)
+      {
+        const size_t __pos = static_cast<size_t>(__segment.__dst_ + __i);
+        __first[__segment.__dst_ + __i] = ::cuda::std::move(__buffer[__pos]);
+        __buffer[__pos].~_Tp();
+      }
+    }
+  });
+}
+
+//! @brief Moves __first[__src(__i)] to __first[__dst + __i] for every __i in [0, __count). The elements are staged in a
+//! temporary buffer, so sources and destinations may overlap arbitrarily.
+template <class _Policy, class _Iter, class _Size, class _Src>
+_CCCL_HOST_API void __host_move_through_buffer(_Iter __first, const _Size __dst, const _Size __count, _Src __src)
+{
+  using _Tp = iter_value_t<_Iter>;
+  __host_temporary_buffer<_Tp> __buffer{static_cast<size_t>(__count)};
+  __host_parallel_for_range<_Policy>(__count, [&](_Size __begin, const _Size __end) {
+    for (; __begin != __end; ++__begin)
+    {
+      __buffer.__construct(static_cast<size_t>(__begin), ::cuda::std::move(__first[__src(__begin)]));
+    }
+  });
+  __host_parallel_for_range<_Policy>(__count, [&](_Size __begin, const _Size __end) {
+    for (; __begin != __end; ++__begin)
+    {
+      __first[__dst + __begin] = ::cuda::std::move(__buffer[static_cast<size_t>(__begin)]);
+      __buffer[static_cast<size_t>(__begin)].~_Tp();
+    }
+  });
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_COMPACT_H
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_COPY_IF_H
+#define _CUDA_STD___PSTL_HOST_COPY_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/copy_if.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/incrementable_traits.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/compact.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__copy_if, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&,
+    _InputIterator __first,
+    iter_difference_t<_InputIterator> __count,
+    _OutputIterator __result,
+    _UnaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Size           = iter_difference_t<_InputIterator>;
+      const _Size __written = ::cuda::std::execution::__host_copy_selected<_Policy>(
+        __count,
+        [&](const _Size __i) {
+          return __pred(__first[__i]);
+        },
+        [&](const _Size __i, const _Size __pos) {
+          __result[__pos] = __first[__i];
+        });
+      return __result + __written;
+    }
+    else
+    {
+      auto __last = ::cuda::std::next(__first, __count);
+      return ::cuda::std::copy_if(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_COPY_IF_H
@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
+#define _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/addressof.h>
+#  include <cuda/std/__numeric/exclusive_scan.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/inclusive_scan.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__exclusive_scan, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _Tp __init,
+    _BinaryOp __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count       = ::cuda::std::distance(__first, __last);
+      const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+      if (__num_parts == 1)
+      {
+        return ::cuda::std::exclusive_scan(
+          ::cuda::std::move(__first),
+          ::cuda::std::move(__last),
+          ::cuda::std::move(__result),
+          ::cuda::std::move(__init),
+          ::cuda::std::move(__func));
+      }
+
+      __host_temporary_buffer<_Tp> __carries{__num_parts};
+      ::cuda::std::execution::__host_scan_carries(
+        __first, __count, __func, ::cuda::std::addressof(__init), __carries, __num_parts);
+
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const auto __begin = __host_partition_begin(__count, __part, __num_parts);
+        const auto __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        ::cuda::std::exclusive_scan(
+          __first + __begin, __first + __end, __result + __begin, ::cuda::std::move(__carries[__part]), __func);
+      });
+
+      __carries.__destroy(0, __num_parts);
+      return __result + __count;
+    }
+    else
+    {
+      return ::cuda::std::exclusive_scan(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__func));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_FIND_IF_H
+#define _CUDA_STD___PSTL_HOST_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <atomic>
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__host>
+{
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter operator()(const _Policy&, _Iter __first, _Iter __last, _UnaryOp __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      using _Size        = iter_difference_t<_Iter>;
+      const auto __count = ::cuda::std::distance(__first, __last);
+
+      // Subranges are claimed in increasing order, so once a match has been found every subrange behind it can stop.
+      // The position is tracked as int64_t because difference types of fancy iterators may be wider than a lock free
+      // atomic
+      ::std::atomic<int64_t> __found{static_cast<int64_t>(__count)};
+      __host_parallel_for_range<_Policy>(__count, [&](_Size __begin, const _Size __end) {
+        for (; __begin != __end; ++__begin)
+        {
+          if (__found.load(::std::memory_order_relaxed) < static_cast<int64_t>(__begin))
+          {
+            return;
+          }
+          if (__pred(__first[__begin]))
+          {
+            const auto __pos    = static_cast<int64_t>(__begin);
+            int64_t __expected = __found.load(::std::memory_order_relaxed);
+            while (__pos < __expected && !__found.compare_exchange_weak(__expected, __pos, ::std::memory_order_relaxed))
+            {
+            }
+            return;
+          }
+        }
+      });
+      return __first + static_cast<_Size>(__found.load(::std::memory_order_relaxed));
+    }
+    else
+    {
+      return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_FIND_IF_H
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_GENERATE_N_H
+#define _CUDA_STD___PSTL_HOST_GENERATE_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/generate_n.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/incrementable_traits.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/convert_to_integral.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__generate_n, __execution_backend::__host>
+{
+  template <class _Policy, class _OutputIterator, class _Size, class _Generator>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator
+  operator()(const _Policy&, _OutputIterator __result, _Size __orig_n, _Generator __gen) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count =
+        static_cast<iter_difference_t<_OutputIterator>>(::cuda::std::__convert_to_integral(__orig_n));
+      __host_parallel_for_range<_Policy>(__count, [&](auto __begin, const auto __end) {
+        for (; __begin != __end; ++__begin)
+        {
+          __result[__begin] = __gen();
+        }
+      });
+      return __result + __count;
+    }
+    else
+    {
+      return ::cuda::std::generate_n(::cuda::std::move(__result), __orig_n, ::cuda::std::move(__gen));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_GENERATE_N_H
@@ -0,0 +1,173 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_INCLUSIVE_SCAN_H
+#define _CUDA_STD___PSTL_HOST_INCLUSIVE_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/readable_traits.h>
+#  include <cuda/std/__memory/addressof.h>
+#  include <cuda/std/__numeric/inclusive_scan.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief First pass of a partitioned scan, stores the reduction of all elements in front of partition __part into
+//! __carries[__part]. If __init is null the carry into the first partition is left unconstructed.
+template <class _Tp, class _Iter, class _Size, class _BinaryOp>
+_CCCL_HOST_API void __host_scan_carries(
+  _Iter __first,
+  const _Size __count,
+  _BinaryOp& __func,
+  const _Tp* __init,
+  __host_temporary_buffer<_Tp>& __carries,
+  const size_t __num_parts)
+{
+  // Every partition holds at least two elements, so the partial results do not need an identity to start from
+  __host_parallel_for(__num_parts - 1, [&](const size_t __part) {
+    const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+    const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+    _Tp& __partial      = __carries.__construct(__part + 1, __func(__first[__begin], __first[__begin + 1]));
+    for (_Size __i = __begin + 2; __i < __end; ++__i)
+    {
+      __partial = __func(::cuda::std::move(__partial), __first[__i]);
+    }
+  });
+
+  size_t __part = 2;
+  if (__init != nullptr)
+  {
+    __carries.__construct(0, *__init);
+    __part = 1;
+  }
+  for (; __part < __num_parts; ++__part)
+  {
+    __carries[__part] = __func(__carries[__part - 1], ::cuda::std::move(__carries[__part]));
+  }
+}
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__inclusive_scan, __execution_backend::__host>
+{
+  template <class _Policy, class _Tp, class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _OutputIterator __par_impl(
+    _InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp& __func, const _Tp* __init)
+  {
+    const auto __count       = ::cuda::std::distance(__first, __last);
+    const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+    if (__num_parts == 1)
+    {
+      return __init == nullptr
+             ? ::cuda::std::inclusive_scan(__first, __last, __result, __func)
+             : ::cuda::std::inclusive_scan(__first, __last, __result, __func, *__init);
+    }
+
+    __host_temporary_buffer<_Tp> __carries{__num_parts};
+    ::cuda::std::execution::__host_scan_carries(__first, __count, __func, __init, __carries, __num_parts);
+
+    __host_parallel_for(__num_parts, [&](const size_t __part) {
+      const auto __begin = __host_partition_begin(__count, __part, __num_parts);
+      const auto __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+      if (__part == 0 && __init == nullptr)
+      {
+        ::cuda::std::inclusive_scan(__first + __begin, __first + __end, __result + __begin, __func);
+      }
+      else
+      {
+        ::cuda::std::inclusive_scan(__first + __begin, __first + __end, __result + __begin, __func, __carries[__part]);
+      }
+    });
+
+    __carries.__destroy(__init == nullptr ? 1 : 0, __num_parts);
+    return __result + __count;
+  }
+
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp, class _Tp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryOp __func,
+    _Tp __init) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      return __par_impl<_Policy>(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        __func,
+        ::cuda::std::addressof(__init));
+    }
+    else
+    {
+      return ::cuda::std::inclusive_scan(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__func),
+        ::cuda::std::move(__init));
+    }
+  }
+
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&, _InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      return __par_impl<_Policy>(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        __func,
+        static_cast<const iter_value_t<_InputIterator>*>(nullptr));
+    }
+    else
+    {
+      return ::cuda::std::inclusive_scan(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), ::cuda::std::move(__func));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_INCLUSIVE_SCAN_H
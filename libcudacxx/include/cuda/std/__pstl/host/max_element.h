@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_MAX_ELEMENT_H
+#define _CUDA_STD___PSTL_HOST_MAX_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/max_element.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__max_element, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _BinaryPred>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator
+  operator()(const _Policy&, _InputIterator __first, _InputIterator __last, _BinaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Size              = iter_difference_t<_InputIterator>;
+      const auto __count       = ::cuda::std::distance(__first, __last);
+      const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+      if (__num_parts == 1)
+      {
+        return ::cuda::std::max_element(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+      }
+
+      // Partitions are combined in order and only replace the current maximum if they are strictly larger, which
+      // keeps the first maximal element
+      __host_temporary_buffer<_Size> __maxima{__num_parts};
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        __maxima[__part]    = ::cuda::std::max_element(__first + __begin, __first + __end, __pred) - __first;
+      });
+
+      _Size __result = __maxima[0];
+      for (size_t __part = 1; __part < __num_parts; ++__part)
+      {
+        if (__pred(__first[__result], __first[__maxima[__part]]))
+        {
+          __result = __maxima[__part];
+        }
+      }
+      return __first + __result;
+    }
+    else
+    {
+      return ::cuda::std::max_element(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_MAX_ELEMENT_H
@@ -0,0 +1,191 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_MERGE_H
+#define _CUDA_STD___PSTL_HOST_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Returns the number of elements of [__a, __a + __a_size) among the first __diag elements of the stable merge
+//! of [__a, __a + __a_size) and [__b, __b + __b_size). Equivalent elements are taken from __a first.
+template <class _Iter1, class _Iter2, class _Size, class _Comp>
+[[nodiscard]] _CCCL_HOST_API _Size
+__host_merge_path(_Iter1 __a, const _Size __a_size, _Iter2 __b, const _Size __b_size, const _Size __diag, _Comp& __comp)
+{
+  _Size __lo = ::cuda::std::max(_Size{0}, __diag - __b_size);
+  _Size __hi = ::cuda::std::min(__diag, __a_size);
+  while (__lo < __hi)
+  {
+    const _Size __mid = __lo + (__hi - __lo) / 2;
+    if (__comp(__b[__diag - 1 - __mid], __a[__mid]))
+    {
+      __hi = __mid;
+    }
+    else
+    {
+      __lo = __mid + 1;
+    }
+  }
+  return __lo;
+}
+
+//! @brief Sequential stable merge of [__first1, __last1) and [__first2, __last2) into __result. The elements are moved
+//! instead of copied if _Move is true.
+template <bool _Move, class _Iter1, class _Iter2, class _OutputIterator, class _Comp>
+_CCCL_HOST_API _OutputIterator __host_merge_sequential(
+  _Iter1 __first1, const _Iter1 __last1, _Iter2 __first2, const _Iter2 __last2, _OutputIterator __result, _Comp& __comp)
+{
+  const auto __transfer = [](auto&& __value) -> decltype(auto) {
+    if constexpr (_Move)
+    {
+      return ::cuda::std::move(__value);
+    }
+    else
+    {
+      return __value;
+    }
+  };
+  for (; __first1 != __last1 && __first2 != __last2; ++__result)
+  {
+    if (__comp(*__first2, *__first1))
+    {
+      *__result = __transfer(*__first2);
+      ++__first2;
+    }
+    else
+    {
+      *__result = __transfer(*__first1);
+      ++__first1;
+    }
+  }
+  for (; __first1 != __last1; ++__first1, (void) ++__result)
+  {
+    *__result = __transfer(*__first1);
+  }
+  for (; __first2 != __last2; ++__first2, (void) ++__result)
+  {
+    *__result = __transfer(*__first2);
+  }
+  return __result;
+}
+
+//! @brief Merges [__first1, __first1 + __size1) and [__first2, __first2 + __size2) into __result. The output is split
+//! into __num_parts equally sized partitions which find their inputs through merge path, so the work is balanced no
+//! matter how the elements are distributed between the inputs.
+template <bool _Move, class _Iter1, class _Iter2, class _OutputIterator, class _Size, class _Comp>
+_CCCL_HOST_API void __host_merge(
+  _Iter1 __first1,
+  const _Size __size1,
+  _Iter2 __first2,
+  const _Size __size2,
+  _OutputIterator __result,
+  _Comp& __comp,
+  const size_t __num_parts)
+{
+  const _Size __count = __size1 + __size2;
+
+  // All splits must be known before any partition starts merging, because the binary search of one partition may look
+  // at elements that a neighboring partition moves from
+  __host_temporary_buffer<_Size> __splits{__num_parts + 1};
+  __host_parallel_for(__num_parts + 1, [&](const size_t __part) {
+    __splits.__construct(
+      __part,
+      ::cuda::std::execution::__host_merge_path(
+        __first1, __size1, __first2, __size2, __host_partition_begin(__count, __part, __num_parts), __comp));
+  });
+
+  __host_parallel_for(__num_parts, [&](const size_t __part) {
+    const _Size __diag_begin = __host_partition_begin(__count, __part, __num_parts);
+    const _Size __diag_end   = __host_partition_begin(__count, __part + 1, __num_parts);
+    const _Size __a_begin    = __splits[__part];
+    const _Size __a_end      = __splits[__part + 1];
+    ::cuda::std::execution::__host_merge_sequential<_Move>(
+      __first1 + __a_begin,
+      __first1 + __a_end,
+      __first2 + (__diag_begin - __a_begin),
+      __first2 + (__diag_end - __a_end),
+      __result + __diag_begin,
+      __comp);
+  });
+}
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Comp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _InputIterator2 __last2,
+    _OutputIterator __result,
+    _Comp __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Size              = iter_difference_t<_InputIterator1>;
+      const _Size __size1      = ::cuda::std::distance(__first1, __last1);
+      const _Size __size2      = static_cast<_Size>(::cuda::std::distance(__first2, __last2));
+      const size_t __num_parts = __host_num_partitions<_Policy>(__size1 + __size2);
+      ::cuda::std::execution::__host_merge<false>(__first1, __size1, __first2, __size2, __result, __comp, __num_parts);
+      return __result + (__size1 + __size2);
+    }
+    else
+    {
+      return ::cuda::std::merge(
+        ::cuda::std::move(__first1),
+        ::cuda::std::move(__last1),
+        ::cuda::std::move(__first2),
+        ::cuda::std::move(__last2),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__comp));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_MERGE_H
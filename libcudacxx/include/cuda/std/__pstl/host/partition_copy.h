@@ -0,0 +1,135 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
+#define _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/partition_copy.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/__utility/pair.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partition_copy, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator1, class _OutputIterator2, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API pair<_OutputIterator1, _OutputIterator2> operator()(
+    const _Policy&,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator1 __result_true,
+    _OutputIterator2 __result_false,
+    _UnaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator2>)
+    {
+      using _Size              = iter_difference_t<_InputIterator>;
+      const auto __count       = ::cuda::std::distance(__first, __last);
+      const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+      if (__num_parts == 1)
+      {
+        return ::cuda::std::partition_copy(
+          ::cuda::std::move(__first),
+          ::cuda::std::move(__last),
+          ::cuda::std::move(__result_true),
+          ::cuda::std::move(__result_false),
+          ::cuda::std::move(__pred));
+      }
+
+      // Every element of a partition that does not go to __result_true goes to __result_false, so the number of
+      // selected elements in front of a partition determines both of its output positions
+      __host_temporary_buffer<bool> __flags{static_cast<size_t>(__count)};
+      __host_temporary_buffer<_Size> __offsets{__num_parts};
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        _Size __selected    = 0;
+        for (_Size __i = __begin; __i < __end; ++__i)
+        {
+          const bool __flag = static_cast<bool>(__pred(__first[__i]));
+          __flags.__construct(static_cast<size_t>(__i), __flag);
+          __selected += __flag;
+        }
+        __offsets.__construct(__part, __selected);
+      });
+
+      _Size __num_true = 0;
+      for (size_t __part = 0; __part < __num_parts; ++__part)
+      {
+        const _Size __selected = __offsets[__part];
+        __offsets[__part]      = __num_true;
+        __num_true += __selected;
+      }
+
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        _Size __pos_true    = __offsets[__part];
+        _Size __pos_false   = __begin - __pos_true;
+        for (_Size __i = __begin; __i < __end; ++__i)
+        {
+          if (__flags[static_cast<size_t>(__i)])
+          {
+            __result_true[__pos_true++] = __first[__i];
+          }
+          else
+          {
+            __result_false[__pos_false++] = __first[__i];
+          }
+        }
+      });
+      return {__result_true + __num_true, __result_false + (__count - __num_true)};
+    }
+    else
+    {
+      return ::cuda::std::partition_copy(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result_true),
+        ::cuda::std::move(__result_false),
+        ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
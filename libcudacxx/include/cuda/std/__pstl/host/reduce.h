@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_REDUCE_H
+#define _CUDA_STD___PSTL_HOST_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__numeric/reduce.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Reduces __load(__i) for every __i in [0, __count) into __init. Every partition folds its elements
+//! sequentially and the partial results are combined in order by the calling thread.
+template <class _Policy, class _Size, class _Tp, class _BinaryOp, class _Load>
+[[nodiscard]] _CCCL_HOST_API _Tp __host_reduce(const _Size __count, _Tp __init, _BinaryOp& __func, _Load __load)
+{
+  const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+  if (__num_parts == 1)
+  {
+    for (_Size __i = 0; __i < __count; ++__i)
+    {
+      __init = __func(::cuda::std::move(__init), __load(__i));
+    }
+    return __init;
+  }
+
+  // Every partition holds at least two elements, so the partial results do not need an identity to start from
+  __host_temporary_buffer<_Tp> __partials{__num_parts};
+  __host_parallel_for(__num_parts, [&](const size_t __part) {
+    const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+    const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+    _Tp& __partial      = __partials.__construct(__part, __func(__load(__begin), __load(__begin + 1)));
+    for (_Size __i = __begin + 2; __i < __end; ++__i)
+    {
+      __partial = __func(::cuda::std::move(__partial), __load(__i));
+    }
+  });
+
+  for (size_t __part = 0; __part < __num_parts; ++__part)
+  {
+    __init = __func(::cuda::std::move(__init), ::cuda::std::move(__partials[__part]));
+  }
+  __partials.__destroy(0, __num_parts);
+  return __init;
+}
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__reduce, __execution_backend::__host>
+{
+  template <class _Policy, class _Iter, class _Size, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp operator()(const _Policy&, _Iter __first, _Size __count, _Tp __init, _BinaryOp __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      return ::cuda::std::execution::__host_reduce<_Policy>(
+        __count, ::cuda::std::move(__init), __func, [&](const _Size __i) -> decltype(auto) {
+          return __first[__i];
+        });
+    }
+    else
+    {
+      return ::cuda::std::reduce(
+        __first, ::cuda::std::next(__first, __count), ::cuda::std::move(__init), ::cuda::std::move(__func));
+    }
+  }
+
+  template <class _Policy, class _Iter, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp
+  operator()(const _Policy& __policy, _Iter __first, _Iter __last, _Tp __init, _BinaryOp __func) const
+  {
+    const auto __count = ::cuda::std::distance(__first, __last);
+    return (*this)(__policy, ::cuda::std::move(__first), __count, ::cuda::std::move(__init), ::cuda::std::move(__func));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_REDUCE_H
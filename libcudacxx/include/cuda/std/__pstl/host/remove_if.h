@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_REMOVE_IF_H
+#define _CUDA_STD___PSTL_HOST_REMOVE_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/remove_if.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/not_fn.h>
+#  include <cuda/std/__iterator/incrementable_traits.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/compact.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__remove_if, __execution_backend::__host>
+{
+  //! @note __pred selects the elements to keep
+  template <class _Policy, class _InputIterator, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    const _Policy&, _InputIterator __first, iter_difference_t<_InputIterator> __count, _UnaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Size = iter_difference_t<_InputIterator>;
+
+      // Compact every partition in place, then move the kept elements of all partitions next to each other
+      const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+      __host_temporary_buffer<__host_segment<_Size>> __segments{__num_parts};
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        _Size __pos         = __begin;
+        for (_Size __i = __begin; __i < __end; ++__i)
+        {
+          if (__pred(__first[__i]))
+          {
+            if (__pos != __i)
+            {
+              __first[__pos] = ::cuda::std::move(__first[__i]);
+            }
+            ++__pos;
+          }
+        }
+        __segments.__construct(__part, __host_segment<_Size>{__begin, _Size{0}, __pos - __begin});
+      });
+
+      _Size __num_kept = 0;
+      for (size_t __part = 0; __part < __num_parts; ++__part)
+      {
+        __segments[__part].__dst_ = __num_kept;
+        __num_kept += __segments[__part].__size_;
+      }
+      ::cuda::std::execution::__host_relocate_segments(__first, __segments.__get(), __num_parts);
+      return __first + __num_kept;
+    }
+    else
+    {
+      auto __last = ::cuda::std::next(__first, __count);
+      return ::cuda::std::remove_if(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::not_fn(::cuda::std::move(__pred)));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_REMOVE_IF_H
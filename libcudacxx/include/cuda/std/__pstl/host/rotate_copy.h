@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_ROTATE_COPY_H
+#define _CUDA_STD___PSTL_HOST_ROTATE_COPY_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/rotate_copy.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/thread_pool.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__rotate_copy, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&, _InputIterator __first, _InputIterator __middle, _InputIterator __last, _OutputIterator __result)
+    const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Size          = iter_difference_t<_InputIterator>;
+      const auto __count   = ::cuda::std::distance(__first, __last);
+      const auto __shifted = ::cuda::std::distance(__first, __middle);
+      __host_parallel_for_range<_Policy>(__count, [&](_Size __begin, const _Size __end) {
+        for (; __begin != __end; ++__begin)
+        {
+          __result[__begin] =
+            __first[__begin < __count - __shifted ? __begin + __shifted : __begin - (__count - __shifted)];
+        }
+      });
+      return __result + __count;
+    }
+    else
+    {
+      return ::cuda::std::rotate_copy(
+        ::cuda::std::move(__first), ::cuda::std::move(__middle), ::cuda::std::move(__last), ::cuda::std::move(__result));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_ROTATE_COPY_H
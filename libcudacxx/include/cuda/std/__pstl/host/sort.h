@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SORT_H
+#define _CUDA_STD___PSTL_HOST_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/__cmath/ceil_div.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/readable_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/merge.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__host>
+{
+  //! @brief Merges neighboring pairs of the sorted runs of __src into __dst, moving the elements. Every run spans
+  //! __run_width of the initial __num_parts partitions.
+  template <class _Src, class _Dst, class _Size, class _Comp>
+  _CCCL_HOST_API static void __merge_runs(
+    _Src __src, _Dst __dst, const _Size __count, const size_t __run_width, _Comp& __comp, const size_t __num_parts)
+  {
+    const size_t __num_pairs      = ::cuda::ceil_div(__num_parts, 2 * __run_width);
+    const size_t __parts_per_pair = ::cuda::std::max(size_t{1}, __num_parts / __num_pairs);
+    __host_parallel_for(__num_pairs, [&](const size_t __pair) {
+      const auto __run_begin = [&](const size_t __run) {
+        return __host_partition_begin(__count, ::cuda::std::min(__run * __run_width, __num_parts), __num_parts);
+      };
+      const _Size __begin  = __run_begin(2 * __pair);
+      const _Size __middle = __run_begin(2 * __pair + 1);
+      const _Size __end    = __run_begin(2 * __pair + 2);
+      ::cuda::std::execution::__host_merge<true>(
+        __src + __begin,
+        __middle - __begin,
+        __src + __middle,
+        __end - __middle,
+        __dst + __begin,
+        __comp,
+        __parts_per_pair);
+    });
+  }
+
+  template <class _Policy, class _InputIterator, class _Comp>
+  _CCCL_HOST_API void operator()(const _Policy&, _InputIterator __first, _InputIterator __last, _Comp __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Size              = iter_difference_t<_InputIterator>;
+      using _Tp                = iter_value_t<_InputIterator>;
+      const _Size __count      = ::cuda::std::distance(__first, __last);
+      const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+      if (__num_parts == 1)
+      {
+        ::cuda::std::sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+        return;
+      }
+
+      // Every partition moves its elements into the buffer and sorts them there. Afterwards neighboring runs are
+      // merged back and forth between the buffer and the input until a single run remains.
+      __host_temporary_buffer<_Tp> __buffer{static_cast<size_t>(__count)};
+      _Tp* const __scratch = __buffer.__get();
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        for (_Size __i = __begin; __i < __end; ++__i)
+        {
+          __buffer.__construct(static_cast<size_t>(__i), ::cuda::std::move(__first[__i]));
+        }
+        ::cuda::std::sort(__scratch + __begin, __scratch + __end, __comp);
+      });
+
+      bool __in_buffer = true;
+      for (size_t __run_width = 1; __run_width < __num_parts; __run_width *= 2)
+      {
+        if (__in_buffer)
+        {
+          __merge_runs(__scratch, __first, __count, __run_width, __comp, __num_parts);
+        }
+        else
+        {
+          __merge_runs(__first, __scratch, __count, __run_width, __comp, __num_parts);
+        }
+        __in_buffer = !__in_buffer;
+      }
+
+      __host_parallel_for_range<_Policy>(__count, [&](_Size __begin, const _Size __end) {
+        for (; __begin != __end; ++__begin)
+        {
+          if (__in_buffer)
+          {
+            __first[__begin] = ::cuda::std::move(__scratch[__begin]);
+          }
+          __scratch[__begin].~_Tp();
+        }
+      });
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>, "Host backend of cuda::std::sort requires random access iterators");
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_SORT_H
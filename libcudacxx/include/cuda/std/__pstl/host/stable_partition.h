@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_STABLE_PARTITION_H
+#define _CUDA_STD___PSTL_HOST_STABLE_PARTITION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/stable_partition.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/compact.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Partitions every partition stably in place, then moves the selected and the rejected elements of all
+//! partitions next to each other
+template <class _Policy, class _InputIterator, class _UnaryPred>
+[[nodiscard]] _CCCL_HOST_API _InputIterator
+__host_stable_partition(_InputIterator __first, _InputIterator __last, _UnaryPred& __pred)
+{
+  using _Size              = iter_difference_t<_InputIterator>;
+  const auto __count       = ::cuda::std::distance(__first, __last);
+  const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+  if (__num_parts == 1)
+  {
+    return ::cuda::std::stable_partition(::cuda::std::move(__first), ::cuda::std::move(__last), __pred);
+  }
+
+  // Segment 2 * p holds the selected and segment 2 * p + 1 the rejected elements of partition p
+  __host_temporary_buffer<__host_segment<_Size>> __segments{2 * __num_parts};
+  __host_parallel_for(__num_parts, [&](const size_t __part) {
+    const _Size __begin    = __host_partition_begin(__count, __part, __num_parts);
+    const _Size __end      = __host_partition_begin(__count, __part + 1, __num_parts);
+    const _Size __selected = ::cuda::std::stable_partition(__first + __begin, __first + __end, __pred) - __first;
+    __segments.__construct(2 * __part, __host_segment<_Size>{__begin, _Size{0}, __selected - __begin});
+    __segments.__construct(2 * __part + 1, __host_segment<_Size>{__selected, _Size{0}, __end - __selected});
+  });
+
+  _Size __num_selected = 0;
+  for (size_t __part = 0; __part < __num_parts; ++__part)
+  {
+    __segments[2 * __part].__dst_ = __num_selected;
+    __num_selected += __segments[2 * __part].__size_;
+  }
+  _Size __num_rejected = __num_selected;
+  for (size_t __part = 0; __part < __num_parts; ++__part)
+  {
+    __segments[2 * __part + 1].__dst_ = __num_rejected;
+    __num_rejected += __segments[2 * __part + 1].__size_;
+  }
+  ::cuda::std::execution::__host_relocate_segments(__first, __segments.__get(), 2 * __num_parts);
+  return __first + __num_selected;
+}
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__stable_partition, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator
+  operator()(const _Policy&, _InputIterator __first, _InputIterator __last, _UnaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      return ::cuda::std::execution::__host_stable_partition<_Policy>(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), __pred);
+    }
+    else
+    {
+      return ::cuda::std::stable_partition(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_STABLE_PARTITION_H
@@ -0,0 +1,328 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_THREAD_POOL_H
+#define _CUDA_STD___PSTL_HOST_THREAD_POOL_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/__cmath/ceil_div.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__memory/addressof.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__utility/forward.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <atomic>
+#  include <condition_variable>
+#  include <mutex>
+#  include <new>
+#  include <thread>
+#  include <vector>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief A parallel loop over [0, __num_tasks) that is shared between the calling thread and the pool workers.
+//! Tasks are claimed in increasing order from a shared counter.
+struct __host_job
+{
+  using __run_fn_t = void(void*, size_t) noexcept;
+
+  __run_fn_t* __run_;
+  void* __fn_;
+  size_t __num_tasks_;
+  ::std::atomic<size_t> __next_{0};
+  size_t __num_users_ = 0; // guarded by the pool mutex
+
+  _CCCL_HOST_API void __work() noexcept
+  {
+    for (size_t __task = __next_.fetch_add(1, ::std::memory_order_relaxed); __task < __num_tasks_;
+         __task        = __next_.fetch_add(1, ::std::memory_order_relaxed))
+    {
+      __run_(__fn_, __task);
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool __exhausted() const noexcept
+  {
+    return __next_.load(::std::memory_order_relaxed) >= __num_tasks_;
+  }
+};
+
+//! @brief The process wide pool of worker threads used by the host backend of the parallel algorithms.
+//!
+//! The thread which starts a parallel loop always takes part in it and only waits for the workers which are still
+//! running one of its tasks, so parallel loops can be nested and started concurrently from any number of threads.
+class __host_thread_pool
+{
+  ::std::mutex __mutex_;
+  ::std::condition_variable __work_available_;
+  ::std::condition_variable __job_released_;
+  ::std::vector<__host_job*> __jobs_; // guarded by __mutex_
+  bool __stopping_ = false; // guarded by __mutex_
+  ::std::vector<::std::thread> __threads_;
+
+  _CCCL_HOST_API void __remove_job(__host_job* __job) noexcept
+  {
+    for (auto __it = __jobs_.begin(); __it != __jobs_.end(); ++__it)
+    {
+      if (*__it == __job)
+      {
+        __jobs_.erase(__it);
+        return;
+      }
+    }
+  }
+
+  _CCCL_HOST_API void __worker_loop() noexcept
+  {
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    while (true)
+    {
+      __work_available_.wait(__lock, [this] {
+        return __stopping_ || !__jobs_.empty();
+      });
+      if (__stopping_)
+      {
+        return;
+      }
+
+      __host_job* __job = __jobs_.front();
+      ++__job->__num_users_;
+      __lock.unlock();
+
+      __job->__work();
+
+      __lock.lock();
+      if (__job->__exhausted())
+      {
+        __remove_job(__job);
+      }
+      if (--__job->__num_users_ == 0)
+      {
+        __job_released_.notify_all();
+      }
+    }
+  }
+
+public:
+  _CCCL_HOST_API __host_thread_pool()
+  {
+    // The calling thread takes part in every parallel loop, so we need one worker less than there are cores
+    const unsigned __num_cores = ::std::thread::hardware_concurrency();
+    const unsigned __num_workers = __num_cores > 1 ? __num_cores - 1 : 0;
+    __threads_.reserve(__num_workers);
+    for (unsigned __i = 0; __i < __num_workers; ++__i)
+    {
+      __threads_.emplace_back([this] {
+        __worker_loop();
+      });
+    }
+  }
+
+  __host_thread_pool(const __host_thread_pool&)            = delete;
+  __host_thread_pool& operator=(const __host_thread_pool&) = delete;
+
+  _CCCL_HOST_API ~__host_thread_pool()
+  {
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __stopping_ = true;
+    }
+    __work_available_.notify_all();
+    for (auto& __worker : __threads_)
+    {
+      __worker.join();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __host_thread_pool& __get()
+  {
+    static __host_thread_pool __pool;
+    return __pool;
+  }
+
+  //! @brief The number of threads which take part in a parallel loop, including the calling thread
+  [[nodiscard]] _CCCL_HOST_API size_t __num_threads() const noexcept
+  {
+    return __threads_.size() + 1;
+  }
+
+  //! @brief Calls __fn(__task) for every __task in [0, __num_tasks) and returns once all calls have finished
+  template <class _Fn>
+  _CCCL_HOST_API void __run(size_t __num_tasks, _Fn& __fn)
+  {
+    if (__num_tasks == 1 || __threads_.empty())
+    {
+      for (size_t __task = 0; __task < __num_tasks; ++__task)
+      {
+        __fn(__task);
+      }
+      return;
+    }
+
+    // Element access functions which exit via an exception call std::terminate with parallel policies
+    __host_job __job{[](void* __fn_ptr, size_t __task) noexcept {
+                       (*static_cast<_Fn*>(__fn_ptr))(__task);
+                     },
+                     ::cuda::std::addressof(__fn),
+                     __num_tasks};
+
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __jobs_.push_back(&__job);
+    }
+    if (__num_tasks - 1 < __threads_.size())
+    {
+      for (size_t __i = 1; __i < __num_tasks; ++__i)
+      {
+        __work_available_.notify_one();
+      }
+    }
+    else
+    {
+      __work_available_.notify_all();
+    }
+
+    __job.__work();
+
+    // Once the job is no longer published and no worker is running one of its tasks, all tasks have finished
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    __remove_job(&__job);
+    __job_released_.wait(__lock, [&] {
+      return __job.__num_users_ == 0;
+    });
+  }
+};
+
+//! @brief Minimal number of elements a thread should process, below that the synchronization dominates
+inline constexpr size_t __host_min_elements_per_task = size_t{1} << 12;
+
+//! @brief Returns the number of partitions used to process __count elements with the given policy. Policies without
+//! the parallel bit are processed by the calling thread alone.
+template <class _Policy, class _Size>
+[[nodiscard]] _CCCL_HOST_API size_t __host_num_partitions(const _Size __count) noexcept
+{
+  constexpr auto __policy = _Policy::__get_policy();
+  if constexpr ((static_cast<uint8_t>(__policy) & static_cast<uint8_t>(__execution_policy::__parallel)) == 0)
+  {
+    return 1;
+  }
+  else
+  {
+    const size_t __max_partitions = __host_thread_pool::__get().__num_threads();
+    return ::cuda::std::max(
+      size_t{1},
+      ::cuda::std::min(__max_partitions,
+                       ::cuda::ceil_div(static_cast<size_t>(__count), __host_min_elements_per_task)));
+  }
+}
+
+//! @brief Returns the start of partition __part when __count elements are split into __num_parts partitions
+template <class _Size>
+[[nodiscard]] _CCCL_HOST_API constexpr _Size
+__host_partition_begin(const _Size __count, const size_t __part, const size_t __num_parts) noexcept
+{
+  return static_cast<_Size>(static_cast<size_t>(__count) * __part / __num_parts);
+}
+
+//! @brief Calls __fn(__part) for every partition in [0, __num_parts) in parallel
+template <class _Fn>
+_CCCL_HOST_API void __host_parallel_for(const size_t __num_parts, _Fn __fn)
+{
+  __host_thread_pool::__get().__run(__num_parts, __fn);
+}
+
+//! @brief Calls __fn(__begin, __end) on consecutive subranges of [0, __count) in parallel. The range is split into
+//! more subranges than there are threads to balance uneven work.
+template <class _Policy, class _Size, class _Fn>
+_CCCL_HOST_API void __host_parallel_for_range(const _Size __count, _Fn __fn)
+{
+  // Oversubscribe so that threads that finish early can pick up more work
+  constexpr size_t __tasks_per_thread = 4;
+  const size_t __num_threads          = __host_num_partitions<_Policy>(__count);
+  const size_t __num_parts            = __num_threads == 1
+                                        ? 1
+                                        : ::cuda::std::min(__num_threads * __tasks_per_thread,
+                                                           ::cuda::ceil_div(static_cast<size_t>(__count),
+                                                                            __host_min_elements_per_task / 4));
+  auto __body = [&](const size_t __part) {
+    __fn(__host_partition_begin(__count, __part, __num_parts), __host_partition_begin(__count, __part + 1, __num_parts));
+  };
+  __host_thread_pool::__get().__run(__num_parts, __body);
+}
+
+//! @brief Uninitialized storage for __size objects of type _Tp. The owner is responsible for constructing the objects
+//! and for destroying them through __destroy before the buffer goes out of scope.
+template <class _Tp>
+class __host_temporary_buffer
+{
+  _Tp* __data_;
+
+public:
+  _CCCL_HOST_API explicit __host_temporary_buffer(const size_t __size)
+      : __data_(static_cast<_Tp*>(::operator new(__size * sizeof(_Tp), ::std::align_val_t{alignof(_Tp)})))
+  {}
+
+  __host_temporary_buffer(const __host_temporary_buffer&)            = delete;
+  __host_temporary_buffer& operator=(const __host_temporary_buffer&) = delete;
+
+  _CCCL_HOST_API ~__host_temporary_buffer()
+  {
+    ::operator delete(__data_, ::std::align_val_t{alignof(_Tp)});
+  }
+
+  [[nodiscard]] _CCCL_HOST_API _Tp* __get() const noexcept
+  {
+    return __data_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API _Tp& operator[](const size_t __index) const noexcept
+  {
+    return __data_[__index];
+  }
+
+  template <class... _Args>
+  _CCCL_HOST_API _Tp& __construct(const size_t __index, _Args&&... __args)
+  {
+    return *::cuda::std::__construct_at(__data_ + __index, ::cuda::std::forward<_Args>(__args)...);
+  }
+
+  _CCCL_HOST_API void __destroy(const size_t __begin, const size_t __end) noexcept
+  {
+    for (size_t __index = __begin; __index < __end; ++__index)
+    {
+      __data_[__index].~_Tp();
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_THREAD_POOL_H
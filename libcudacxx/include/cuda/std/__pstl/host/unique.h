@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_UNIQUE_H
+#define _CUDA_STD___PSTL_HOST_UNIQUE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/unique.h>
+#  include <cuda/std/__algorithm/unique_copy.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/compact.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__unique, __execution_backend::__host>
+{
+  template <class _Policy, class _InputIterator, class _BinaryPred>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator
+  operator()(const _Policy&, _InputIterator __first, _InputIterator __last, _BinaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Size              = iter_difference_t<_InputIterator>;
+      const auto __count       = ::cuda::std::distance(__first, __last);
+      const size_t __num_parts = __host_num_partitions<_Policy>(__count);
+
+      // Whether the first element of a partition continues the group of the previous partition must be decided
+      // before any partition is compacted in place
+      __host_temporary_buffer<bool> __continues_group{__num_parts};
+      __continues_group.__construct(0, false);
+      for (size_t __part = 1; __part < __num_parts; ++__part)
+      {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        __continues_group.__construct(__part, static_cast<bool>(__pred(__first[__begin - 1], __first[__begin])));
+      }
+
+      // Compact every partition in place, then move the kept elements of all partitions next to each other
+      __host_temporary_buffer<__host_segment<_Size>> __segments{__num_parts};
+      __host_parallel_for(__num_parts, [&](const size_t __part) {
+        const _Size __begin = __host_partition_begin(__count, __part, __num_parts);
+        const _Size __end   = __host_partition_begin(__count, __part + 1, __num_parts);
+        const _Size __size  = ::cuda::std::unique(__first + __begin, __first + __end, __pred) - (__first + __begin);
+        const _Size __skip  = __continues_group[__part] ? 1 : 0;
+        __segments.__construct(__part, __host_segment<_Size>{__begin + __skip, _Size{0}, __size - __skip});
+      });
+
+      _Size __num_kept = 0;
+      for (size_t __part = 0; __part < __num_parts; ++__part)
+      {
+        __segments[__part].__dst_ = __num_kept;
+        __num_kept += __segments[__part].__size_;
+      }
+      ::cuda::std::execution::__host_relocate_segments(__first, __segments.__get(), __num_parts);
+      return __first + __num_kept;
+    }
+    else
+    {
+      return ::cuda::std::unique(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryPred>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    const _Policy&, _InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Size           = iter_difference_t<_InputIterator>;
+      const auto __count    = ::cuda::std::distance(__first, __last);
+      const _Size __written = ::cuda::std::execution::__host_copy_selected<_Policy>(
+        __count,
+        [&](const _Size __i) {
+          return __i == 0 || !__pred(__first[__i - 1], __first[__i]);
+        },
+        [&](const _Size __i, const _Size __pos) {
+          __result[__pos] = __first[__i];
+        });
+      return __result + __written;
+    }
+    else
+    {
+      return ::cuda::std::unique_copy(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_UNIQUE_H
@@ -42,6 +42,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -61,7 +64,7 @@ struct __is_heap_until_fn
   {}
 
   template <class _Diff, class _Tp>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr bool operator()(const _Diff& __i, const _Tp& __current) const
+  [[nodiscard]] _CCCL_API constexpr bool operator()(const _Diff& __i, const _Tp& __current) const
   {
     return __comp_(__base_[(__i - _Diff(1)) / _Diff(2)], __current);
   }
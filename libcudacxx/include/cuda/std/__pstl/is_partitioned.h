@@ -29,7 +29,9 @@
 #  include <cuda/std/__concepts/concept_macros.h>
 #  include <cuda/std/__execution/policy.h>
 #  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -39,6 +41,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -50,7 +55,7 @@ struct __is_partitioned_fn
   _UnaryPred __pred_;
 
   template <class _Tuple>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr bool operator()(const _Tuple& __tuple) const
+  [[nodiscard]] _CCCL_API constexpr bool operator()(const _Tuple& __tuple) const
   {
     const bool __pred_lhs = __pred_(::cuda::std::get<0>(__tuple));
     const bool __pred_rhs = __pred_(::cuda::std::get<1>(__tuple));
@@ -80,10 +85,15 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND is_execution_po
       return true;
     }
 
+    // The end of the pairs is computed from the count, as {__last, __last} is never reached by pairs of iterators that
+    // are not random access
+    const auto __count  = ::cuda::std::distance(__first, __last);
+    auto __zip_first    = ::cuda::zip_iterator{__first, ::cuda::std::next(__first)};
+    auto __zip_last     = ::cuda::std::next(__zip_first, __count - 1);
     const auto __result = __dispatch(
       __policy,
-      ::cuda::zip_iterator{__first, __first + 1},
-      ::cuda::zip_iterator{__last, __last},
+      ::cuda::std::move(__zip_first),
+      ::cuda::std::move(__zip_last),
       __is_partitioned_fn<_UnaryPred>{::cuda::std::move(__pred)});
     return ::cuda::std::get<1>(__result.__iterators()) == __last;
   }
@@ -31,7 +31,9 @@
 #  include <cuda/std/__execution/policy.h>
 #  include <cuda/std/__functional/operations.h>
 #  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
@@ -40,6 +42,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -67,11 +72,15 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND is_execution_po
       return true;
     }
 
-    // Note we compare __first + 1 and __first, so that we do not need to negate the predicate
-    auto __result = __dispatch(
+    // Note we compare __first + 1 and __first, so that we do not need to negate the predicate. The end of the pairs
+    // is computed from the count, as {__last, __last} is never reached by pairs of iterators that are not random access
+    const auto __count = ::cuda::std::distance(__first, __last);
+    auto __zip_first   = ::cuda::zip_iterator{::cuda::std::next(__first), __first};
+    auto __zip_last    = ::cuda::std::next(__zip_first, __count - 1);
+    auto __result      = __dispatch(
       __policy,
-      ::cuda::zip_iterator{__first + 1, __first},
-      ::cuda::zip_iterator{__last, __last},
+      ::cuda::std::move(__zip_first),
+      ::cuda::std::move(__zip_last),
       ::cuda::zip_function{::cuda::std::move(__pred)});
     return ::cuda::std::get<0>(__result.__iterators()) == __last;
   }
@@ -32,6 +32,7 @@
 #  include <cuda/std/__functional/not_fn.h>
 #  include <cuda/std/__functional/operations.h>
 #  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/next.h>
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_comparable.h>
@@ -43,6 +44,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -77,7 +81,7 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIter1> _CCCL_AND __has_forward_trav
 
     const auto __count = ::cuda::std::distance(__first1, __last1);
     auto __zip_first   = ::cuda::zip_iterator{::cuda::std::move(__first1), ::cuda::std::move(__first2)};
-    auto __zip_last    = __zip_first + __count;
+    auto __zip_last    = ::cuda::std::next(__zip_first, __count);
     auto __result      = __dispatch(
       __policy,
       ::cuda::std::move(__zip_first),
@@ -37,10 +37,14 @@
 #  include <cuda/std/__type_traits/is_execution_policy.h>
 #  include <cuda/std/__type_traits/is_nothrow_copy_constructible.h>
 #  include <cuda/std/__utility/move.h>
+#  include <cuda/std/tuple>
 
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/transform.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -56,13 +60,33 @@ struct __replace_return_value
   {}
 
   template <class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr _Tp operator()(const _Up&) const
+  [[nodiscard]] _CCCL_API constexpr _Tp operator()(const _Up&) const
     noexcept(is_nothrow_copy_constructible_v<_Tp>)
   {
     return __new_value_;
   }
 };
 
+template <class _UnaryPred, class _Tp>
+struct __replace_copy_if_fn
+{
+  _UnaryPred __pred_;
+  _Tp __new_value_;
+
+  template <class _Tuple>
+  _CCCL_API constexpr void operator()(_Tuple&& __tuple) const
+  {
+    if (__pred_(::cuda::std::get<0>(__tuple)))
+    {
+      ::cuda::std::get<1>(__tuple) = __new_value_;
+    }
+    else
+    {
+      ::cuda::std::get<1>(__tuple) = ::cuda::std::get<0>(__tuple);
+    }
+  }
+};
+
 _CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
 
 _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _Tp = iter_value_t<_InputIterator>)
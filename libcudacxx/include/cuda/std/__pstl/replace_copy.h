@@ -23,12 +23,16 @@
 
 #if _CCCL_HOSTED()
 
+#  include <cuda/__functional/equal_to_value.h>
+#  include <cuda/__iterator/zip_iterator.h>
 #  include <cuda/__nvtx/nvtx.h>
 #  include <cuda/std/__algorithm/replace_copy.h>
 #  include <cuda/std/__concepts/concept_macros.h>
 #  include <cuda/std/__execution/policy.h>
 #  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
 #  include <cuda/std/__iterator/readable_traits.h>
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__pstl/replace.h>
@@ -40,8 +44,11 @@
 #  include <cuda/std/__utility/move.h>
 
 #  if _CCCL_HAS_BACKEND_CUDA()
-#    include <cuda/std/__pstl/cuda/transform.h>
+#    include <cuda/std/__pstl/cuda/for_each_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/for_each_n.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -64,7 +71,7 @@ _CCCL_HOST_API _OutputIterator replace_copy(
                 "cuda::std::replace_copy requires T to be comparable with iter_reference_t<InputIterator>");
 
   [[maybe_unused]] auto __dispatch =
-    ::cuda::std::execution::__pstl_select_dispatch<::cuda::std::execution::__pstl_algorithm::__transform, _Policy>();
+    ::cuda::std::execution::__pstl_select_dispatch<::cuda::std::execution::__pstl_algorithm::__for_each_n, _Policy>();
   if constexpr (::cuda::std::execution::__pstl_can_dispatch<decltype(__dispatch)>)
   {
     _CCCL_NVTX_RANGE_SCOPE("cuda::std::replace_copy");
@@ -74,13 +81,14 @@ _CCCL_HOST_API _OutputIterator replace_copy(
       return __result;
     }
 
-    return __dispatch(
+    // Every output element is written, either with the new value or with the corresponding input element
+    const auto __count = ::cuda::std::distance(__first, __last);
+    (void) __dispatch(
       __policy,
-      ::cuda::std::move(__first),
-      ::cuda::std::move(__last),
-      ::cuda::std::move(__result),
-      __replace_return_value{__new_value},
-      ::cuda::equal_to_value{__old_value});
+      ::cuda::zip_iterator{::cuda::std::move(__first), __result},
+      __count,
+      __replace_copy_if_fn<::cuda::equal_to_value<_Tp>, _Tp>{::cuda::equal_to_value<_Tp>{__old_value}, __new_value});
+    return ::cuda::std::next(__result, __count);
   }
   else
   {
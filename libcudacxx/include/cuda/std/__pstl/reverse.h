@@ -24,6 +24,7 @@
 #if _CCCL_HOSTED()
 
 #  include <cuda/__iterator/counting_iterator.h>
+#  include <cuda/__iterator/zip_iterator.h>
 #  include <cuda/__nvtx/nvtx.h>
 #  include <cuda/std/__algorithm/iter_swap.h>
 #  include <cuda/std/__algorithm/reverse.h>
@@ -35,36 +36,28 @@
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__type_traits/always_false.h>
 #  include <cuda/std/__type_traits/is_execution_policy.h>
-#  include <cuda/std/__type_traits/is_nothrow_move_constructible.h>
 #  include <cuda/std/__utility/move.h>
+#  include <cuda/std/tuple>
 
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/for_each_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/for_each_n.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
-template <class _InputIterator>
+// Swaps the elements that a pair of iterators, one from the front and one from the back, points to. The iterators are
+// passed rather than computed from an index, so that bidirectional iterators are supported
 struct __reverse_fn
 {
-  _InputIterator __first_;
-  ::cuda::std::reverse_iterator<_InputIterator> __last_;
-  iter_difference_t<_InputIterator> __count_;
-
-  _CCCL_HOST_API constexpr __reverse_fn(
-    _InputIterator __first,
-    _InputIterator __last,
-    iter_difference_t<_InputIterator> __count) noexcept(is_nothrow_move_constructible_v<_InputIterator>)
-      : __first_(::cuda::std::move(__first))
-      , __last_(::cuda::std::move(__last))
-      , __count_(__count)
-  {}
-
-  _CCCL_DEVICE_API constexpr void operator()(const iter_difference_t<_InputIterator> __index) const noexcept
+  template <class _Tuple>
+  _CCCL_API constexpr void operator()(const _Tuple& __iterators) const
   {
-    ::cuda::std::__iter_swap_cpo{}(__first_ + __index, __last_ + __index);
+    ::cuda::std::__iter_swap_cpo{}(::cuda::std::get<0>(__iterators), ::cuda::std::get<1>(__iterators));
   }
 };
 
@@ -86,10 +79,12 @@ _CCCL_HOST_API void reverse([[maybe_unused]] const _Policy& __policy, _InputIter
     }
 
     const auto __count = ::cuda::std::distance(__first, __last);
-    (void) __dispatch(__policy,
-                      ::cuda::counting_iterator<iter_difference_t<_InputIterator>>{0},
-                      static_cast<iter_difference_t<_InputIterator>>(__count / 2),
-                      __reverse_fn{::cuda::std::move(__first), ::cuda::std::move(__last), __count});
+    (void) __dispatch(
+      __policy,
+      ::cuda::zip_iterator{::cuda::counting_iterator{::cuda::std::move(__first)},
+                           ::cuda::counting_iterator{::cuda::std::reverse_iterator{::cuda::std::move(__last)}}},
+      static_cast<iter_difference_t<_InputIterator>>(__count / 2),
+      __reverse_fn{});
   }
   else
   {
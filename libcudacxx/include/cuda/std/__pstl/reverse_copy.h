@@ -29,6 +29,7 @@
 #  include <cuda/std/__execution/policy.h>
 #  include <cuda/std/__iterator/distance.h>
 #  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
 #  include <cuda/std/__iterator/reverse_iterator.h>
 #  include <cuda/std/__pstl/dispatch.h>
 #  include <cuda/std/__type_traits/always_false.h>
@@ -38,6 +39,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/copy_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/copy_n.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -63,7 +67,7 @@ _CCCL_HOST_API _OutputIterator reverse_copy(
     }
 
     const auto __count = ::cuda::std::distance(__first, __last);
-    auto __ret         = __result + __count;
+    auto __ret         = ::cuda::std::next(__result, __count);
     (void) __dispatch(__policy, ::cuda::std::move(__first), __count, ::cuda::std::reverse_iterator{__ret});
     return __ret;
   }
@@ -35,6 +35,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/rotate.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/rotate.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -53,7 +56,11 @@ rotate([[maybe_unused]] const _Policy& __policy, _InputIterator __first, _InputI
   {
     _CCCL_NVTX_RANGE_SCOPE("cuda::std::rotate");
 
-    if (__first == __middle || __middle == __last)
+    if (__first == __middle)
+    {
+      return __last;
+    }
+    if (__middle == __last)
     {
       return __first;
     }
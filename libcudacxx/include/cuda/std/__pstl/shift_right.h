@@ -38,6 +38,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/shift_right.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/shift_right.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -60,7 +63,11 @@ _CCCL_HOST_API _InputIterator shift_right(
     _CCCL_NVTX_RANGE_SCOPE("cuda::std::shift_right");
 
     const auto __count = ::cuda::std::distance(__first, __last);
-    if (__num_shifted == 0 || __num_shifted >= __count)
+    if (__num_shifted == 0)
+    {
+      return __first;
+    }
+    if (__num_shifted >= __count)
     {
       return __last;
     }
@@ -49,6 +49,10 @@
 #    include <cuda/std/__pstl/cuda/for_each_n.h>
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/for_each_n.h>
+#    include <cuda/std/__pstl/host/transform.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -61,7 +65,7 @@ struct __swap_ranges_iter_swap_fn
   _InputIterator2 __first2;
 
   template <class _DifferenceType>
-  _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
+  _CCCL_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
   {
     ::cuda::std::__iter_swap_cpo{}(
       __first1 + __index, __first2 + static_cast<iter_difference_t<_InputIterator2>>(__index));
@@ -71,7 +75,7 @@ struct __swap_ranges_iter_swap_fn
 struct __swap_ranges_transform_fn
 {
   template <class _Tp, class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr auto operator()(_Tp __lhs, _Up __rhs) const
+  [[nodiscard]] _CCCL_API _CCCL_FORCEINLINE constexpr auto operator()(_Tp __lhs, _Up __rhs) const
   {
     using ::cuda::std::swap;
     swap(__lhs, __rhs);
@@ -129,7 +133,7 @@ _CCCL_HOST_API _InputIterator2 swap_ranges(
       }
 
       const auto __count = ::cuda::std::distance(__first1, __last1);
-      auto __ret         = __first2 + static_cast<iter_difference_t<_InputIterator2>>(__count);
+      auto __ret         = ::cuda::std::next(__first2, static_cast<iter_difference_t<_InputIterator2>>(__count));
       (void) __for_each_dispatch(
         __policy,
         ::cuda::counting_iterator<iter_difference_t<_InputIterator1>>{0},
@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_BULK_GENERATE_H
+#define _CUDA_STD___RANDOM_BULK_GENERATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Engines with a member `generate(span<result_type>)` produce many values at once faster than one at a time
+template <class _URng, class = void>
+inline constexpr bool __cccl_random_has_bulk_generate = false;
+template <class _URng>
+inline constexpr bool __cccl_random_has_bulk_generate<
+  _URng,
+  void_t<decltype(::cuda::std::declval<_URng&>().generate(span<typename _URng::result_type>{}))>> = true;
+
+//! @brief Fills `__out` with the next values of `__g`, as if by calling `__g()` for every element in order
+_CCCL_EXEC_CHECK_DISABLE
+template <class _URng>
+_CCCL_API void __generate_random_bits(_URng& __g, span<typename _URng::result_type> __out)
+{
+  if constexpr (__cccl_random_has_bulk_generate<_URng>)
+  {
+    __g.generate(__out);
+  }
+  else
+  {
+    for (auto& __value : __out)
+    {
+      __value = __g();
+    }
+  }
+}
+
+//! @brief A generator that returns the values an engine produced in bulk, and calls the engine itself once they are
+//! used up
+//!
+//! Distributions that are passed this generator draw the same values in the same order as if they were passed the
+//! engine, so their results are the same. Only values that will certainly be used must be drawn in bulk, otherwise the
+//! engine would be left ahead of where the scalar calls leave it.
+template <class _URng>
+class __bulk_urng
+{
+public:
+  using result_type = typename _URng::result_type;
+
+  static constexpr size_t __capacity = 256;
+
+private:
+  _URng& __g_;
+  result_type __values_[__capacity];
+  size_t __first_ = 0;
+  size_t __last_  = 0;
+
+public:
+  _CCCL_API explicit __bulk_urng(_URng& __g) noexcept
+      : __g_{__g}
+  {}
+
+  [[nodiscard]] _CCCL_API static constexpr result_type min() noexcept
+  {
+    return (_URng::min) ();
+  }
+  [[nodiscard]] _CCCL_API static constexpr result_type max() noexcept
+  {
+    return (_URng::max) ();
+  }
+
+  [[nodiscard]] _CCCL_API bool __empty() const noexcept
+  {
+    return __first_ == __last_;
+  }
+
+  //! @brief Draws the next `__n` values of the engine at once, after all values drawn before have been used
+  _CCCL_API void __fill(size_t __n)
+  {
+    _CCCL_ASSERT(__empty(), "The values drawn before must be used first");
+    _CCCL_ASSERT(__n <= __capacity, "Too many values to draw at once");
+    ::cuda::std::__generate_random_bits(__g_, span<result_type>{__values_, __n});
+    __first_ = 0;
+    __last_  = __n;
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_API result_type operator()()
+  {
+    return __first_ != __last_ ? __values_[__first_++] : __g_();
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_BULK_GENERATE_H
@@ -28,18 +28,25 @@
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
-// generate_canonical
-_CCCL_EXEC_CHECK_DISABLE
+// The number of values of the engine that generate_canonical takes for every result
 template <class _RealType, size_t __bits, class _URng>
-[[nodiscard]] _CCCL_API constexpr _RealType generate_canonical(_URng& __g) noexcept
+[[nodiscard]] _CCCL_API constexpr size_t __generate_canonical_draws() noexcept
 {
   constexpr size_t __dt = numeric_limits<_RealType>::digits;
   const size_t __b      = __dt < __bits ? __dt : __bits;
   const size_t __log_r  = ::cuda::std::__bit_log2<uint64_t>((_URng::max) () - (_URng::min) () + uint64_t(1));
-  const size_t __k      = __b / __log_r + (__b % __log_r != 0) + (__b == 0);
-  const _RealType __rp  = static_cast<_RealType>((_URng::max) () - (_URng::min) ()) + _RealType(1);
-  _RealType __base      = __rp;
-  _RealType __sp        = static_cast<_RealType>(__g() - (_URng::min) ());
+  return __b / __log_r + (__b % __log_r != 0) + (__b == 0);
+}
+
+// generate_canonical
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RealType, size_t __bits, class _URng>
+[[nodiscard]] _CCCL_API constexpr _RealType generate_canonical(_URng& __g) noexcept
+{
+  constexpr size_t __k = ::cuda::std::__generate_canonical_draws<_RealType, __bits, _URng>();
+  const _RealType __rp = static_cast<_RealType>((_URng::max) () - (_URng::min) ()) + _RealType(1);
+  _RealType __base     = __rp;
+  _RealType __sp       = static_cast<_RealType>(__g() - (_URng::min) ());
 
   _CCCL_PRAGMA_UNROLL_FULL()
   for (size_t __i = 1; __i < __k; ++__i, __base *= __rp)
@@ -20,13 +20,18 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__cmath/logarithms.h>
 #include <cuda/std/__cmath/roots.h>
 #include <cuda/std/__host_stdlib/istream>
 #include <cuda/std/__host_stdlib/ostream>
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/bulk_generate.h>
+#include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -132,6 +137,40 @@ public:
     return __up * __p.stddev() + __p.mean();
   }
 
+  //! @brief Fills `__out` with values of the distribution, as if by calling `operator()` for every element in order
+  //!
+  //! The values of `__g` are drawn in bulk, see `uniform_real_distribution::generate`.
+  template <class _URng>
+  _CCCL_API void generate(_URng& __g, span<result_type> __out)
+  {
+    generate(__g, __out, __p_);
+  }
+
+  template <class _URng>
+  _CCCL_API void generate(_URng& __g, span<result_type> __out, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    // Every attempt of the polar method takes two uniform values, and an accepted attempt produces two results. So
+    // drawing one attempt for every two missing results never draws values that are left unused, even if all of them
+    // are accepted. The attempts that are rejected take further values from the engine itself.
+    constexpr size_t __draws =
+      2 * ::cuda::std::__generate_canonical_draws<result_type, numeric_limits<result_type>::digits, _URng>();
+    constexpr size_t __chunk = __bulk_urng<_URng>::__capacity / __draws;
+
+    __bulk_urng<_URng> __bulk{__g};
+    for (size_t __i = 0; __i < __out.size();)
+    {
+      if (!__v_hot_)
+      {
+        __bulk.__fill(::cuda::std::min(__chunk, (__out.size() - __i + 1) / 2) * __draws);
+      }
+      do
+      {
+        __out[__i++] = (*this)(__bulk, __p);
+      } while (__i < __out.size() && !__bulk.__empty());
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type mean() const noexcept
   {
@@ -27,11 +27,16 @@
 #include <cuda/std/__host_stdlib/ostream>
 #include <cuda/std/__random/is_seed_sequence.h>
 #include <cuda/std/__random/is_valid.h>
+#include <cuda/std/__cstring/memcpy.h>
 #include <cuda/std/__type_traits/make_nbit_int.h>
+#include <cuda/std/__utility/integer_sequence.h>
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/array>
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <nv/target>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -243,6 +248,34 @@ public:
     return __y_[__j_];
   }
 
+  //! This member function fills a span with the next random values and updates this philox_engine's state, as if by
+  //! calling operator() for every element in order.
+  //!
+  //! On the host, the blocks of several consecutive counters are evaluated at once in the lanes of the vector
+  //! registers.
+  //!
+  //! @param __out The span to fill.
+  _CCCL_API void generate(span<result_type> __out) noexcept
+  {
+    const size_t __n = __out.size();
+    size_t __i       = 0;
+    // The values left in the output buffer come first
+    for (; __i < __n && __j_ != word_count - 1; ++__i)
+    {
+      __out[__i] = (*this)();
+    }
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    if constexpr (__lanes_enabled)
+    {
+      NV_IF_TARGET(NV_IS_HOST, (__i += word_count * __philox_lanes(__out.data() + __i, (__n - __i) / word_count);))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    for (; __i < __n; ++__i)
+    {
+      __out[__i] = (*this)();
+    }
+  }
+
   //! This member function advances this philox_engine's state a given number of times
   //! and discards the results. philox_engine is a counter-based engine, therefore can discard with O(1) complexity.
   //!
@@ -515,6 +548,121 @@ private:
     __y_ = __S;
   }
 
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  // The lanes of the vector registers of the host hold words of 64 bits, so the full product of two words of 32 bits
+  // fits into a lane. The high half of the product of words of 64 bits takes four products of their halves, which is
+  // slower than evaluating the counters one by one, and so are the two lanes of 128-bit registers.
+  static constexpr bool __lanes_enabled =
+    word_size == 32 && sizeof(result_type) == sizeof(uint64_t) && _CCCL_SIMD_HOST_VECTOR_BYTES() >= 32;
+  static constexpr size_t __lanes       = _CCCL_SIMD_HOST_VECTOR_BYTES() / sizeof(uint64_t);
+
+  typedef uint64_t __lane_vector_t __attribute__((vector_size(_CCCL_SIMD_HOST_VECTOR_BYTES())));
+
+  //! @brief Interleaves the lower (`_Hi == 0`) or upper (`_Hi == 1`) halves of `__lhs` and `__rhs`
+  template <size_t _Hi, size_t... _Is>
+  [[nodiscard]] _CCCL_HOST_API static __lane_vector_t
+  __zip(const __lane_vector_t __lhs, const __lane_vector_t __rhs, index_sequence<_Is...>) noexcept
+  {
+#  if _CCCL_COMPILER(CLANG)
+    return __builtin_shufflevector(__lhs, __rhs, ((_Is % 2) * __lanes + _Hi * __lanes / 2 + _Is / 2)...);
+#  else // ^^^ _CCCL_COMPILER(CLANG) ^^^ / vvv !_CCCL_COMPILER(CLANG) vvv
+    return __builtin_shuffle(__lhs, __rhs, __lane_vector_t{((_Is % 2) * __lanes + _Hi * __lanes / 2 + _Is / 2)...});
+#  endif // !_CCCL_COMPILER(CLANG)
+  }
+
+  //! @brief Evaluates the blocks of as many counters as fill whole vector registers, one counter per lane, and returns
+  //! the number of blocks written to `__out`
+  //!
+  //! The output buffer must be used up. It is left holding the last block, like the scalar calls leave it.
+  [[nodiscard]] _CCCL_HOST_API size_t __philox_lanes(result_type* __out, const size_t __blocks) noexcept
+  {
+    constexpr auto __pairs = make_index_sequence<__lanes>{};
+
+    size_t __done = 0;
+    for (; __done + __lanes <= __blocks; __done += __lanes)
+    {
+      __lane_vector_t __S[word_count] = {};
+      if (__x_[0] <= max() - __lanes)
+      {
+        // The counters of the lanes only differ in their least significant word
+        __lane_vector_t __iota;
+        for (size_t __lane = 0; __lane < __lanes; ++__lane)
+        {
+          __iota[__lane] = __lane;
+        }
+        __S[0] = __iota + __x_[0];
+        for (size_t __w = 1; __w < word_count; ++__w)
+        {
+          __S[__w] = __lane_vector_t{} + __x_[__w];
+        }
+        __x_[0] += __lanes;
+      }
+      else
+      {
+        for (size_t __lane = 0; __lane < __lanes; ++__lane)
+        {
+          for (size_t __w = 0; __w < word_count; ++__w)
+          {
+            __S[__w][__lane] = __x_[__w];
+          }
+          __increment_counter();
+        }
+      }
+
+      // The same rounds as __philox, where the product of two words holds their high and low halves
+      array<result_type, word_count / 2> __K = __k_;
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __r = 0; __r < round_count; ++__r)
+      {
+        if constexpr (word_count == 2)
+        {
+          const __lane_vector_t __prod = __S[0] * multipliers[0];
+          __S[0]                       = (__prod >> 32) ^ __K[0] ^ __S[1];
+          __S[1]                       = __prod & max();
+          __K[0]                       = (__K[0] + round_consts[0]) & max();
+        }
+        else // word_count == 4
+        {
+          const __lane_vector_t __prod0 = __S[2] * multipliers[0];
+          const __lane_vector_t __prod2 = __S[0] * multipliers[1];
+          __S[0]                        = (__prod0 >> 32) ^ __K[0] ^ __S[1];
+          __S[1]                        = __prod0 & max();
+          __S[2]                        = (__prod2 >> 32) ^ __K[1] ^ __S[3];
+          __S[3]                        = __prod2 & max();
+          __K[0]                        = (__K[0] + round_consts[0]) & max();
+          __K[1]                        = (__K[1] + round_consts[1]) & max();
+        }
+      }
+
+      for (size_t __w = 0; __w < word_count; ++__w)
+      {
+        __y_[__w] = __S[__w][__lanes - 1];
+      }
+
+      // The words of every lane are stored next to each other
+      __lane_vector_t __blocks_out[word_count];
+      if constexpr (word_count == 2)
+      {
+        __blocks_out[0] = __zip<0>(__S[0], __S[1], __pairs);
+        __blocks_out[1] = __zip<1>(__S[0], __S[1], __pairs);
+      }
+      else // word_count == 4
+      {
+        const __lane_vector_t __even_lo = __zip<0>(__S[0], __S[2], __pairs);
+        const __lane_vector_t __even_hi = __zip<1>(__S[0], __S[2], __pairs);
+        const __lane_vector_t __odd_lo  = __zip<0>(__S[1], __S[3], __pairs);
+        const __lane_vector_t __odd_hi  = __zip<1>(__S[1], __S[3], __pairs);
+        __blocks_out[0]                 = __zip<0>(__even_lo, __odd_lo, __pairs);
+        __blocks_out[1]                 = __zip<1>(__even_lo, __odd_lo, __pairs);
+        __blocks_out[2]                 = __zip<0>(__even_hi, __odd_hi, __pairs);
+        __blocks_out[3]                 = __zip<1>(__even_hi, __odd_hi, __pairs);
+      }
+      ::cuda::std::memcpy(__out + __done * word_count, __blocks_out, sizeof(__blocks_out));
+    }
+    return __done;
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
   // The counter X, a big integer stored as word_count w-bit words.
   // The least significant word is __x_[0].
   array<result_type, word_count> __x_ = {};
@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_ZIGGURAT_H
+#define _CUDA_STD___RANDOM_ZIGGURAT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/exponential_functions.h>
+#include <cuda/std/__cmath/logarithms.h>
+#include <cuda/std/__random/uniform_int_distribution.h>
+#include <cuda/std/__random/ziggurat_tables.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The Ziggurat method of Marsaglia and Tsang covers the density with layers of equal area, see ziggurat_tables.h. A
+// single random word selects a layer and a point in it, which lies below the density in almost all cases, so most
+// values take one word, one multiplication and one comparison. Only points in the wedge of a layer above the density,
+// or in the tail of the base layer, need further words and an exponential or a logarithm.
+//
+// The 8 least significant bits of a word select the layer and its 53 most significant bits the position in it.
+
+//! @brief The 53 most significant bits of `__bits` as a value in [0, 1)
+[[nodiscard]] _CCCL_API constexpr double __ziggurat_unit(uint64_t __bits) noexcept
+{
+  return static_cast<double>(__bits >> 11) * 0x1.0p-53;
+}
+
+//! @brief The 53 most significant bits of `__bits` as a value in (0, 1], whose logarithm is finite
+[[nodiscard]] _CCCL_API constexpr double __ziggurat_positive_unit(uint64_t __bits) noexcept
+{
+  return static_cast<double>((__bits >> 11) + 1) * 0x1.0p-53;
+}
+
+//! @brief Draws a value of the standard normal distribution from the 64 bit words returned by `__bits`
+template <class _Bits>
+[[nodiscard]] _CCCL_API double __ziggurat_normal(_Bits& __bits)
+{
+  for (;;)
+  {
+    const uint64_t __u = __bits();
+    const size_t __i   = static_cast<size_t>(__u & (__ziggurat_layers - 1));
+    // The position takes the sign from the most significant bit, so that it is uniform in [-1, 1)
+    const double __x = static_cast<double>(static_cast<int64_t>(__u) >> 11) * 0x1.0p-52 * __ziggurat_normal_x[__i];
+    const double __abs_x = __x < 0 ? -__x : __x;
+    if (__abs_x < __ziggurat_normal_x[__i + 1])
+    {
+      return __x;
+    }
+    if (__i == 0)
+    {
+      // Marsaglia's method for the tail beyond R
+      const double __r = __ziggurat_normal_x[1];
+      double __tail_x;
+      double __tail_y;
+      do
+      {
+        __tail_x = -::cuda::std::log(::cuda::std::__ziggurat_positive_unit(__bits())) / __r;
+        __tail_y = -::cuda::std::log(::cuda::std::__ziggurat_positive_unit(__bits()));
+      } while (__tail_y + __tail_y < __tail_x * __tail_x);
+      return __x < 0 ? -(__r + __tail_x) : __r + __tail_x;
+    }
+    const double __y =
+      __ziggurat_normal_f[__i]
+      + (__ziggurat_normal_f[__i + 1] - __ziggurat_normal_f[__i]) * ::cuda::std::__ziggurat_unit(__bits());
+    if (__y < ::cuda::std::exp(-0.5 * __x * __x))
+    {
+      return __x;
+    }
+  }
+}
+
+//! @brief Draws a value of the standard exponential distribution from the 64 bit words returned by `__bits`
+template <class _Bits>
+[[nodiscard]] _CCCL_API double __ziggurat_exponential(_Bits& __bits)
+{
+  for (;;)
+  {
+    const uint64_t __u = __bits();
+    const size_t __i   = static_cast<size_t>(__u & (__ziggurat_layers - 1));
+    const double __x   = ::cuda::std::__ziggurat_unit(__u) * __ziggurat_exponential_x[__i];
+    if (__x < __ziggurat_exponential_x[__i + 1])
+    {
+      return __x;
+    }
+    if (__i == 0)
+    {
+      // The tail beyond R is the exponential distribution shifted by R
+      const double __r = __ziggurat_exponential_x[1];
+      return __r - ::cuda::std::log(::cuda::std::__ziggurat_positive_unit(__bits()));
+    }
+    const double __y =
+      __ziggurat_exponential_f[__i]
+      + (__ziggurat_exponential_f[__i + 1] - __ziggurat_exponential_f[__i]) * ::cuda::std::__ziggurat_unit(__bits());
+    if (__y < ::cuda::std::exp(-__x))
+    {
+      return __x;
+    }
+  }
+}
+
+//! @brief The 64 bit words for the Ziggurat method, built from as many values of `_URng` as needed
+template <class _URng>
+using __ziggurat_bits = __independent_bits_engine<_URng, uint64_t>;
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_ZIGGURAT_H
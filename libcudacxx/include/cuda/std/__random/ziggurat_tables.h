@@ -0,0 +1,340 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_ZIGGURAT_TABLES_H
+#define _CUDA_STD___RANDOM_ZIGGURAT_TABLES_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+inline constexpr size_t __ziggurat_layers = 256;
+
+// The layers of the Ziggurat of Marsaglia and Tsang for the density f(x) = exp(-x^2 / 2) of the normal distribution
+// and f(x) = exp(-x) of the exponential distribution, without their normalization. Layer i is the rectangle of width
+// x[i] between the heights f[i] and f[i + 1]. All layers have the same area V, which the base layer 0 shares with the
+// tail beyond x[1] = R, so x[0] = V / f(R). The top layer ends at the mode, x[256] = 0.
+//
+// The tables were generated by the following Python script:
+//
+// from decimal import Decimal, getcontext
+// import math
+// getcontext().prec = 60
+// def layers(f, finv, volume, r):
+//     v = volume(r)
+//     x = [v / f(r), r]
+//     for i in range(1, 255):
+//         y = v / x[i] + f(x[i])
+//         if y >= 1: return None, y
+//         x.append(finv(y))
+//     return x + [Decimal(0)], v / x[255] + f(x[255])
+// def solve(f, finv, volume, lo, hi):  # R such that the top layer ends at f(0) == 1
+//     for _ in range(120):
+//         mid = (lo + hi) / 2
+//         x, top = layers(f, finv, volume, mid)
+//         lo, hi = (mid, hi) if x is None or top > 1 else (lo, mid)
+//     return layers(f, finv, volume, hi)[0]
+// normal_f = lambda x: (-x * x / 2).exp()
+// normal_v = lambda r: r * normal_f(r) + Decimal(math.sqrt(math.pi / 2) * math.erfc(float(r) / math.sqrt(2)))
+// xn = solve(normal_f, lambda y: (-2 * y.ln()).sqrt(), normal_v, Decimal("3.6"), Decimal("3.7"))
+// exp_f = lambda x: (-x).exp()
+// xe = solve(exp_f, lambda y: -y.ln(), lambda r: (r + 1) * exp_f(r), Decimal("7.6"), Decimal("7.8"))
+// for name, values in [("normal_x", xn), ("normal_f", map(normal_f, xn)),
+//                      ("exponential_x", xe), ("exponential_f", map(exp_f, xe))]:
+//     print(name, ", ".join("%.17g" % float(v) for v in values))
+_CCCL_GLOBAL_CONSTANT double __ziggurat_normal_x[] = {
+  3.9107579595249162, 3.6541528853610088, 3.4492782985614312, 3.3202447338398255,
+  3.2245750520478018, 3.1478892895180008, 3.0835261320021434, 3.0278377917695933,
+  2.9786032798818431, 2.9343668672088876, 2.8941210536134121, 2.8571387308732246,
+  2.8228773968264429, 2.7909211740019275, 2.7609440052799861, 2.7326853590440114,
+  2.705933656123062, 2.6805146432857452, 2.6562830375767432, 2.6331163936315827,
+  2.6109105184888235, 2.5895759867082866, 2.569035452681844, 2.5492215503247833,
+  2.5300752321598541, 2.5115444416266945, 2.4935830412710467, 2.4761499396705231,
+  2.4592083743347048, 2.4427253182003641, 2.4266709849371466, 2.4110184139011195,
+  2.3957431197819274, 2.3808227951720857, 2.3662370567172908, 2.3519672273791445,
+  2.3379961487965288, 2.3243080188711325, 2.3108882506013719, 2.2977233489028634,
+  2.2848008027244919, 2.2721089902283818, 2.2596370951737876, 2.2473750329473892,
+  2.2353133849299209, 2.2234433400925107, 2.2117566428841609, 2.2002455466112765,
+  2.1889027716263607, 2.1777214677402932, 2.1666951803543086, 2.1558178198767375,
+  2.1450836340478889, 2.134487182846017, 2.1240233156895236, 2.113687150686653,
+  2.1034740557148774, 2.093379631138792, 2.0833996939983046, 2.0735302635187431,
+  2.0637675478117323, 2.0541079316506523, 2.0445479652175313, 2.0350843537296188,
+  2.0257139478638542, 2.016433734906204, 2.0072408305605287, 1.9981324713584196,
+  1.9891060076174381, 1.9801588969004766, 1.9712886979336592, 1.962493064944363,
+  1.9537697423846467, 1.9451165600086784, 1.9365314282756947, 1.9280123340526658,
+  1.9195573365931882, 1.9111645637712533, 1.9028322085504292, 1.8945585256707047,
+  1.8863418285367828, 1.8781804862929958, 1.8700729210712668, 1.8620176053996742,
+  1.8540130597602018, 1.8460578502851854, 1.8381505865828067, 1.8302899196827569,
+  1.8224745400938858, 1.8147031759662826, 1.8069745913508208, 1.7992875845497203,
+  1.7916409865521625, 1.7840336595494415, 1.7764644955245228, 1.7689324149112686,
+  1.7614363653189102, 1.7539753203176716, 1.7465482782817223, 1.7391542612859117,
+  1.7317923140529632, 1.724461502948045, 1.7171609150178231, 1.7098896570713018,
+  1.7026468547999232, 1.6954316519345616, 1.6882432094371953, 1.6810807047251739,
+  1.6739433309261249, 1.6668302961616654, 1.6597408228581825, 1.6526741470830559,
+  1.6456295179047824, 1.6386061967755476, 1.6316034569348736, 1.6246205828330347,
+  1.6176568695730156, 1.6107116223698301, 1.6037841560260946, 1.5968737944227882,
+  1.5899798700241907, 1.5831017233960292, 1.5762387027359064, 1.5693901634151237,
+  1.5625554675310449, 1.5557339834691764, 1.5489250854741734, 1.5421281532290019,
+  1.5353425714415141, 1.5285677294377125, 1.521803020760998, 1.5150478427767147,
+  1.5083015962813116, 1.5015636851154637, 1.4948335157804935, 1.4881104970574475,
+  1.4813940396281873, 1.4746835556978555, 1.4679784586180795, 1.4612781625102755,
+  1.4545820818884103, 1.447889631280576, 1.4412002248487239, 1.4345132760058923,
+  1.427828197030256, 1.421144398675309, 1.4144612897754711, 1.4077782768463989,
+  1.401094763679251, 1.394410150928141, 1.3877238356899761, 1.3810352110758555,
+  1.3743436657731662, 1.3676485835974761, 1.3609493430332831, 1.3542453167626349,
+  1.3475358711805872, 1.340820365896404, 1.3340981532193601, 1.3273685776279258,
+  1.3206309752210563, 1.3138846731502205, 1.3071289890307312, 1.3003632303308372,
+  1.2935866937369478, 1.2867986644932436, 1.279998415713818, 1.2731852076653563,
+  1.2663582870182295, 1.2595168860637143, 1.2526602218948972, 1.2457874955486272,
+  1.2388978911056874, 1.2319905747461362, 1.2250646937565308, 1.2181193754854815,
+  1.2111537262436991, 1.2041668301443815, 1.1971577478794415, 1.1901255154266921,
+  1.1830691426826867, 1.175987612015452, 1.168879876730833, 1.1617448594456115,
+  1.1545814503599277, 1.147388505420849, 1.1401648443681514, 1.1329092486525338,
+  1.1256204592155334, 1.118297174119345, 1.1109380460135758, 1.1035416794246398,
+  1.0961066278520215, 1.0886313906539797, 1.0811144097034038, 1.0735540657924363,
+  1.0659486747621225, 1.0582964833306752, 1.05059566459093, 1.0428443131441489,
+  1.035040439833441, 1.0271819660356458, 1.0192667174654841, 1.0112924174399958,
+  1.0032566795446729, 0.99515699963509097, 0.98699074709906243, 0.97875515529422463,
+  0.97044731106422444, 0.96206414322304057, 0.95360240988108602, 0.94505868446816543,
+  0.9364293402865751, 0.92771053340200016, 0.91889818364959064, 0.90998795349671846,
+  0.9009752244612218, 0.89185507073294157, 0.88262222958516556, 0.87327106808886079,
+  0.86379554555330884, 0.85418917100816383, 0.84444495490915394, 0.83455535408638215,
+  0.82451220875229214, 0.81430667013521518, 0.80392911698997127, 0.79336905884062325,
+  0.78261502330723309, 0.77165442422456809, 0.76047340643010808, 0.74905666201781529,
+  0.73738721143429564, 0.72544614090999959, 0.7132122851909759, 0.70066184110681506,
+  0.68776789279578854, 0.67449982283729382, 0.6608225742444197, 0.64669571489499378,
+  0.63207223638606114, 0.61689699000775144, 0.60110461775599267, 0.58461676610637936,
+  0.5673382570538188, 0.54915170232716515, 0.52990972066155817, 0.5094233296020918,
+  0.48744396613923602, 0.46363433679088223, 0.43751840220787169, 0.40838913461199117,
+  0.37512133287838056, 0.33573751921442524, 0.2861745917920725, 0.21524189598488169,
+  0,
+};
+
+_CCCL_GLOBAL_CONSTANT double __ziggurat_normal_f[] = {
+  0.00047746776460938679, 0.0012602859304985975, 0.0026090727461021627, 0.0040379725933630305,
+  0.0055224032992509968, 0.0070508754713732268, 0.0086165827693987316, 0.010214971439701471,
+  0.011842757857907889, 0.01349745060173988, 0.015177088307935327, 0.01688008315254317,
+  0.018605121275724647, 0.020351096230044521, 0.022117062707308868, 0.023902203305795882,
+  0.025705804008548896, 0.027527235669603085, 0.029365939758133317, 0.031221417191920248,
+  0.033093219458578522, 0.034980941461716084, 0.036884215688567291, 0.03880270740452612,
+  0.040736110655940933, 0.042684144916474438, 0.04464655225129445, 0.046623094901930368,
+  0.048613553215868528, 0.050617723860947768, 0.052635418276792183, 0.054666461324888921,
+  0.056710690106202902, 0.058767952920933765, 0.060838108349539864, 0.062921024437758127,
+  0.065016577971242856, 0.067124653827788497, 0.069245144397006769, 0.071377949058890375,
+  0.073522973713981268, 0.075680130358927081, 0.077849336702096053, 0.080030515814663056,
+  0.082223595813202863, 0.084428509570353374, 0.086645194450557961, 0.088873592068275803,
+  0.091113648066373634, 0.093365311912690874, 0.095628536713008833, 0.097903279038862298,
+  0.10018949876880982, 0.10248715894193508, 0.1047962256224869, 0.10711666777468365,
+  0.10944845714681165, 0.11179156816383801, 0.11414597782783836, 0.11651166562561081,
+  0.11888861344290999, 0.12127680548479022, 0.12367622820159656, 0.12608687022018586,
+  0.12850872227999954, 0.13094177717364433, 0.13338602969166913, 0.13584147657125373,
+  0.13830811644855073, 0.1407859498144447, 0.14327497897351343, 0.14577520800599406,
+  0.14828664273257455, 0.1508092906818457, 0.15334316106026286, 0.15588826472447923,
+  0.15844461415592431, 0.16101222343751109, 0.16359110823236572, 0.16618128576448207,
+  0.16878277480121151, 0.17139559563750595, 0.17401977008183878, 0.176655321443735,
+  0.17930227452284767, 0.18196065559952257, 0.18463049242679927, 0.18731181422380028,
+  0.19000465167046499, 0.19270903690358915, 0.19542500351413428, 0.19815258654577514,
+  0.20089182249465659, 0.20364274931033488, 0.20640540639788074, 0.20917983462112502,
+  0.21196607630703018, 0.21476417525117361, 0.21757417672433116, 0.22039612748015197,
+  0.22323007576391746, 0.22607607132238022, 0.22893416541468026, 0.23180441082433861,
+  0.23468686187232993, 0.23758157443123798, 0.24048860594050042, 0.24340801542275015,
+  0.24633986350126366, 0.24928421241852827, 0.25224112605594196, 0.25521066995466168,
+  0.25819291133761896, 0.26118791913272088, 0.2641957639972608, 0.26721651834356114,
+  0.27025025636587524, 0.27329705406857691, 0.2763569892956681, 0.27943014176163777,
+  0.28251659308370747, 0.28561642681550159, 0.28872972848218276, 0.29185658561709504,
+  0.2949970877999617, 0.29815132669668537, 0.30131939610080294, 0.30450139197664983,
+  0.30769741250429195, 0.31090755812628634, 0.31413193159633712, 0.3173706380299135,
+  0.32062378495690536, 0.32389148237639109, 0.32717384281360135, 0.33047098137916342,
+  0.33378301583071829, 0.33711006663700593, 0.3404522570445217, 0.3438097131468506,
+  0.34718256395679353, 0.35057094148140594, 0.35397498080007661, 0.35739482014578028,
+  0.36083060098964781, 0.36428246812900378, 0.36775056977903231, 0.37123505766823928,
+  0.37473608713789092, 0.37825381724561896, 0.38178841087339344, 0.38534003484007712,
+  0.3889088600187886, 0.3924950614593154, 0.39609881851583223, 0.39972031498019706,
+  0.40335973922111434, 0.40701728432947321, 0.41069314827018805, 0.41438753404089096,
+  0.418100649837848, 0.42183270922949578, 0.42558393133802186, 0.42935454102944132,
+  0.43314476911265215, 0.43695485254798538, 0.44078503466580382, 0.44463556539573917,
+  0.44850670150720279, 0.4523987068618483, 0.45631185267871616, 0.46024641781284253,
+  0.46420268904817402, 0.46818096140569326, 0.47218153846772981, 0.47620473271950553,
+  0.48025086590904648, 0.48432026942668294, 0.48841328470545764, 0.4925302636438682,
+  0.49667156905248938, 0.50083757512614846, 0.5050286679434679, 0.50924524599574761,
+  0.51348772074732663, 0.51775651722975591, 0.52205207467232151, 0.52637484717168403,
+  0.53072530440366161, 0.53510393238045717, 0.53951123425695169, 0.54394773119002582,
+  0.54841396325526548, 0.55291049042583196, 0.55743789361876561, 0.56199677581452401,
+  0.566587763256164, 0.57121150673525278, 0.57586868297235327, 0.58055999610079045,
+  0.5852861792633709, 0.59004799633282545, 0.594846243767987, 0.59968175261912493,
+  0.60455539069746744, 0.6094680649257731, 0.61442072388891356, 0.6194143606058341,
+  0.62445001554702617, 0.62952877992483636, 0.63465179928762327, 0.63982027745305625,
+  0.64503548082082207, 0.65029874311081648, 0.65561147057969704, 0.66097514777666289,
+  0.66639134390874988, 0.67186171989708177, 0.67738803621877308, 0.68297216164499441,
+  0.68861608300467136, 0.69432191612611638, 0.70009191813651128, 0.70592850133275387,
+  0.71183424887824809, 0.71781193263072163, 0.72386453346862978, 0.72999526456147579,
+  0.73620759812686232, 0.74250529634015072, 0.74889244721915649, 0.75537350650709578,
+  0.76195334683679494, 0.76863731579848582, 0.77543130498118673, 0.78234183265480206,
+  0.78937614356602415, 0.79654233042295863, 0.80384948317096394, 0.81130787431265594,
+  0.81892919160370203, 0.82672683394622104, 0.83471629298688321, 0.84291565311220396,
+  0.85134625845867773, 0.8600336211963312, 0.86900868803685671, 0.87830965580891707,
+  0.88798466075583304, 0.89809592189834309, 0.90872644005213055, 0.91999150503934668,
+  0.93206007595923013, 0.94519895344229932, 0.95987909180010633, 0.97710170126767126,
+  1,
+};
+
+_CCCL_GLOBAL_CONSTANT double __ziggurat_exponential_x[] = {
+  8.6971174701310492, 7.6971174701310501, 6.9410336293772126, 6.4783784938325697,
+  6.1441646657724727, 5.8821443157953999, 5.6664101674540337, 5.4828906275260625,
+  5.3230905057543989, 5.1814872813015009, 5.054288489981305, 4.9387770859012514,
+  4.8329397410251129, 4.7352429966017411, 4.6444918854200852, 4.5597370617073514,
+  4.4802117465284219, 4.4052876934735732, 4.334443680317273, 4.2672424802773659,
+  4.2033137137351844, 4.1423408656640515, 4.0840513104082978, 4.0282085446479368,
+  3.9746060666737884, 3.9230625001354897, 3.8734176703995091, 3.8255294185223367,
+  3.7792709924116679, 3.7345288940397974, 3.6912010902374188, 3.6491955157608538,
+  3.6084288131289095, 3.5688252656483375, 3.5303158891293438, 3.4928376547740601,
+  3.4563328211327606, 3.4207483572511204, 3.3860354424603019, 3.3521490309001098,
+  3.3190474709707489, 3.2866921715990691, 3.2550473085704503, 3.2240795652862646,
+  3.1937579032122407, 3.1640533580259733, 3.1349388580844408, 3.1063890623398245,
+  3.0783802152540907, 3.0508900166154556, 3.0238975044556766, 2.9973829495161306,
+  2.9713277599210897, 2.9457143948950457, 2.9205262865127408, 2.8957477686001418,
+  2.8713640120155364, 2.8473609656351888, 2.8237253024500353, 2.8004443702507382,
+  2.777506146439757, 2.7548991965623455, 2.732612636194701, 2.7106360958679292,
+  2.6889596887418041, 2.667573980773267, 2.6464699631518096, 2.6256390267977885,
+  2.6050729387408356, 2.5847638202141408, 2.5647041263169053, 2.54488662711187,
+  2.525304390037828, 2.505950763528594, 2.4868193617402099, 2.4679040502973648,
+  2.4491989329782498, 2.4306983392644197, 2.4123968126888706, 2.3942890999214583,
+  2.376370140536141, 2.3586350574093373, 2.3410791477030348, 2.3236978743901964,
+  2.3064868582835798, 2.2894418705322694, 2.2725588255531548, 2.2558337743672192,
+  2.2392628983129086, 2.2228425031110364, 2.2065690132576634, 2.19043896672322,
+  2.1744490099377747, 2.1585958930438855, 2.1428764653998416, 2.1272876713173678,
+  2.1118265460190417, 2.0964902118017146, 2.0812758743932247, 2.0661808194905755,
+  2.0512024094685848, 2.0363380802487696, 2.0215853383189262, 2.0069417578945181,
+  1.9924049782135764, 1.9779727009573602, 1.9636426877895481, 1.9494127580071845,
+  1.9352807862970511, 1.9212447005915276, 1.9073024800183871, 1.8934521529393078,
+  1.8796917950722107, 1.8660195276928275, 1.8524335159111751, 1.8389319670188793,
+  1.8255131289035191, 1.8121752885263902, 1.7989167704602904, 1.7857359354841253,
+  1.772631179231305, 1.7596009308890743, 1.746643651946074, 1.7337578349855711,
+  1.7209420025219351, 1.7081947058780576, 1.6955145241015377, 1.6829000629175537,
+  1.6703499537164519, 1.6578628525741725, 1.6454374393037234, 1.6330724165359911,
+  1.6207665088282577, 1.6085184617988582, 1.5963270412864832, 1.5841910325326887,
+  1.5721092393862295, 1.5600804835278879, 1.5481036037145133, 1.5361774550410319,
+  1.524300908219226, 1.5124728488721169, 1.5006921768428165, 1.4889578055167456,
+  1.4772686611561334, 1.4656236822457451, 1.4540218188487932, 1.4424620319720123,
+  1.4309432929388795, 1.4194645827699828, 1.4080248915695353, 1.3966232179170417,
+  1.3852585682631218, 1.3739299563284901, 1.3626364025050866, 1.351376933258335,
+  1.3401505805295046, 1.3289563811371163, 1.3177933761763245, 1.3066606104151739,
+  1.2955571316866008, 1.2844819902750126, 1.2734342382962411, 1.2624129290696153,
+  1.2514171164808525, 1.2404458543344064, 1.2294981956938491, 1.2185731922087903,
+  1.2076698934267613, 1.1967873460884031, 1.1859245934042024, 1.1750806743109117,
+  1.1642546227056791, 1.1534454666557747, 1.1426522275816728, 1.1318739194110787,
+  1.1211095477013306, 1.1103581087274115, 1.0996185885325978, 1.0888899619385473,
+  1.0781711915113728, 1.0674612264799681, 1.0567590016025519, 1.0460634359770447,
+  1.035373431790529, 1.0246878730026179, 1.0140056239570971, 1.0033255279156974,
+  0.99264640550727645, 0.98196705308506316, 0.97128624098390393, 0.96060271166866706,
+  0.94991517776407663, 0.93922231995526295, 0.92852278474721117, 0.91781518207004498,
+  0.90709808271569103, 0.89637001558989071, 0.88562946476175231, 0.87487486629102584,
+  0.86410460481100515, 0.85331700984237402, 0.84251035181036926, 0.83168283773427387,
+  0.82083260655441248, 0.80995772405741906, 0.79905617735548784, 0.78812586886949321,
+  0.77716460975913049, 0.76617011273543545, 0.75513998418198292, 0.74407171550050877,
+  0.73296267358436606, 0.72181009030875687, 0.71061105090965571, 0.69936248110323262,
+  0.68806113277374858, 0.67670356802952336, 0.66528614139267861, 0.65380497984766561,
+  0.64225596042453703, 0.63063468493349095, 0.61893645139487674, 0.60715622162030081,
+  0.59528858429150355, 0.58332771274877027, 0.571267316532589, 0.55910058551154129,
+  0.54682012516331113, 0.53441788123716616, 0.52188505159213561, 0.50921198244365495,
+  0.49638804551867161, 0.48340149165346225, 0.47023927508216945, 0.45688684093142073,
+  0.44332786607355296, 0.42954394022541131, 0.41551416960035698, 0.40121467889627838,
+  0.38661797794112024, 0.37169214532991784, 0.35639976025839443, 0.34069648106484979,
+  0.32452911701691006, 0.30783295467493288, 0.29052795549123117, 0.27251318547846548,
+  0.25365836338591286, 0.23379048305967554, 0.21267151063096745, 0.18995868962243279,
+  0.16512762256418831, 0.13730498094001381, 0.10483850756582018, 0.063852163815003485,
+  0,
+};
+
+_CCCL_GLOBAL_CONSTANT double __ziggurat_exponential_f[] = {
+  0.00016706669230796389, 0.00045413435384149677, 0.00096726928232717454, 0.0015362997803015724,
+  0.0021459677437189063, 0.0027887987935740761, 0.003460264777836904, 0.0041572951208337953,
+  0.0048776559835423923, 0.005619642207205483, 0.0063819059373191791, 0.0071633531836349839,
+  0.00796307743801704, 0.0087803149858089753, 0.0096144136425022099, 0.010464810181029979,
+  0.011331013597834597, 0.012212592426255381, 0.013109164931254991, 0.014020391403181938,
+  0.014945968011691148, 0.015885621839973163, 0.016839106826039948, 0.017806200410911362,
+  0.01878670074469603, 0.019780424338009743, 0.020787204072578117, 0.021806887504283581,
+  0.02283933540638524, 0.023884420511558171, 0.024942026419731783, 0.026012046645134217,
+  0.0270943837809558, 0.028188948763978636, 0.029295660224637393, 0.030414443910466604,
+  0.031545232172893609, 0.032687963508959535, 0.03384258215087433, 0.03500903769739741,
+  0.036187284781931423, 0.037377282772959361, 0.038578995503074857, 0.039792391023374125,
+  0.041017441380414819, 0.042254122413316234, 0.043502413568888183, 0.044762297732943282,
+  0.04603376107617517, 0.047316792913181548, 0.048611385573379497, 0.049917534282706372,
+  0.051235237055126281, 0.052564494593071692, 0.053905310196046087, 0.055257689676697037,
+  0.056621641283742877, 0.057997175631200659, 0.059384305633420266, 0.060783046445479633,
+  0.062193415408540995, 0.063615431999807334, 0.065049117786753749, 0.066494496385339774,
+  0.067951593421936601, 0.069420436498728755, 0.070901055162371829, 0.072393480875708738,
+  0.073897746992364746, 0.07541388873405841, 0.076941943170480503, 0.078481949201606421,
+  0.080033947542319905, 0.081597980709237419, 0.083174093009632383, 0.084762330532368119,
+  0.086362741140756913, 0.087975374467270218, 0.089600281910032858, 0.091237516631040155,
+  0.092887133556043541, 0.094549189376055859, 0.096223742550432798, 0.097910853311492199,
+  0.099610583670637132, 0.10132299742595363, 0.10304816017125772, 0.10478613930657017,
+  0.10653700405000166, 0.1083008254510338, 0.11007767640518538, 0.1118676316700563,
+  0.11367076788274431, 0.11548716357863353, 0.11731689921155557, 0.11916005717532768,
+  0.12101672182667483, 0.12288697950954514, 0.12477091858083096, 0.12666862943751067,
+  0.12858020454522817, 0.13050573846833077, 0.13244532790138752, 0.13439907170221363,
+  0.13636707092642886, 0.1383494288635802, 0.14034625107486245, 0.1423576454324722,
+  0.14438372216063478, 0.14642459387834494, 0.14848037564386679, 0.15055118500103989,
+  0.15263714202744286, 0.15473836938446808, 0.15685499236936523, 0.15898713896931421,
+  0.16113493991759203, 0.16329852875190182, 0.165478041874936, 0.16767361861725019,
+  0.16988540130252766, 0.17211353531532006, 0.17435816917135349, 0.17661945459049488,
+  0.17889754657247831, 0.18119260347549629, 0.18350478709776746, 0.18583426276219711,
+  0.18818119940425432, 0.19054576966319539, 0.19292814997677135, 0.19532852067956322,
+  0.19774706610509887, 0.20018397469191127, 0.20263943909370902, 0.20511365629383771,
+  0.20760682772422204, 0.21011915938898826, 0.21265086199297828, 0.21520215107537868,
+  0.21777324714870053, 0.22036437584335949, 0.22297576805812019, 0.22560766011668407,
+  0.2282602939307167, 0.23093391716962741, 0.23362878343743335, 0.23634515245705964,
+  0.23908329026244918, 0.24184346939887721, 0.24462596913189211, 0.24743107566532763,
+  0.2502590823688623, 0.25311029001562946, 0.25598500703041538, 0.25888354974901623,
+  0.26180624268936298, 0.2647534188350622, 0.26772541993204479, 0.27072259679906002,
+  0.27374530965280297, 0.27679392844851736, 0.27986883323697292, 0.28297041453878075,
+  0.28609907373707683, 0.28925522348967775, 0.29243928816189257, 0.2956517042812612,
+  0.29889292101558179, 0.30216340067569353, 0.30546361924459026, 0.30879406693456019,
+  0.31215524877417955, 0.31554768522712895, 0.31897191284495724, 0.32242848495608917,
+  0.32591797239355619, 0.32944096426413633, 0.33299806876180899, 0.33658991402867761,
+  0.34021714906678002, 0.34388044470450241, 0.34758049462163698, 0.35131801643748334,
+  0.35509375286678746, 0.35890847294874978, 0.36276297335481777, 0.36665807978151416,
+  0.370594648435146, 0.37457356761590216, 0.37859575940958079, 0.38266218149600983,
+  0.38677382908413765, 0.39093173698479711, 0.39513698183329016, 0.39939068447523107,
+  0.40369401253053028, 0.4080481831520324, 0.41245446599716118, 0.41691418643300288,
+  0.42142872899761658, 0.42599954114303434, 0.43062813728845883, 0.43531610321563657,
+  0.4400651008423539, 0.44487687341454851, 0.449753251162755, 0.4546961574746155,
+  0.45970761564213769, 0.46478975625042618, 0.46994482528395998, 0.47517519303737737,
+  0.48048336393045421, 0.48587198734188491, 0.49134386959403253, 0.49690198724154955,
+  0.50254950184134772, 0.50828977641064288, 0.51412639381474856, 0.5200631773682336,
+  0.52610421398361973, 0.53225388026304332, 0.53851687200286191, 0.54489823767243961,
+  0.55140341654064129, 0.55803828226258745, 0.56480919291240017, 0.57172304866482582,
+  0.57878735860284503, 0.58601031847726803, 0.59340090169173343, 0.60096896636523223,
+  0.60872538207962201, 0.61668218091520766, 0.62485273870366598, 0.63325199421436607,
+  0.64189671642726609, 0.6508058334145711, 0.6600008410789997, 0.66950631673192473,
+  0.67935057226476536, 0.68956649611707799, 0.70019265508278816, 0.71127476080507601,
+  0.72286765959357202, 0.73503809243142348, 0.7478686219851951, 0.76146338884989628,
+  0.77595685204011555, 0.79152763697249562, 0.80842165152300838, 0.82699329664305032,
+  0.84778550062398961, 0.87170433238120359, 0.90046992992574648, 0.9381436808621747,
+  1,
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_ZIGGURAT_TABLES_H
@@ -36,9 +36,14 @@ struct __fixed_size; // internal ABI tag
 template <__simd_size_type _Np>
 using fixed_size = __fixed_size<_Np>; // implementation-defined ABI
 
-// TODO(fbusato): this could be optimized by using max access size / sizeof(T)
-template <typename>
-using native = fixed_size<1>; // implementation-defined ABI
+// The native ABI fills the vector registers of the host ISA, see _CCCL_SIMD_HOST_VECTOR_BYTES()
+// TODO(fbusato): this could be optimized by using max access size / sizeof(T) on device
+template <typename _Tp>
+inline constexpr __simd_size_type __native_simd_size_v =
+  (_CCCL_SIMD_HOST_VECTOR_BYTES() > sizeof(_Tp)) ? _CCCL_SIMD_HOST_VECTOR_BYTES() / sizeof(_Tp) : 1;
+
+template <typename _Tp>
+using native = fixed_size<__native_simd_size_v<_Tp>>; // implementation-defined ABI
 
 template <typename, __simd_size_type _Np>
 using __deduce_abi_t = fixed_size<_Np>; // exposition-only
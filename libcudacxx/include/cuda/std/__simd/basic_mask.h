@@ -353,11 +353,27 @@ public:
     return !__lhs && __rhs;
   }
 
-  // TODO(fbusato): [simd.mask.cond], basic_mask exposition only conditional operators
-  // friend constexpr basic_mask __simd_select_impl(
-  //   const basic_mask&, const basic_mask&, const basic_mask&) noexcept;
-  // friend constexpr basic_mask __simd_select_impl(
-  //   const basic_mask&, same_as<bool> auto, same_as<bool> auto) noexcept;
+  // [simd.mask.cond], basic_mask exposition only conditional operators
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr basic_mask
+  __simd_select_impl(const basic_mask& __mask, const basic_mask& __lhs, const basic_mask& __rhs) noexcept
+  {
+    return (__mask && __lhs) || (!__mask && __rhs);
+  }
+
+  _CCCL_TEMPLATE(typename _Up)
+  _CCCL_REQUIRES(same_as<_Up, bool>)
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr basic_mask
+  __simd_select_impl(const basic_mask& __mask, const _Up __lhs, const _Up __rhs) noexcept
+  {
+    if (__lhs == __rhs)
+    {
+      return basic_mask(__lhs);
+    }
+    return __lhs ? __mask : !__mask;
+  }
+
+  // TODO(fbusato): select between scalars, requires the common type of T0 and T1
   // template<class T0, class T1>
   //   friend constexpr vec<see below, size()> __simd_select_impl(
   //     const basic_mask&, const T0&, const T1&) noexcept;
@@ -34,6 +34,7 @@
 #include <cuda/std/__simd/flag.h>
 #include <cuda/std/__simd/iterator.h>
 #include <cuda/std/__simd/specializations/fixed_size_float_vec.h>
+#include <cuda/std/__simd/specializations/fixed_size_host_vec.h>
 #include <cuda/std/__simd/specializations/fixed_size_vec.h>
 #include <cuda/std/__simd/type_traits.h>
 #include <cuda/std/__simd/utility.h>
@@ -107,6 +108,10 @@ private:
   _CCCL_HOST_DEVICE_API friend constexpr _Result
   __full_load_from_ptr(const _Up*, const typename _Result::mask_type&, flags<_Flags...>) noexcept;
 
+  template <typename _Vp, typename _Ap, typename _Up, typename... _Flags>
+  _CCCL_HOST_DEVICE_API friend constexpr void
+  __full_store_to_ptr(const basic_vec<_Vp, _Ap>&, _Up*, flags<_Flags...>) noexcept;
+
   using _Impl    = __simd_operations<_Tp, _Abi>;
   using _Storage = typename _Impl::_SimdStorage;
 
@@ -127,6 +132,12 @@ private:
     return mask_type{__s, mask_type::__storage_tag};
   }
 
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr const typename mask_type::_Storage&
+  __get_mask_storage(const mask_type& __mask) noexcept
+  {
+    return __mask.__s_;
+  }
+
   // operator[] is const only. We need this function to set values
   _CCCL_HOST_DEVICE_API constexpr void __set(const __simd_size_type __i, const value_type __v) noexcept
   {
@@ -725,9 +736,13 @@ public:
     return __make_mask(_Impl::__less(__lhs.__s_, __rhs.__s_));
   }
 
-  // TODO(fbusato): [simd.cond], basic_vec exposition-only conditional operators
-  // friend constexpr basic_vec __simd_select_impl(
-  //   const mask_type&, const basic_vec&, const basic_vec&) noexcept;
+  // [simd.cond], basic_vec exposition-only conditional operators
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr basic_vec
+  __simd_select_impl(const mask_type& __mask, const basic_vec& __lhs, const basic_vec& __rhs) noexcept
+  {
+    return basic_vec{_Impl::__select(__get_mask_storage(__mask), __lhs.__s_, __rhs.__s_), __storage_tag};
+  }
 };
 
 // [simd.ctor] deduction guide from contiguous sized range
@@ -40,10 +40,13 @@
 #include <cuda/std/__simd/concepts.h>
 #include <cuda/std/__simd/flag.h>
 #include <cuda/std/__simd/utility.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__type_traits/remove_cvref.h>
 #include <cuda/std/__utility/cmp.h>
 #include <cuda/std/__utility/forward.h>
 
+#include <nv/target>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
@@ -87,6 +90,21 @@ template <typename _Result, typename _Up, typename... _Flags>
   ::cuda::std::simd::__check_load_preconditions<_Result>(__ptr, __flags, __count);
   constexpr auto __simd_size = _Result::__size;
 
+  // Without conversion, a range that covers the whole vector is loaded at once and the masked off elements are cleared
+  if constexpr (is_same_v<_Up, __value_t>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     if (__count >= __simd_size)
+                     {
+                       const _Result __values{_Result::_Impl::__load(__ptr), _Result::__storage_tag};
+                       return __simd_select_impl(__mask, __values, _Result{});
+                     }
+                   }))
+    }
+  }
+
   _Result __result;
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 0; __i < __simd_size; ++__i)
@@ -108,6 +126,13 @@ __full_load_from_ptr(const _Up* __ptr, const typename _Result::mask_type& __mask
   {
     _CCCL_IF_NOT_CONSTEVAL_DEFAULT
     {
+      // the host loads elements without conversion into its vector registers, see __partial_load_from_ptr
+      if constexpr (is_same_v<_Up, typename _Result::value_type>)
+      {
+        NV_IF_TARGET(NV_IS_HOST,
+                     (return ::cuda::std::simd::__partial_load_from_ptr<_Result>(
+                               __ptr, _Result::__size, __mask, __flags);))
+      }
       // minimum condition for pointer alignment
       constexpr auto __base_alignment = __has_aligned_flag ? alignment_v<_Result, _Up> : alignof(_Up);
       constexpr auto __ptr_alignment  = ::cuda::std::max(__base_alignment, __overaligned_value_v<_Flags...>);
@@ -33,10 +33,13 @@
 #include <cuda/std/__simd/abi.h>
 #include <cuda/std/__simd/basic_mask.h>
 #include <cuda/std/__simd/basic_vec.h>
+#include <cuda/std/__simd/specializations/fixed_size_host_vec.h>
 #include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/type_identity.h>
 #include <cuda/std/__utility/declval.h>
 
+#include <nv/target>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
@@ -84,6 +87,24 @@ template <typename _Tp, typename _BinaryOp>
   }
 }
 
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+// Reduces the elements of __x in the vector registers of the host. __op must be applicable to vector registers, i.e. a
+// transparent operation.
+template <typename _Tp, typename _Abi, typename _Op>
+[[nodiscard]] _CCCL_HOST_API _Tp __host_reduce(const basic_vec<_Tp, _Abi>& __x, _Op __op) noexcept
+{
+  constexpr auto __size = basic_vec<_Tp, _Abi>::__size;
+  _Tp __data[__size];
+  for (__simd_size_type __i = 0; __i < __size; ++__i)
+  {
+    __data[__i] = __x[__i];
+  }
+  return ::cuda::std::simd::__host_vector_reduce<_Tp, __size>(__data, __op);
+}
+
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
 // [simd.reductions], reduce
 
 _CCCL_TEMPLATE(typename _Tp, typename _Abi, typename _BinaryOperation = plus<>)
@@ -92,6 +113,17 @@ _CCCL_REQUIRES(__reduction_binary_operation<_BinaryOperation, _Tp>)
 reduce(const basic_vec<_Tp, _Abi>& __x,
        _BinaryOperation __binary_op = {}) noexcept(__is_nothrow_reduction_binary_operation_v<_BinaryOperation, _Tp>)
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  // The default supported operations are transparent, so they apply to vector registers as well
+  if constexpr (__has_host_vector_v<_Tp, __simd_size_v<_Tp, _Abi>>
+                && __is_reduce_default_supported_operation_v<_BinaryOperation>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_reduce(__x, __binary_op);))
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   vec<_Tp, 1> __result{__x[0]};
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
@@ -143,6 +175,16 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi)
 _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp reduce_min(const basic_vec<_Tp, _Abi>& __x) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__has_host_vector_v<_Tp, __simd_size_v<_Tp, _Abi>>)
+  {
+    using __traits = __host_vector_traits<_Tp, __simd_size_v<_Tp, _Abi>>;
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_reduce(__x, __host_vector_min<__traits>{});))
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   auto __result = __x[0];
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
@@ -183,6 +225,16 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi)
 _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp reduce_max(const basic_vec<_Tp, _Abi>& __x) noexcept
 {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+  if constexpr (__has_host_vector_v<_Tp, __simd_size_v<_Tp, _Abi>>)
+  {
+    using __traits = __host_vector_traits<_Tp, __simd_size_v<_Tp, _Abi>>;
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_reduce(__x, __host_vector_max<__traits>{});))
+    }
+  }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
   auto __result = __x[0];
   _CCCL_PRAGMA_UNROLL_FULL()
   for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
@@ -23,6 +23,7 @@
 
 #if _CCCL_HAS_SIMD_F32X2()
 
+#  include <cuda/std/__simd/specializations/fixed_size_host_vec.h>
 #  include <cuda/std/__simd/specializations/fixed_size_vec.h>
 #  include <cuda/std/__simd/specializations/fp32x2_intrinsics.h>
 
@@ -34,12 +35,13 @@ template <__simd_size_type _Np>
 inline constexpr __simd_operations_kind __simd_operations_kind_v<float, __fixed_size<_Np>> =
   (_Np >= 2) ? __simd_operations_kind::__fixed_size_float : __simd_operations_kind::__default;
 
-// Simd operations for fixed_size ABI with float elements and F32x2 fast paths.
+// Simd operations for fixed_size ABI with float elements and F32x2 fast paths. Host code uses the host vector
+// operations if the vector fills a vector register.
 template <__simd_size_type _Np>
 struct __simd_operations<float, __fixed_size<_Np>, __simd_operations_kind::__fixed_size_float>
-    : __fixed_size_operations<float, _Np>
+    : __fixed_size_host_operations_t<float, _Np>
 {
-  using __base       = __fixed_size_operations<float, _Np>;
+  using __base       = __fixed_size_host_operations_t<float, _Np>;
   using _SimdStorage = __simd_storage<float, __fixed_size<_Np>>;
 
   _CCCL_HOST_DEVICE_API static constexpr void __increment(_SimdStorage& __s) noexcept
@@ -0,0 +1,493 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___SIMD_SPECIALIZATIONS_FIXED_SIZE_HOST_VEC_H
+#define _CUDA_STD___SIMD_SPECIALIZATIONS_FIXED_SIZE_HOST_VEC_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__simd/specializations/fixed_size_vec.h>
+#include <cuda/std/__simd/specializations/host_vector.h>
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+#  include <cuda/std/__cstring/memcpy.h>
+#  include <cuda/std/__functional/operations.h>
+#  include <cuda/std/__fwd/simd.h>
+#  include <cuda/std/__type_traits/conditional.h>
+#  include <cuda/std/__type_traits/is_floating_point.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+
+#  include <nv/target>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+// The result of a vector comparison has all bits of a lane set or cleared, which is the layout of the mask lanes
+template <typename _Tp, __simd_size_type _Np, typename _Lane, typename _Op>
+_CCCL_HOST_API void __host_vector_compare(const _Tp* __lhs, const _Tp* __rhs, _Lane* __result, _Op __op) noexcept
+{
+  static_assert(sizeof(_Lane) == sizeof(_Tp), "The mask lanes must have the size of the elements");
+  using __traits = __host_vector_traits<_Tp, _Np>;
+  for (__simd_size_type __i = 0; __i < __traits::__vector_end; __i += __traits::__lanes)
+  {
+    const auto __mask = __op(__traits::__load(__lhs + __i), __traits::__load(__rhs + __i));
+    ::cuda::std::memcpy(__result + __i, &__mask, sizeof(__mask));
+  }
+  for (__simd_size_type __i = __traits::__vector_end; __i < _Np; ++__i)
+  {
+    __result[__i] = __op(__lhs[__i], __rhs[__i]) ? static_cast<_Lane>(-1) : _Lane{};
+  }
+}
+
+template <typename _Tp, __simd_size_type _Np, typename _Lane>
+_CCCL_HOST_API void
+__host_vector_select(const _Lane* __mask, const _Tp* __lhs, const _Tp* __rhs, _Tp* __result) noexcept
+{
+  using __traits      = __host_vector_traits<_Tp, _Np>;
+  using __mask_traits = __host_vector_traits<_Lane, _Np>;
+  for (__simd_size_type __i = 0; __i < __traits::__vector_end; __i += __traits::__lanes)
+  {
+    __traits::__store(
+      __result + __i,
+      __traits::__select(
+        __mask_traits::__load(__mask + __i), __traits::__load(__lhs + __i), __traits::__load(__rhs + __i)));
+  }
+  for (__simd_size_type __i = __traits::__vector_end; __i < _Np; ++__i)
+  {
+    __result[__i] = __mask[__i] ? __lhs[__i] : __rhs[__i];
+  }
+}
+
+template <typename _Traits>
+struct __host_vector_min
+{
+  using __vector_t  = typename _Traits::__vector_t;
+  using __element_t = typename _Traits::__element_t;
+
+  [[nodiscard]] _CCCL_HOST_API __vector_t operator()(const __vector_t __lhs, const __vector_t __rhs) const noexcept
+  {
+    return _Traits::__select(__rhs < __lhs, __rhs, __lhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API __element_t operator()(const __element_t __lhs, const __element_t __rhs) const noexcept
+  {
+    return (__rhs < __lhs) ? __rhs : __lhs;
+  }
+};
+
+template <typename _Traits>
+struct __host_vector_max
+{
+  using __vector_t  = typename _Traits::__vector_t;
+  using __element_t = typename _Traits::__element_t;
+
+  [[nodiscard]] _CCCL_HOST_API __vector_t operator()(const __vector_t __lhs, const __vector_t __rhs) const noexcept
+  {
+    return _Traits::__select(__lhs < __rhs, __rhs, __lhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API __element_t operator()(const __element_t __lhs, const __element_t __rhs) const noexcept
+  {
+    return (__lhs < __rhs) ? __rhs : __lhs;
+  }
+};
+
+// Combines all elements with an associative and commutative operation. Whole registers are combined first, then the
+// lanes of the accumulated register and finally the remaining elements.
+template <typename _Tp, __simd_size_type _Np, typename _Op>
+[[nodiscard]] _CCCL_HOST_API _Tp __host_vector_reduce(const _Tp* __data, _Op __op) noexcept
+{
+  using __traits    = __host_vector_traits<_Tp, _Np>;
+  using __element_t = typename __traits::__element_t;
+  auto __acc        = __traits::__load(__data);
+  for (__simd_size_type __i = __traits::__lanes; __i < __traits::__vector_end; __i += __traits::__lanes)
+  {
+    __acc = __op(__acc, __traits::__load(__data + __i));
+  }
+  __element_t __lanes[__traits::__lanes];
+  ::cuda::std::memcpy(__lanes, &__acc, sizeof(__acc));
+  __element_t __result = __lanes[0];
+  for (__simd_size_type __lane = 1; __lane < __traits::__lanes; ++__lane)
+  {
+    __result = static_cast<__element_t>(__op(__result, __lanes[__lane]));
+  }
+  for (__simd_size_type __i = __traits::__vector_end; __i < _Np; ++__i)
+  {
+    __result = static_cast<__element_t>(__op(__result, static_cast<__element_t>(__data[__i])));
+  }
+  return static_cast<_Tp>(__result);
+}
+
+// Simd operations for fixed_size ABI that use the vector registers of the host in host code
+template <typename _Tp, __simd_size_type _Np>
+struct __fixed_size_host_operations : __fixed_size_operations<_Tp, _Np>
+{
+  using __base       = __fixed_size_operations<_Tp, _Np>;
+  using _SimdStorage = __simd_storage<_Tp, __fixed_size<_Np>>;
+  using _MaskStorage = __mask_storage<sizeof(_Tp), __fixed_size<_Np>>;
+
+private:
+  struct __shift_left_op
+  {
+    template <typename _Up>
+    [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __lhs, const _Up __rhs) const noexcept
+    {
+      return __lhs << __rhs;
+    }
+  };
+
+  struct __shift_right_op
+  {
+    template <typename _Up>
+    [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up __lhs, const _Up __rhs) const noexcept
+    {
+      return __lhs >> __rhs;
+    }
+  };
+
+  template <typename _Op>
+  [[nodiscard]] _CCCL_HOST_API static _SimdStorage __host_unary(const _SimdStorage& __s, _Op __op) noexcept
+  {
+    _SimdStorage __result;
+    ::cuda::std::simd::__host_vector_unary<_Tp, _Np>(__s.__data, __result.__data, __op);
+    return __result;
+  }
+
+  template <typename _Op>
+  [[nodiscard]] _CCCL_HOST_API static _SimdStorage
+  __host_binary(const _SimdStorage& __lhs, const _SimdStorage& __rhs, _Op __op) noexcept
+  {
+    _SimdStorage __result;
+    ::cuda::std::simd::__host_vector_binary<_Tp, _Np>(__lhs.__data, __rhs.__data, __result.__data, __op);
+    return __result;
+  }
+
+  template <typename _Op>
+  [[nodiscard]] _CCCL_HOST_API static _MaskStorage
+  __host_compare(const _SimdStorage& __lhs, const _SimdStorage& __rhs, _Op __op) noexcept
+  {
+    _MaskStorage __result;
+    ::cuda::std::simd::__host_vector_compare<_Tp, _Np>(__lhs.__data, __rhs.__data, __result.__data, __op);
+    return __result;
+  }
+
+public:
+  // Unary operations
+
+  _CCCL_HOST_DEVICE_API static constexpr void __increment(_SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     __s = __host_binary(__s, __base::__broadcast(_Tp(1)), ::cuda::std::plus<>{});
+                     return;
+                   }))
+    }
+    __base::__increment(__s);
+  }
+
+  _CCCL_HOST_DEVICE_API static constexpr void __decrement(_SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     __s = __host_binary(__s, __base::__broadcast(_Tp(1)), ::cuda::std::minus<>{});
+                     return;
+                   }))
+    }
+    __base::__decrement(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage __negate(const _SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return __host_compare(__s, __base::__broadcast(_Tp{}), ::cuda::std::equal_to<>{});))
+    }
+    return __base::__negate(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage __bitwise_not(const _SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_unary(__s, ::cuda::std::bit_not<>{});))
+    }
+    return __base::__bitwise_not(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage __unary_minus(const _SimdStorage& __s) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_unary(__s, ::cuda::std::negate<>{});))
+    }
+    return __base::__unary_minus(__s);
+  }
+
+  // Binary arithmetic operations
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __plus(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::plus<>{});))
+    }
+    return __base::__plus(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __minus(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::minus<>{});))
+    }
+    return __base::__minus(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __multiplies(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::multiplies<>{});))
+    }
+    return __base::__multiplies(__lhs, __rhs);
+  }
+
+  // There are no vector instructions for integer division, so only floating-point division is done here
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __divides(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    if constexpr (is_floating_point_v<_Tp>)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::divides<>{});))
+      }
+    }
+    return __base::__divides(__lhs, __rhs);
+  }
+
+  // Comparison operations
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __equal_to(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_compare(__lhs, __rhs, ::cuda::std::equal_to<>{});))
+    }
+    return __base::__equal_to(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __not_equal_to(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_compare(__lhs, __rhs, ::cuda::std::not_equal_to<>{});))
+    }
+    return __base::__not_equal_to(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __less(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_compare(__lhs, __rhs, ::cuda::std::less<>{});))
+    }
+    return __base::__less(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __less_equal(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_compare(__lhs, __rhs, ::cuda::std::less_equal<>{});))
+    }
+    return __base::__less_equal(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __greater(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_compare(__lhs, __rhs, ::cuda::std::greater<>{});))
+    }
+    return __base::__greater(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __greater_equal(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_compare(__lhs, __rhs, ::cuda::std::greater_equal<>{});))
+    }
+    return __base::__greater_equal(__lhs, __rhs);
+  }
+
+  // Bitwise operations
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __bitwise_and(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::bit_and<>{});))
+    }
+    return __base::__bitwise_and(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __bitwise_or(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::bit_or<>{});))
+    }
+    return __base::__bitwise_or(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __bitwise_xor(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, ::cuda::std::bit_xor<>{});))
+    }
+    return __base::__bitwise_xor(__lhs, __rhs);
+  }
+
+  // Shifts of 8 and 16 bit elements are done on promoted integers, so they are left to the base implementation
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __shift_left(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    if constexpr (is_integral_v<_Tp> && sizeof(_Tp) >= 4)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, __shift_left_op{});))
+      }
+    }
+    return __base::__shift_left(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __shift_right(const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    if constexpr (is_integral_v<_Tp> && sizeof(_Tp) >= 4)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return __host_binary(__lhs, __rhs, __shift_right_op{});))
+      }
+    }
+    return __base::__shift_right(__lhs, __rhs);
+  }
+
+  // Conditional operation
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __select(const _MaskStorage& __mask, const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     _SimdStorage __result;
+                     ::cuda::std::simd::__host_vector_select<_Tp, _Np>(
+                       __mask.__data, __lhs.__data, __rhs.__data, __result.__data);
+                     return __result;
+                   }))
+    }
+    return __base::__select(__mask, __lhs, __rhs);
+  }
+
+  // Memory operations on _Np contiguous elements
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage __load(const _Tp* __ptr) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     _SimdStorage __result;
+                     ::cuda::std::memcpy(__result.__data, __ptr, sizeof(__result.__data));
+                     return __result;
+                   }))
+    }
+    return __base::__load(__ptr);
+  }
+
+  _CCCL_HOST_DEVICE_API static constexpr void __store(const _SimdStorage& __s, _Tp* __ptr) noexcept
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     ::cuda::std::memcpy(__ptr, __s.__data, sizeof(__s.__data));
+                     return;
+                   }))
+    }
+    __base::__store(__s, __ptr);
+  }
+};
+
+// Vectors that do not fill the narrowest vector register use the base operations
+template <typename _Tp, __simd_size_type _Np>
+using __fixed_size_host_operations_t = conditional_t<__has_host_vector_v<_Tp, _Np>, //
+                                                     __fixed_size_host_operations<_Tp, _Np>,
+                                                     __fixed_size_operations<_Tp, _Np>>;
+
+template <typename _Tp, __simd_size_type _Np>
+inline constexpr __simd_operations_kind __simd_operations_kind_v<_Tp, __fixed_size<_Np>> =
+  __has_host_vector_v<_Tp, _Np> ? __simd_operations_kind::__fixed_size_host : __simd_operations_kind::__default;
+
+template <typename _Tp, __simd_size_type _Np>
+struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_kind::__fixed_size_host>
+    : __fixed_size_host_operations<_Tp, _Np>
+{};
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+template <typename _Tp, __simd_size_type _Np>
+using __fixed_size_host_operations_t = __fixed_size_operations<_Tp, _Np>;
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // ^^^ !_CCCL_HAS_SIMD_HOST_VECTOR() ^^^
+
+#endif // _CUDA_STD___SIMD_SPECIALIZATIONS_FIXED_SIZE_HOST_VEC_H
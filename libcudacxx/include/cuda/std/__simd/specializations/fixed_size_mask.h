@@ -24,48 +24,98 @@
 #include <cuda/__utility/in_range.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__fwd/simd.h>
+#include <cuda/std/__functional/operations.h>
 #include <cuda/std/__simd/specializations/fixed_size_storage.h>
+#include <cuda/std/__simd/specializations/host_vector.h>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/make_nbit_int.h>
 #include <cuda/std/__utility/integer_sequence.h>
 
+#include <nv/target>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
 
-// Bool-per-element mask storage for fixed_size ABI
+// Masks of vectors that are processed in the vector registers of the host store every element as an unsigned integer
+// of the element size with all bits set or cleared, which is the layout of a vector comparison. Other masks store a
+// bool per element.
+template <size_t _Bytes, __simd_size_type _Np>
+using __mask_lane_t = conditional_t<__has_host_vector_mask_v<_Bytes, _Np>, __make_nbit_uint_t<_Bytes * 8>, bool>;
+
+// Lane-per-element mask storage for fixed_size ABI
 template <size_t _Bytes, __simd_size_type _Np>
 struct __mask_storage<_Bytes, __fixed_size<_Np>>
 {
+  using __lane_t = __mask_lane_t<_Bytes, _Np>;
+
   static constexpr size_t __element_bytes = _Bytes;
+  static constexpr __lane_t __true_lane   = static_cast<__lane_t>(-1);
 
-  bool __data[_Np]{};
+  __lane_t __data[_Np]{};
+
+  [[nodiscard]] _CCCL_API static constexpr __lane_t __to_lane(const bool __v) noexcept
+  {
+    return __v ? __true_lane : __lane_t{};
+  }
 
   [[nodiscard]] _CCCL_API constexpr bool __get(const __simd_size_type __idx) const noexcept
   {
     _CCCL_ASSERT(::cuda::in_range(__idx, __simd_size_type{0}, _Np), "Index is out of bounds");
-    return __data[__idx];
+    return __data[__idx] != __lane_t{};
   }
 
   _CCCL_HOST_DEVICE_API constexpr void __set(const __simd_size_type __idx, const bool __v) noexcept
   {
     _CCCL_ASSERT(::cuda::in_range(__idx, __simd_size_type{0}, _Np), "Index is out of bounds");
-    __data[__idx] = __v;
+    __data[__idx] = __to_lane(__v);
   }
 };
 
-// Mask operations for fixed_size ABI with bool-per-element storage
+// Mask operations for fixed_size ABI with lane-per-element storage. Since every lane has either all bits set or
+// cleared, the logical and bitwise operators are the same.
 template <size_t _Bytes, __simd_size_type _Np>
 struct __mask_operations<_Bytes, __fixed_size<_Np>>
 {
   using _MaskStorage = __mask_storage<_Bytes, __fixed_size<_Np>>;
+  using __lane_t     = typename _MaskStorage::__lane_t;
+
+private:
+  template <typename _Op>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
+  __binary(const _MaskStorage& __lhs, const _MaskStorage& __rhs, _Op __op) noexcept
+  {
+    _MaskStorage __result;
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    if constexpr (__has_host_vector_mask_v<_Bytes, _Np>)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, ({
+                       ::cuda::std::simd::__host_vector_binary<__lane_t, _Np>(
+                         __lhs.__data, __rhs.__data, __result.__data, __op);
+                       return __result;
+                     }))
+      }
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      __result.__data[__i] = static_cast<__lane_t>(__op(__lhs.__data[__i], __rhs.__data[__i]));
+    }
+    return __result;
+  }
 
+public:
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage __broadcast(const bool __v) noexcept
   {
     _MaskStorage __result;
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = __v;
+      __result.__data[__i] = _MaskStorage::__to_lane(__v);
     }
     return __result;
   }
@@ -76,10 +126,13 @@ struct __mask_operations<_Bytes, __fixed_size<_Np>>
   {
 #if _CCCL_STD_VER >= 2020
     _MaskStorage __result;
-    ((__result.__data[_Is] = static_cast<bool>(__g(integral_constant<__simd_size_type, _Is>()))), ...);
+    ((__result.__data[_Is] =
+        _MaskStorage::__to_lane(static_cast<bool>(__g(integral_constant<__simd_size_type, _Is>())))),
+     ...);
     return __result;
 #else // ^^^ C++20 ^^^ / vvv C++17 vvv
-    return _MaskStorage{{ static_cast<bool>(__g(integral_constant<__simd_size_type, _Is>()))... }};
+    return _MaskStorage{
+      {_MaskStorage::__to_lane(static_cast<bool>(__g(integral_constant<__simd_size_type, _Is>())))...}};
 #endif // _CCCL_STD_VER < 2020
   }
 
@@ -94,25 +147,13 @@ struct __mask_operations<_Bytes, __fixed_size<_Np>>
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
   __logic_and(const _MaskStorage& __lhs, const _MaskStorage& __rhs) noexcept
   {
-    _MaskStorage __result;
-    _CCCL_PRAGMA_UNROLL_FULL()
-    for (__simd_size_type __i = 0; __i < _Np; ++__i)
-    {
-      __result.__data[__i] = __lhs.__data[__i] && __rhs.__data[__i];
-    }
-    return __result;
+    return __binary(__lhs, __rhs, ::cuda::std::bit_and<>{});
   }
 
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
   __logic_or(const _MaskStorage& __lhs, const _MaskStorage& __rhs) noexcept
   {
-    _MaskStorage __result;
-    _CCCL_PRAGMA_UNROLL_FULL()
-    for (__simd_size_type __i = 0; __i < _Np; ++__i)
-    {
-      __result.__data[__i] = __lhs.__data[__i] || __rhs.__data[__i];
-    }
-    return __result;
+    return __binary(__lhs, __rhs, ::cuda::std::bit_or<>{});
   }
 
   // Bitwise operators (for operator&, operator|, operator^)
@@ -120,48 +161,24 @@ struct __mask_operations<_Bytes, __fixed_size<_Np>>
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
   __bitwise_and(const _MaskStorage& __lhs, const _MaskStorage& __rhs) noexcept
   {
-    _MaskStorage __result;
-    _CCCL_PRAGMA_UNROLL_FULL()
-    for (__simd_size_type __i = 0; __i < _Np; ++__i)
-    {
-      __result.__data[__i] = __lhs.__data[__i] && __rhs.__data[__i];
-    }
-    return __result;
+    return __binary(__lhs, __rhs, ::cuda::std::bit_and<>{});
   }
 
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
   __bitwise_or(const _MaskStorage& __lhs, const _MaskStorage& __rhs) noexcept
   {
-    _MaskStorage __result;
-    _CCCL_PRAGMA_UNROLL_FULL()
-    for (__simd_size_type __i = 0; __i < _Np; ++__i)
-    {
-      __result.__data[__i] = __lhs.__data[__i] || __rhs.__data[__i];
-    }
-    return __result;
+    return __binary(__lhs, __rhs, ::cuda::std::bit_or<>{});
   }
 
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage
   __bitwise_xor(const _MaskStorage& __lhs, const _MaskStorage& __rhs) noexcept
   {
-    _MaskStorage __result;
-    _CCCL_PRAGMA_UNROLL_FULL()
-    for (__simd_size_type __i = 0; __i < _Np; ++__i)
-    {
-      __result.__data[__i] = __lhs.__data[__i] != __rhs.__data[__i];
-    }
-    return __result;
+    return __binary(__lhs, __rhs, ::cuda::std::bit_xor<>{});
   }
 
   [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage __bitwise_not(const _MaskStorage& __s) noexcept
   {
-    _MaskStorage __result;
-    _CCCL_PRAGMA_UNROLL_FULL()
-    for (__simd_size_type __i = 0; __i < _Np; ++__i)
-    {
-      __result.__data[__i] = !__s.__data[__i];
-    }
-    return __result;
+    return __bitwise_xor(__s, __broadcast(true));
   }
 };
 
@@ -95,7 +95,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = !__s.__data[__i];
+      __result.__set(__i, !__s.__data[__i]);
     }
     return __result;
   }
@@ -196,7 +196,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = (__lhs.__data[__i] == __rhs.__data[__i]);
+      __result.__set(__i, __lhs.__data[__i] == __rhs.__data[__i]);
     }
     return __result;
   }
@@ -208,7 +208,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = (__lhs.__data[__i] != __rhs.__data[__i]);
+      __result.__set(__i, __lhs.__data[__i] != __rhs.__data[__i]);
     }
     return __result;
   }
@@ -220,7 +220,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = (__lhs.__data[__i] < __rhs.__data[__i]);
+      __result.__set(__i, __lhs.__data[__i] < __rhs.__data[__i]);
     }
     return __result;
   }
@@ -232,7 +232,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = (__lhs.__data[__i] <= __rhs.__data[__i]);
+      __result.__set(__i, __lhs.__data[__i] <= __rhs.__data[__i]);
     }
     return __result;
   }
@@ -244,7 +244,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = (__lhs.__data[__i] > __rhs.__data[__i]);
+      __result.__set(__i, __lhs.__data[__i] > __rhs.__data[__i]);
     }
     return __result;
   }
@@ -256,7 +256,7 @@ struct __fixed_size_operations
     _CCCL_PRAGMA_UNROLL_FULL()
     for (__simd_size_type __i = 0; __i < _Np; ++__i)
     {
-      __result.__data[__i] = (__lhs.__data[__i] >= __rhs.__data[__i]);
+      __result.__set(__i, __lhs.__data[__i] >= __rhs.__data[__i]);
     }
     return __result;
   }
@@ -322,6 +322,42 @@ struct __fixed_size_operations
     }
     return __result;
   }
+
+  // Conditional operation
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage
+  __select(const _MaskStorage& __mask, const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept
+  {
+    _SimdStorage __result;
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      __result.__data[__i] = __mask.__get(__i) ? __lhs.__data[__i] : __rhs.__data[__i];
+    }
+    return __result;
+  }
+
+  // Memory operations on _Np contiguous elements
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage __load(const _Tp* __ptr) noexcept
+  {
+    _SimdStorage __result;
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      __result.__data[__i] = __ptr[__i];
+    }
+    return __result;
+  }
+
+  _CCCL_HOST_DEVICE_API static constexpr void __store(const _SimdStorage& __s, _Tp* __ptr) noexcept
+  {
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      __ptr[__i] = __s.__data[__i];
+    }
+  }
 };
 
 // Default path (no optimizations)
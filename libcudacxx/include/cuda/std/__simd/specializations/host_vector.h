@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___SIMD_SPECIALIZATIONS_HOST_VECTOR_H
+#define _CUDA_STD___SIMD_SPECIALIZATIONS_HOST_VECTOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__fwd/simd.h>
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__bit/integral.h>
+#  include <cuda/std/__cstring/memcpy.h>
+#  include <cuda/std/__type_traits/conditional.h>
+#  include <cuda/std/__type_traits/is_floating_point.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__type_traits/is_signed.h>
+#  include <cuda/std/__type_traits/make_nbit_int.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+// Element types that are processed in the vector registers of the host. Extended floating-point and complex types are
+// processed element by element.
+template <typename _Tp>
+inline constexpr bool __is_host_vector_element_v =
+  (is_integral_v<_Tp> && !is_same_v<_Tp, bool> && sizeof(_Tp) <= 8) || is_same_v<_Tp, float> || is_same_v<_Tp, double>;
+
+// Vectors smaller than the narrowest vector register are left to the compiler
+template <typename _Tp, __simd_size_type _Np>
+inline constexpr bool __has_host_vector_v = __is_host_vector_element_v<_Tp> && _Np * sizeof(_Tp) >= 16;
+
+// Masks of such vectors store every element as an integer of the element size, see __mask_storage
+template <size_t _Bytes, __simd_size_type _Np>
+inline constexpr bool __has_host_vector_mask_v = _Bytes <= 8 && _Np * _Bytes >= 16;
+
+// Describes how _Np elements of type _Tp are split into vector registers. Elements that do not fill a whole register
+// are processed one by one.
+template <typename _Tp, __simd_size_type _Np>
+struct __host_vector_traits
+{
+  // Character types are not valid vector elements, so integers are processed as integers of the same size
+  using __element_t =
+    conditional_t<is_floating_point_v<_Tp>, _Tp, __make_nbit_int_t<sizeof(_Tp) * 8, is_signed_v<_Tp>>>;
+
+  static constexpr size_t __bytes =
+    ::cuda::std::min(size_t{_CCCL_SIMD_HOST_VECTOR_BYTES()}, ::cuda::std::bit_floor(_Np * sizeof(_Tp)));
+  static constexpr __simd_size_type __lanes      = static_cast<__simd_size_type>(__bytes / sizeof(_Tp));
+  static constexpr __simd_size_type __vector_end = (_Np / __lanes) * __lanes;
+
+  typedef __element_t __vector_t __attribute__((vector_size(__bytes)));
+
+  [[nodiscard]] _CCCL_HOST_API static __vector_t __load(const _Tp* __ptr) noexcept
+  {
+    __vector_t __result;
+    ::cuda::std::memcpy(&__result, __ptr, sizeof(__vector_t));
+    return __result;
+  }
+
+  _CCCL_HOST_API static void __store(_Tp* __ptr, const __vector_t __v) noexcept
+  {
+    ::cuda::std::memcpy(__ptr, &__v, sizeof(__vector_t));
+  }
+
+  // Lane wise __mask ? __lhs : __rhs, where every lane of __mask is the result of a vector comparison
+  template <typename _Mask>
+  [[nodiscard]] _CCCL_HOST_API static __vector_t
+  __select(const _Mask __mask, const __vector_t __lhs, const __vector_t __rhs) noexcept
+  {
+    static_assert(sizeof(_Mask) == sizeof(__vector_t), "The mask must have as many lanes as the vector");
+    _Mask __lhs_bits;
+    _Mask __rhs_bits;
+    ::cuda::std::memcpy(&__lhs_bits, &__lhs, sizeof(__vector_t));
+    ::cuda::std::memcpy(&__rhs_bits, &__rhs, sizeof(__vector_t));
+    const _Mask __bits = (__mask & __lhs_bits) | (~__mask & __rhs_bits);
+    __vector_t __result;
+    ::cuda::std::memcpy(&__result, &__bits, sizeof(__vector_t));
+    return __result;
+  }
+};
+
+template <typename _Tp, __simd_size_type _Np, typename _Op>
+_CCCL_HOST_API void __host_vector_unary(const _Tp* __s, _Tp* __result, _Op __op) noexcept
+{
+  using __traits    = __host_vector_traits<_Tp, _Np>;
+  using __element_t = typename __traits::__element_t;
+  for (__simd_size_type __i = 0; __i < __traits::__vector_end; __i += __traits::__lanes)
+  {
+    __traits::__store(__result + __i, __op(__traits::__load(__s + __i)));
+  }
+  for (__simd_size_type __i = __traits::__vector_end; __i < _Np; ++__i)
+  {
+    __result[__i] = static_cast<_Tp>(__op(static_cast<__element_t>(__s[__i])));
+  }
+}
+
+template <typename _Tp, __simd_size_type _Np, typename _Op>
+_CCCL_HOST_API void __host_vector_binary(const _Tp* __lhs, const _Tp* __rhs, _Tp* __result, _Op __op) noexcept
+{
+  using __traits    = __host_vector_traits<_Tp, _Np>;
+  using __element_t = typename __traits::__element_t;
+  for (__simd_size_type __i = 0; __i < __traits::__vector_end; __i += __traits::__lanes)
+  {
+    __traits::__store(__result + __i, __op(__traits::__load(__lhs + __i), __traits::__load(__rhs + __i)));
+  }
+  for (__simd_size_type __i = __traits::__vector_end; __i < _Np; ++__i)
+  {
+    __result[__i] =
+      static_cast<_Tp>(__op(static_cast<__element_t>(__lhs[__i]), static_cast<__element_t>(__rhs[__i])));
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+template <typename _Tp, __simd_size_type _Np>
+inline constexpr bool __has_host_vector_v = false;
+
+template <size_t _Bytes, __simd_size_type _Np>
+inline constexpr bool __has_host_vector_mask_v = false;
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // ^^^ !_CCCL_HAS_SIMD_HOST_VECTOR() ^^^
+
+#endif // _CUDA_STD___SIMD_SPECIALIZATIONS_HOST_VECTOR_H
@@ -40,9 +40,12 @@
 #include <cuda/std/__simd/concepts.h>
 #include <cuda/std/__simd/flag.h>
 #include <cuda/std/__simd/utility.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__utility/cmp.h>
 #include <cuda/std/__utility/forward.h>
 
+#include <nv/target>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
@@ -95,6 +98,18 @@ __full_store_to_ptr(const basic_vec<_Tp, _Abi>& __v, _Up* const __ptr, flags<_Fl
   constexpr auto __simd_size        = __vec_t::__size;
   constexpr bool __has_aligned_flag = __has_aligned_flag_v<_Flags...>;
 
+  // Without conversion, the host stores all elements at once from its vector registers
+  if constexpr (is_same_v<_Up, _Tp>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, ({
+                     __vec_t::_Impl::__store(__v.__s_, __ptr);
+                     return;
+                   }))
+    }
+  }
+
   if constexpr (__has_aligned_flag || __has_overaligned_flag_v<_Flags...>)
   {
     _CCCL_IF_NOT_CONSTEVAL_DEFAULT
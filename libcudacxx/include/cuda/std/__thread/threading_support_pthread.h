@@ -25,6 +25,7 @@
 #  include <cuda/std/__chrono/duration.h>
 #  include <cuda/std/__utility/cmp.h>
 #  include <cuda/std/climits>
+#  include <cuda/std/cstdint>
 #  include <cuda/std/ctime>
 
 #  include <errno.h>
@@ -122,6 +123,35 @@ __cccl_semaphore_wait_timed(__cccl_semaphore_t* __sem, ::cuda::std::chrono::nano
   return sem_timedwait(__sem, &__ts) == 0;
 }
 
+#  if defined(__linux__)
+// Futex
+
+//! @brief Puts the calling thread to sleep unless `*__word != __expected`, the comparison and the sleep are atomic
+//!
+//! A futex that is not `__shared` is only woken from the same process, which is cheaper.
+_CCCL_HOST_API inline void
+__cccl_futex_wait(const volatile void* __word, uint32_t __expected, bool __shared = false) noexcept
+{
+  ::syscall(SYS_futex, __word, __shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, __expected, nullptr, nullptr, 0);
+}
+
+//! @brief Like `__cccl_futex_wait`, but returns after `__timeout` at the latest
+_CCCL_HOST_API inline void __cccl_futex_wait_for(const volatile void* __word,
+                                                 uint32_t __expected,
+                                                 ::cuda::std::chrono::nanoseconds __timeout,
+                                                 bool __shared = false) noexcept
+{
+  const auto __ts = __cccl_to_timespec(__timeout);
+  ::syscall(SYS_futex, __word, __shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, __expected, &__ts, nullptr, 0);
+}
+
+//! @brief Wakes up to `__count` threads sleeping in `__cccl_futex_wait` on `__word`
+_CCCL_HOST_API inline void __cccl_futex_wake(const volatile void* __word, int __count, bool __shared = false) noexcept
+{
+  ::syscall(SYS_futex, __word, __shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+#  endif // __linux__
+
 _CCCL_HOST_DEVICE_API inline void __cccl_thread_yield()
 {
   sched_yield();
@@ -0,0 +1,127 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/barrier>
+
+#include <cuda/barrier>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+constexpr int num_phases = 100;
+
+struct completion
+{
+  cuda::std::atomic<int>* arrived;
+  cuda::std::atomic<int>* completions;
+  int num_threads;
+  int drops_per_phase;
+
+  void operator()() const noexcept
+  {
+    // Runs once per phase, after every thread arrived and before any of them is released
+    const int phase = completions->fetch_add(1);
+    assert(arrived->exchange(0) == num_threads - drops_per_phase * phase);
+  }
+};
+
+template <int NumThreads>
+void test_arrive_and_wait()
+{
+  cuda::std::atomic<int> arrived(0);
+  cuda::std::atomic<int> completions(0);
+  cuda::tree_barrier<cuda::thread_scope_system, completion> barrier(
+    NumThreads, completion{&arrived, &completions, NumThreads, 0});
+
+  std::thread threads[NumThreads];
+  for (auto& thread : threads)
+  {
+    thread = std::thread([&] {
+      for (int phase = 0; phase < num_phases; ++phase)
+      {
+        arrived.fetch_add(1);
+        barrier.arrive_and_wait();
+        assert(completions.load() == phase + 1);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  assert(completions.load() == num_phases);
+}
+
+// Thread `t` drops out of the barrier in phase `t`, so that every phase has one participant less than the previous one
+template <int NumThreads>
+void test_arrive_and_drop()
+{
+  cuda::std::atomic<int> arrived(0);
+  cuda::std::atomic<int> completions(0);
+  cuda::tree_barrier<cuda::thread_scope_system, completion> barrier(
+    NumThreads, completion{&arrived, &completions, NumThreads, 1});
+
+  std::thread threads[NumThreads];
+  for (int t = 0; t < NumThreads; ++t)
+  {
+    threads[t] = std::thread([&, t] {
+      for (int phase = 0; phase < t; ++phase)
+      {
+        arrived.fetch_add(1);
+        barrier.arrive_and_wait();
+        assert(completions.load() == phase + 1);
+      }
+      arrived.fetch_add(1);
+      barrier.arrive_and_drop();
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  assert(completions.load() == NumThreads);
+}
+
+// A thread may arrive for several participants at once
+void test_arrive_update()
+{
+  cuda::std::atomic<int> arrived(0);
+  cuda::std::atomic<int> completions(0);
+  cuda::tree_barrier<cuda::thread_scope_system, completion> barrier(5, completion{&arrived, &completions, 5, 0});
+
+  for (int phase = 0; phase < num_phases; ++phase)
+  {
+    arrived.fetch_add(2);
+    auto token = barrier.arrive(2);
+    std::thread other([&] {
+      arrived.fetch_add(3);
+      barrier.arrive(3);
+    });
+    barrier.wait(cuda::std::move(token));
+    assert(completions.load() == phase + 1);
+    other.join();
+  }
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_arrive_and_wait<1>(); test_arrive_and_wait<2>(); test_arrive_and_wait<7>();
+                test_arrive_and_wait<16>(); test_arrive_and_wait<33>(); test_arrive_and_drop<1>();
+                test_arrive_and_drop<9>(); test_arrive_update();
+                static_assert(cuda::tree_barrier<cuda::thread_scope_system>::max() > 0);))
+
+  return 0;
+}
@@ -0,0 +1,203 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/random>
+
+// Bulk generation produces the same values as repeated scalar calls, and leaves the engine and the distribution in the
+// same state.
+
+#include <cuda/random>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include "test_macros.h"
+
+constexpr cuda::std::size_t max_size = 300;
+
+// Sizes around multiples of the block of philox and of the vector registers of the host
+constexpr cuda::std::size_t sizes[] = {0, 1, 3, 4, 5, 8, 31, 32, 33, 64, 100, 255, 256, 257, max_size};
+
+template <class Engine>
+TEST_FUNC void test_engine(const Engine& initial)
+{
+  using result_type = typename Engine::result_type;
+  for (auto size : sizes)
+  {
+    // Start at every position in the output buffer of philox
+    for (int offset = 0; offset < 4; ++offset)
+    {
+      Engine bulk = initial;
+      bulk.discard(offset);
+      Engine scalar = bulk;
+
+      result_type values[max_size] = {};
+      cuda::generate(bulk, cuda::std::span<result_type>{values, size});
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        assert(values[i] == scalar());
+      }
+      assert(bulk == scalar);
+      assert(bulk() == scalar());
+    }
+  }
+}
+
+template <class Engine>
+TEST_FUNC void test_engines()
+{
+  test_engine(Engine{});
+  test_engine(Engine{42});
+}
+
+TEST_FUNC void test_philox_counter_carry()
+{
+  // The least significant word of the counter overflows within the blocks that are generated at once
+  cuda::std::philox4x32 e32;
+  e32.set_counter({0, 0, 1, 0xFFFFFFFF - 5});
+  test_engine(e32);
+
+  cuda::std::philox4x64 e64;
+  e64.set_counter({0, 0, 1, ~0ull - 5});
+  test_engine(e64);
+
+  cuda::std::philox4x32 wrap;
+  wrap.set_counter({0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF - 2});
+  test_engine(wrap);
+}
+
+template <class Distribution, class Engine>
+TEST_FUNC void test_distribution(Distribution initial)
+{
+  using result_type = typename Distribution::result_type;
+  for (auto size : sizes)
+  {
+    for (int offset = 0; offset < 2; ++offset)
+    {
+      Engine bulk_engine;
+      Distribution bulk_dist = initial;
+      // Normal distributions may start with a cached value
+      for (int i = 0; i < offset; ++i)
+      {
+        (void) bulk_dist(bulk_engine);
+      }
+      Engine scalar_engine     = bulk_engine;
+      Distribution scalar_dist = bulk_dist;
+
+      result_type values[max_size] = {};
+      bulk_dist.generate(bulk_engine, cuda::std::span<result_type>{values, size});
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        assert(values[i] == scalar_dist(scalar_engine));
+      }
+      assert(bulk_engine == scalar_engine);
+      assert(bulk_dist == scalar_dist);
+      assert(bulk_dist(bulk_engine) == scalar_dist(scalar_engine));
+
+      bulk_dist.generate(bulk_engine, cuda::std::span<result_type>{values, size}, typename Distribution::param_type{});
+      for (cuda::std::size_t i = 0; i < size; ++i)
+      {
+        assert(values[i] == scalar_dist(scalar_engine, typename Distribution::param_type{}));
+      }
+      assert(bulk_engine == scalar_engine);
+    }
+  }
+}
+
+template <class Engine>
+TEST_FUNC void test_distributions()
+{
+  test_distribution<cuda::std::uniform_real_distribution<float>, Engine>(
+    cuda::std::uniform_real_distribution<float>{-2.0f, 3.0f});
+  test_distribution<cuda::std::uniform_real_distribution<double>, Engine>(
+    cuda::std::uniform_real_distribution<double>{-2.0, 3.0});
+  test_distribution<cuda::std::exponential_distribution<double>, Engine>(
+    cuda::std::exponential_distribution<double>{0.5});
+  test_distribution<cuda::std::normal_distribution<float>, Engine>(cuda::std::normal_distribution<float>{1.0f, 2.0f});
+  test_distribution<cuda::std::normal_distribution<double>, Engine>(cuda::std::normal_distribution<double>{1.0, 2.0});
+}
+
+#if TEST_HAS_EXCEPTIONS()
+// Throws once it has produced a given number of values
+struct throwing_engine
+{
+  using result_type = cuda::std::uint32_t;
+
+  int remaining_;
+
+  static constexpr result_type min()
+  {
+    return 0;
+  }
+  static constexpr result_type max()
+  {
+    return 0xFFFFFFFF;
+  }
+
+  result_type operator()()
+  {
+    if (remaining_-- == 0)
+    {
+      throw 42;
+    }
+    return 0x12345678;
+  }
+};
+
+template <class Distribution>
+void test_distribution_exception()
+{
+  using result_type = typename Distribution::result_type;
+  for (int remaining : {0, 1, 5, 100})
+  {
+    throwing_engine engine{remaining};
+    Distribution dist;
+    result_type values[max_size] = {};
+    try
+    {
+      dist.generate(engine, cuda::std::span<result_type>{values, max_size});
+      assert(false);
+    }
+    catch (int value)
+    {
+      assert(value == 42);
+    }
+  }
+}
+
+void test_exceptions()
+{
+  test_distribution_exception<cuda::std::uniform_real_distribution<float>>();
+  test_distribution_exception<cuda::std::uniform_real_distribution<double>>();
+  test_distribution_exception<cuda::std::exponential_distribution<double>>();
+  test_distribution_exception<cuda::std::normal_distribution<double>>();
+}
+#endif // TEST_HAS_EXCEPTIONS()
+
+int main(int, char**)
+{
+  test_engines<cuda::std::philox4x32>();
+  test_engines<cuda::std::philox4x64>();
+  test_engines<cuda::pcg64>();
+  test_engines<cuda::std::minstd_rand>();
+  test_philox_counter_carry();
+
+  test_distributions<cuda::std::philox4x32>();
+  test_distributions<cuda::std::philox4x64>();
+  test_distributions<cuda::pcg64>();
+  test_distributions<cuda::std::minstd_rand>();
+
+#if TEST_HAS_EXCEPTIONS()
+  NV_IF_TARGET(NV_IS_HOST, (test_exceptions();))
+#endif // TEST_HAS_EXCEPTIONS()
+
+  return 0;
+}
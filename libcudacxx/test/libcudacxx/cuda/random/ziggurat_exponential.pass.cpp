@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// XFAIL: enable-tile
+// error: dynamic memory allocation is unsupported in tile code
+//
+// REQUIRES: long_tests
+
+// <cuda/random>
+
+// template<class RealType = double>
+// class ziggurat_exponential_distribution
+
+#include <cuda/random>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+
+#include "random_utilities/test_distribution.h"
+#include "test_macros.h"
+
+template <class T>
+struct exponential_cdf
+{
+  using P = typename cuda::ziggurat_exponential_distribution<T>::param_type;
+
+  TEST_FUNC double operator()(double x, const P& p) const
+  {
+    if (x <= 0.0)
+    {
+      return 0.0;
+    }
+    return 1.0 - cuda::std::exp(-p.lambda() * x);
+  }
+};
+
+template <class T, class G>
+TEST_FUNC void test()
+{
+  const bool test_constexpr     = false;
+  using D                       = cuda::ziggurat_exponential_distribution<T>;
+  using P                       = typename D::param_type;
+  cuda::std::array<P, 5> params = {P(T(1)), P(T(0.5)), P(T(2)), P(T(0.1)), P(T(10))};
+  test_distribution<D, true, G, test_constexpr>(params, exponential_cdf<T>{});
+}
+
+// The tail beyond R = 7.6971174701310501, the edge of the base layer, is sampled separately, so check that it has the
+// right probability
+TEST_FUNC void test_tail()
+{
+  cuda::ziggurat_exponential_distribution<double> dist;
+  cuda::std::philox4x64 rng;
+  constexpr int samples = 1000000;
+  int tail              = 0;
+  for (int i = 0; i < samples; ++i)
+  {
+    tail += dist(rng) > 7.6971174701310501;
+  }
+  // P(x > R) = 0.00045413, the standard deviation of the count is about 21
+  assert(tail > 454 - 105 && tail < 454 + 105);
+}
+
+int main(int, char**)
+{
+  test<double, cuda::std::philox4x64>();
+  test<float, cuda::std::philox4x64>();
+  test<double, cuda::pcg64>();
+  // An engine with fewer bits than a word of the Ziggurat method
+  test<double, cuda::std::philox4x32>();
+  test_tail();
+  return 0;
+}
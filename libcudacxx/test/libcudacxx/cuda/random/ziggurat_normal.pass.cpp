@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// XFAIL: enable-tile
+// error: dynamic memory allocation is unsupported in tile code
+//
+// REQUIRES: long_tests
+
+// <cuda/random>
+
+// template<class RealType = double>
+// class ziggurat_normal_distribution
+
+#include <cuda/random>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+
+#include "random_utilities/test_distribution.h"
+#include "test_macros.h"
+
+template <class T>
+struct normal_cdf
+{
+  using P = typename cuda::ziggurat_normal_distribution<T>::param_type;
+
+  TEST_FUNC double operator()(double x, const P& p) const
+  {
+    return 0.5 * (1 + cuda::std::erf((x - (p.mean())) / (p.stddev() * cuda::std::sqrt(2))));
+  }
+};
+
+template <class T, class G>
+TEST_FUNC void test()
+{
+  const bool test_constexpr     = false;
+  using D                       = cuda::ziggurat_normal_distribution<T>;
+  using P                       = typename D::param_type;
+  cuda::std::array<P, 5> params = {P(0, 1), P(10, 2), P(-5, 0.5), P(4, 5), P(1000, 100)};
+  test_distribution<D, true, G, test_constexpr>(params, normal_cdf<T>{});
+}
+
+// The tail beyond R = 3.6541528853610088, the edge of the base layer, is sampled separately, so check that it has the
+// right probability
+TEST_FUNC void test_tail()
+{
+  cuda::ziggurat_normal_distribution<double> dist;
+  cuda::std::philox4x64 rng;
+  constexpr int samples = 1000000;
+  int tail              = 0;
+  for (int i = 0; i < samples; ++i)
+  {
+    tail += cuda::std::fabs(dist(rng)) > 3.6541528853610088;
+  }
+  // P(|x| > R) = 0.00025803, the standard deviation of the count is about 16
+  assert(tail > 258 - 80 && tail < 258 + 80);
+}
+
+int main(int, char**)
+{
+  test<double, cuda::std::philox4x64>();
+  test<float, cuda::std::philox4x64>();
+  test<double, cuda::pcg64>();
+  // An engine with fewer bits than a word of the Ziggurat method
+  test<double, cuda::std::philox4x32>();
+  test_tail();
+  return 0;
+}
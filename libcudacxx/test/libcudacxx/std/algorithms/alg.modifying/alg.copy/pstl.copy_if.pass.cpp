@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class Predicate>
+//   ForwardIterator2 copy_if(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                            ForwardIterator2 result, Predicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(copy_if);
+
+static_assert(!sfinae_test_copy_if<int, int*, int*, int*, bool (*)(int)>);
+static_assert(sfinae_test_copy_if<cuda::std::execution::parallel_policy, int*, int*, int*, bool (*)(int)>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+
+struct is_even
+{
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v % 2 == 0;
+  }
+};
+
+struct constant_predicate
+{
+  bool value_;
+
+  TEST_FUNC constexpr bool operator()(int) const noexcept
+  {
+    return value_;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+
+      auto res = cuda::std::copy_if(policy, Iter(data), Iter(data + size), Iter(out), is_even{});
+      assert(res == Iter(out + (size + 1) / 2));
+      for (int i = 0; i < (size + 1) / 2; ++i)
+      {
+        assert(out[i] == 2 * i);
+      }
+
+      res = cuda::std::copy_if(policy, Iter(data), Iter(data + size), Iter(out), constant_predicate{true});
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(data, data + size, out));
+
+      res = cuda::std::copy_if(policy, Iter(data), Iter(data + size), Iter(out), constant_predicate{false});
+      assert(res == Iter(out));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class Size, class ForwardIterator2>
+//   ForwardIterator2 copy_n(ExecutionPolicy&& exec, ForwardIterator1 first, Size n, ForwardIterator2 result);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(copy_n);
+
+static_assert(!sfinae_test_copy_n<int, int*, int, int*>);
+static_assert(sfinae_test_copy_n<cuda::std::execution::parallel_policy, int*, int, int*>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+      cuda::std::fill(out, out + size, -1);
+      const auto res = cuda::std::copy_n(policy, Iter(data), size, Iter(out));
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(data, data + size, out));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+//   void fill(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, const T& value);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(fill);
+
+static_assert(!sfinae_test_fill<int, int*, int*, int>);
+static_assert(sfinae_test_fill<cuda::std::execution::parallel_policy, int*, int*, int>);
+
+int out[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::fill(out, out + size, 0);
+      cuda::std::fill(policy, Iter(out), Iter(out + size), 42);
+      assert(cuda::std::count(out, out + size, 42) == size);
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
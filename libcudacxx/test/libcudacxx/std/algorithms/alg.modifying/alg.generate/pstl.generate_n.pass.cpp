@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator, class Size, class Generator>
+//   ForwardIterator generate_n(ExecutionPolicy&& exec, ForwardIterator first, Size n, Generator gen);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(generate_n);
+
+static_assert(!sfinae_test_generate_n<int, int*, int, int (*)()>);
+static_assert(sfinae_test_generate_n<cuda::std::execution::parallel_policy, int*, int, int (*)()>);
+
+int out[pstl_test_max_size];
+
+struct return_42
+{
+  TEST_FUNC constexpr int operator()() const noexcept
+  {
+    return 42;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::fill(out, out + size, 0);
+      const auto res = cuda::std::generate_n(policy, Iter(out), size, return_42{});
+      assert(res == Iter(out + size));
+      assert(cuda::std::count(out, out + size, 42) == size);
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
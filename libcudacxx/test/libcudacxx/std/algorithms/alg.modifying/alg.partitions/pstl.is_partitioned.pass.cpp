@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+//   bool is_partitioned(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, Predicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(is_partitioned);
+
+static_assert(!sfinae_test_is_partitioned<int, int*, int*, bool (*)(int)>);
+static_assert(sfinae_test_is_partitioned<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
+
+int data[pstl_test_max_size];
+
+struct less_than
+{
+  int value_;
+
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v < value_;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+      assert(cuda::std::is_partitioned(policy, Iter(data), Iter(data + size), less_than{0}));
+      assert(cuda::std::is_partitioned(policy, Iter(data), Iter(data + size), less_than{size / 2}));
+      assert(cuda::std::is_partitioned(policy, Iter(data), Iter(data + size), less_than{size}));
+
+      // an element that satisfies the predicate after one that does not
+      if (size >= 3)
+      {
+        data[size - 1] = 0;
+        assert(!cuda::std::is_partitioned(policy, Iter(data), Iter(data + size), less_than{1}));
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator, class ForwardIterator1, class ForwardIterator2,
+//          class Predicate>
+//   pair<ForwardIterator1, ForwardIterator2>
+//     partition_copy(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last,
+//                    ForwardIterator1 out_true, ForwardIterator2 out_false, Predicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(partition_copy);
+
+static_assert(!sfinae_test_partition_copy<int, int*, int*, int*, int*, bool (*)(int)>);
+static_assert(sfinae_test_partition_copy<cuda::std::execution::parallel_policy, int*, int*, int*, int*, bool (*)(int)>);
+
+int data[pstl_test_max_size];
+int out_true[pstl_test_max_size];
+int out_false[pstl_test_max_size];
+int expected_true[pstl_test_max_size];
+int expected_false[pstl_test_max_size];
+
+struct is_even
+{
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v % 2 == 0;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = (i * 7919) % 1009;
+      }
+
+      const auto expected_res = cuda::std::partition_copy(data, data + size, expected_true, expected_false, is_even{});
+      const auto res =
+        cuda::std::partition_copy(policy, Iter(data), Iter(data + size), Iter(out_true), Iter(out_false), is_even{});
+      assert(res.first == Iter(out_true + (expected_res.first - expected_true)));
+      assert(res.second == Iter(out_false + (expected_res.second - expected_false)));
+      assert(cuda::std::equal(expected_true, expected_res.first, out_true));
+      assert(cuda::std::equal(expected_false, expected_res.second, out_false));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class BidirectionalIterator, class Predicate>
+//   BidirectionalIterator stable_partition(ExecutionPolicy&& exec, BidirectionalIterator first,
+//                                          BidirectionalIterator last, Predicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(stable_partition);
+
+static_assert(!sfinae_test_stable_partition<int, int*, int*, bool (*)(int)>);
+static_assert(sfinae_test_stable_partition<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
+
+int data[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+struct is_even
+{
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v % 2 == 0;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = (i * 7919) % 1009;
+      }
+
+      cuda::std::copy(data, data + size, expected);
+      const auto expected_end = cuda::std::stable_partition(expected, expected + size, is_even{});
+
+      const auto res = cuda::std::stable_partition(policy, Iter(data), Iter(data + size), is_even{});
+      assert(res == Iter(data + (expected_end - expected)));
+      assert(cuda::std::equal(data, data + size, expected));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::bidirectional_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
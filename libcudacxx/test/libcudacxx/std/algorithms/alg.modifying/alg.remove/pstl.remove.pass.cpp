@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+//   ForwardIterator remove(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, const T& value);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(remove);
+
+static_assert(!sfinae_test_remove<int, int*, int*, int>);
+static_assert(sfinae_test_remove<cuda::std::execution::parallel_policy, int*, int*, int>);
+
+int data[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      cuda::std::copy(data, data + size, expected);
+      const auto expected_end = cuda::std::remove(expected, expected + size, 3);
+
+      const auto res = cuda::std::remove(policy, Iter(data), Iter(data + size), 3);
+      assert(res == Iter(data + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, data));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
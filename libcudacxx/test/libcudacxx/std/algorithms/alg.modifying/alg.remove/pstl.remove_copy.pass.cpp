@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class T>
+//   ForwardIterator2 remove_copy(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                ForwardIterator2 result, const T& value);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(remove_copy);
+
+static_assert(!sfinae_test_remove_copy<int, int*, int*, int*, int>);
+static_assert(sfinae_test_remove_copy<cuda::std::execution::parallel_policy, int*, int*, int*, int>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      const auto expected_end = cuda::std::remove_copy(data, data + size, expected, 3);
+
+      const auto res = cuda::std::remove_copy(policy, Iter(data), Iter(data + size), Iter(out), 3);
+      assert(res == Iter(out + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, out));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
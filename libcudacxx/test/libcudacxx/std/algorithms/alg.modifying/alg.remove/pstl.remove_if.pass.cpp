@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+//   ForwardIterator remove_if(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, Predicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(remove_if);
+
+static_assert(!sfinae_test_remove_if<int, int*, int*, bool (*)(int)>);
+static_assert(sfinae_test_remove_if<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
+
+int data[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+struct less_than_5
+{
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v < 5;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      cuda::std::copy(data, data + size, expected);
+      const auto expected_end = cuda::std::remove_if(expected, expected + size, less_than_5{});
+
+      const auto res = cuda::std::remove_if(policy, Iter(data), Iter(data + size), less_than_5{});
+      assert(res == Iter(data + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, data));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class Predicate, class T>
+//   ForwardIterator2 replace_copy_if(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                    ForwardIterator2 result, Predicate pred, const T& new_value);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(replace_copy_if);
+
+static_assert(!sfinae_test_replace_copy_if<int, int*, int*, int*, bool (*)(int), int>);
+static_assert(sfinae_test_replace_copy_if<cuda::std::execution::parallel_policy, int*, int*, int*, bool (*)(int), int>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+struct less_than_5
+{
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v < 5;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      cuda::std::replace_copy_if(data, data + size, expected, less_than_5{}, 42);
+
+      // every element is written, not only the replaced ones
+      cuda::std::fill(out, out + size, -1);
+      const auto res = cuda::std::replace_copy_if(policy, Iter(data), Iter(data + size), Iter(out), less_than_5{}, 42);
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(out, out + size, expected));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -18,6 +18,7 @@
 #include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 #include <thrust/logical.h>
+#include <thrust/replace.h>
 #include <thrust/sequence.h>
 
 #include <cuda/cmath>
@@ -129,6 +130,16 @@ void test_replace_copy(const Policy& policy,
     CHECK(cuda::std::none_of(policy, output.begin(), output.end(), not_42));
     CHECK(res == output.end());
   }
+
+  cuda::std::fill(policy, output.begin(), output.end(), static_cast<T>(0));
+  { // every output element is written, not only the replaced ones
+    c2h::device_vector<T> expected = input;
+    thrust::replace(expected.begin(), expected.end(), static_cast<T>(42), static_cast<T>(1337));
+    const auto res = cuda::std::replace_copy(
+      policy, input.begin(), input.end(), output.begin(), static_cast<T>(42), static_cast<T>(1337));
+    CHECK(cuda::std::equal(policy, output.begin(), output.end(), expected.begin()));
+    CHECK(res == output.end());
+  }
 }
 
 C2H_TEST("cuda::std::replace_copy", "[parallel algorithm]", all_types)
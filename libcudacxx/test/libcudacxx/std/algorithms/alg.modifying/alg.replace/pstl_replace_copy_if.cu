@@ -18,6 +18,7 @@
 #include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 #include <thrust/logical.h>
+#include <thrust/replace.h>
 #include <thrust/sequence.h>
 
 #include <cuda/cmath>
@@ -134,6 +135,21 @@ void test_replace_copy_if(const Policy& policy, c2h::device_vector<T>& output)
       static_cast<short>(1337));
     CHECK(cuda::std::none_of(policy, output.begin(), output.end(), is_power_of_2<T>{}));
   }
+
+  { // every output element is written, not only the replaced ones
+    c2h::device_vector<T> expected(size, thrust::no_init);
+    thrust::sequence(expected.begin(), expected.end(), static_cast<T>(0));
+    thrust::replace_if(expected.begin(), expected.end(), is_power_of_2<T>{}, static_cast<T>(1337));
+    cuda::std::fill(policy, output.begin(), output.end(), static_cast<T>(0));
+    cuda::std::replace_copy_if(
+      policy,
+      cuda::counting_iterator{static_cast<T>(0)},
+      cuda::counting_iterator{static_cast<T>(size)},
+      output.begin(),
+      is_power_of_2<T>{},
+      static_cast<T>(1337));
+    CHECK(cuda::std::equal(policy, output.begin(), output.end(), expected.begin()));
+  }
 }
 
 C2H_TEST("cuda::std::replace_copy_if", "[parallel algorithm]", integral_types)
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class BidirectionalIterator>
+//   void reverse(ExecutionPolicy&& exec, BidirectionalIterator first, BidirectionalIterator last);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(reverse);
+
+static_assert(!sfinae_test_reverse<int, int*, int*>);
+static_assert(sfinae_test_reverse<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+      cuda::std::reverse(policy, Iter(data), Iter(data + size));
+      for (int i = 0; i < size; ++i)
+      {
+        assert(data[i] == size - 1 - i);
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::bidirectional_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   ForwardIterator rotate(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator middle,
+//                          ForwardIterator last);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(rotate);
+
+static_assert(!sfinae_test_rotate<int, int*, int*, int*>);
+static_assert(sfinae_test_rotate<cuda::std::execution::parallel_policy, int*, int*, int*>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (const int middle : {0, size / 3, size})
+      {
+        cuda::std::iota(data, data + size, 0);
+        const auto res = cuda::std::rotate(policy, Iter(data), Iter(data + middle), Iter(data + size));
+        assert(res == Iter(data + (size - middle)));
+        for (int i = 0; i < size; ++i)
+        {
+          assert(data[i] == (i + middle) % size);
+        }
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   ForwardIterator shift_right(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last,
+//                               typename iterator_traits<ForwardIterator>::difference_type n);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(shift_right);
+
+static_assert(!sfinae_test_shift_right<int, int*, int*, int>);
+static_assert(sfinae_test_shift_right<cuda::std::execution::parallel_policy, int*, int*, int>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (const int n : {0, 1, size / 3, size, size + 1})
+      {
+        const int shift = n < size ? n : size;
+        cuda::std::iota(data, data + size, 0);
+        const auto res = cuda::std::shift_right(policy, Iter(data), Iter(data + size), n);
+        assert(res == Iter(data + shift));
+        for (int i = shift; i < size; ++i)
+        {
+          assert(data[i] == i - shift);
+        }
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::bidirectional_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
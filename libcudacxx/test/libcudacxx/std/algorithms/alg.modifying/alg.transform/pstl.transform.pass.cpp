@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class UnaryOperation>
+//   ForwardIterator2 transform(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1,
+//                              ForwardIterator2 result, UnaryOperation op);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class ForwardIterator,
+//          class BinaryOperation>
+//   ForwardIterator transform(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1,
+//                             ForwardIterator2 first2, ForwardIterator result, BinaryOperation binary_op);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(transform);
+
+static_assert(!sfinae_test_transform<int, int*, int*, int*, int (*)(int)>);
+static_assert(sfinae_test_transform<cuda::std::execution::parallel_policy, int*, int*, int*, int (*)(int)>);
+
+int data[pstl_test_max_size];
+int data2[pstl_test_max_size];
+int out[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+      cuda::std::iota(data2, data2 + size, size);
+
+      auto res = cuda::std::transform(policy, Iter(data), Iter(data + size), Iter(out), cuda::std::negate<>{});
+      assert(res == Iter(out + size));
+      for (int i = 0; i < size; ++i)
+      {
+        assert(out[i] == -i);
+      }
+
+      res = cuda::std::transform(policy, Iter(data), Iter(data + size), Iter(data2), Iter(out), cuda::std::minus<>{});
+      assert(res == Iter(out + size));
+      assert(cuda::std::count(out, out + size, -size) == size);
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
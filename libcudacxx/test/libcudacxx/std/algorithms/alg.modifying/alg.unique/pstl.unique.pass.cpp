@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   ForwardIterator unique(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator, class BinaryPredicate>
+//   ForwardIterator unique(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last,
+//                          BinaryPredicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(unique);
+
+static_assert(!sfinae_test_unique<int, int*, int*>);
+static_assert(sfinae_test_unique<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+int data2[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+struct same_parity
+{
+  TEST_FUNC constexpr bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs % 2 == rhs % 2;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      // runs of equal elements of varying lengths
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = (i / 7) % 3 + (i / 5000);
+      }
+
+      cuda::std::copy(data, data + size, data2);
+      cuda::std::copy(data, data + size, expected);
+      auto expected_end = cuda::std::unique(expected, expected + size);
+
+      auto res = cuda::std::unique(policy, Iter(data), Iter(data + size));
+      assert(res == Iter(data + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, data));
+
+      cuda::std::copy(data2, data2 + size, expected);
+      expected_end = cuda::std::unique(expected, expected + size, same_parity{});
+
+      res = cuda::std::unique(policy, Iter(data2), Iter(data2 + size), same_parity{});
+      assert(res == Iter(data2 + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, data2));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
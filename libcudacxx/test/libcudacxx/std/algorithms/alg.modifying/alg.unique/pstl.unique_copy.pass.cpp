@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+//   ForwardIterator2 unique_copy(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                ForwardIterator2 result);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class BinaryPredicate>
+//   ForwardIterator2 unique_copy(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                ForwardIterator2 result, BinaryPredicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(unique_copy);
+
+static_assert(!sfinae_test_unique_copy<int, int*, int*, int*>);
+static_assert(sfinae_test_unique_copy<cuda::std::execution::parallel_policy, int*, int*, int*>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+struct same_parity
+{
+  TEST_FUNC constexpr bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs % 2 == rhs % 2;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      // runs of equal elements of varying lengths
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = (i / 7) % 3 + (i / 5000);
+      }
+
+      auto expected_end = cuda::std::unique_copy(data, data + size, expected);
+      auto res          = cuda::std::unique_copy(policy, Iter(data), Iter(data + size), Iter(out));
+      assert(res == Iter(out + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, out));
+
+      expected_end = cuda::std::unique_copy(data, data + size, expected, same_parity{});
+      res          = cuda::std::unique_copy(policy, Iter(data), Iter(data + size), Iter(out), same_parity{});
+      assert(res == Iter(out + (expected_end - expected)));
+      assert(cuda::std::equal(expected, expected_end, out));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
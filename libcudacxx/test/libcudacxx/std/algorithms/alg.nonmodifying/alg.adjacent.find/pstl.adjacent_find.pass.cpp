@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   ForwardIterator adjacent_find(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator, class BinaryPredicate>
+//   ForwardIterator adjacent_find(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last,
+//                                 BinaryPredicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(adjacent_find);
+
+static_assert(!sfinae_test_adjacent_find<int, int*, int*>);
+static_assert(sfinae_test_adjacent_find<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+      assert(cuda::std::adjacent_find(policy, Iter(data), Iter(data + size)) == Iter(data + size));
+
+      if (size >= 2)
+      {
+        data[size - 1] = data[size - 2];
+        assert(cuda::std::adjacent_find(policy, Iter(data), Iter(data + size)) == Iter(data + size - 2));
+
+        // the first of several adjacent pairs is found
+        data[size / 2] = data[size / 2 - 1];
+        assert(cuda::std::adjacent_find(policy, Iter(data), Iter(data + size)) == Iter(data + size / 2 - 1));
+
+        data[1] = data[0];
+        const auto res = cuda::std::adjacent_find(policy, Iter(data), Iter(data + size), cuda::std::equal_to<>{});
+        assert(res == Iter(data));
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -8,13 +8,13 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class UnaryPredicate>
-// void all_of(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, UnaryPredicate pred);
+// bool all_of(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, UnaryPredicate pred);
 
 #include <cuda/std/algorithm>
 #include <cuda/std/cassert>
+#include <cuda/std/numeric>
 
 #include "test_execution_policies.h"
 #include "test_iterators.h"
@@ -25,7 +25,17 @@ EXECUTION_POLICY_SFINAE_TEST(all_of);
 static_assert(!sfinae_test_all_of<bool, int*, int*, bool (*)(int)>);
 static_assert(sfinae_test_all_of<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
 
-int data[100];
+int data[pstl_test_max_size];
+
+struct less_than
+{
+  int value_;
+
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v < value_;
+  }
+};
 
 template <class Iter>
 struct Test
@@ -33,21 +43,19 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
-      cuda::std::iota(data, data + size, 1);
-      const auto res = cuda::std::all_of(policy, Iter(data), Iter(data + size), [size](const int v) {
-        return v == size;
-      });
-      assert(res == Iter(data + size));
+      cuda::std::iota(data, data + size, 0);
+      assert(cuda::std::all_of(policy, Iter(data), Iter(data + size), less_than{size}));
+      assert(cuda::std::all_of(policy, Iter(data), Iter(data + size), less_than{size - 1}) == (size == 0));
+      assert(cuda::std::all_of(policy, Iter(data), Iter(data + size), less_than{0}) == (size == 0));
     }
   }
 };
 
 void test()
 {
-  types::find(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
 }
 
 int main(int, char**)
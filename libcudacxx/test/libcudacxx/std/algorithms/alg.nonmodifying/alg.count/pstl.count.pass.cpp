@@ -8,10 +8,10 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class T>
-//   void count(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, const T& value);
+//   typename iterator_traits<ForwardIterator>::difference_type
+//     count(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, const T& value);
 
 #include <cuda/std/algorithm>
 #include <cuda/std/cassert>
@@ -25,7 +25,7 @@ EXECUTION_POLICY_SFINAE_TEST(count);
 static_assert(!sfinae_test_count<int, int*, int*, int>);
 static_assert(sfinae_test_count<cuda::std::execution::parallel_policy, int*, int*, int>);
 
-int data[100];
+int data[pstl_test_max_size];
 
 template <class Iter>
 struct Test
@@ -33,19 +33,21 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    cuda::std::iota(data, data + size, 0);
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
-      const auto res = cuda::std::count(policy, Iter(data), Iter(data + size), 42);
-      assert(res == 1);
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+      assert(cuda::std::count(policy, Iter(data), Iter(data + size), 3) == size / 10 + (size % 10 > 3));
+      assert(cuda::std::count(policy, Iter(data), Iter(data + size), 10) == 0);
     }
   }
 };
 
 void test()
 {
-  types::count(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
 }
 
 int main(int, char**)
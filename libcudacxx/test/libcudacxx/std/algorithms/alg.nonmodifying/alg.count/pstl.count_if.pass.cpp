@@ -8,13 +8,14 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class UnaryPred>
-//   void count_if(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, UnaryPred pred);
+//   typename iterator_traits<ForwardIterator>::difference_type
+//     count_if(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, UnaryPred pred);
 
 #include <cuda/std/algorithm>
 #include <cuda/std/cassert>
+#include <cuda/std/numeric>
 
 #include "test_execution_policies.h"
 #include "test_iterators.h"
@@ -22,10 +23,10 @@
 
 EXECUTION_POLICY_SFINAE_TEST(count_if);
 
-static_assert(!sfinae_test_count<int, int*, int*, bool (*)(int)>);
-static_assert(sfinae_test_count<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
+static_assert(!sfinae_test_count_if<int, int*, int*, bool (*)(int)>);
+static_assert(sfinae_test_count_if<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
 
-int data[100];
+int data[pstl_test_max_size];
 
 struct equal_to_42
 {
@@ -35,25 +36,32 @@ struct equal_to_42
   }
 };
 
+struct is_even
+{
+  TEST_FUNC constexpr bool operator()(const int& val) const noexcept
+  {
+    return val % 2 == 0;
+  }
+};
+
 template <class Iter>
 struct Test
 {
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    cuda::std::iota(data, data + size, 0);
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
-      const auto res = cuda::std::count_if(policy, Iter(data), Iter(data + size), equal_to_42{});
-      assert(res == 1);
+      cuda::std::iota(data, data + size, 0);
+      assert(cuda::std::count_if(policy, Iter(data), Iter(data + size), equal_to_42{}) == (size > 42));
+      assert(cuda::std::count_if(policy, Iter(data), Iter(data + size), is_even{}) == (size + 1) / 2);
     }
   }
 };
 
 void test()
 {
-  types::count_if(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
 }
 
 int main(int, char**)
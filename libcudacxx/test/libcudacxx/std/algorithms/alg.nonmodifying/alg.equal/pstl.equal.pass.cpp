@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+//   bool equal(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class BinaryPredicate>
+//   bool equal(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2,
+//              BinaryPredicate pred);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+//   bool equal(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2,
+//              ForwardIterator2 last2);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class BinaryPredicate>
+//   bool equal(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2,
+//              ForwardIterator2 last2, BinaryPredicate pred);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(equal);
+
+static_assert(!sfinae_test_equal<int, int*, int*, int*>);
+static_assert(sfinae_test_equal<cuda::std::execution::parallel_policy, int*, int*, int*>);
+
+int data[pstl_test_max_size];
+int data2[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      cuda::std::iota(data, data + size, 0);
+      cuda::std::iota(data2, data2 + size, 0);
+      assert(cuda::std::equal(policy, Iter(data), Iter(data + size), Iter(data2)));
+      assert(cuda::std::equal(policy, Iter(data), Iter(data + size), Iter(data2), Iter(data2 + size)));
+
+      if (size > 0)
+      {
+        data2[size - 1] = -1;
+        assert(!cuda::std::equal(policy, Iter(data), Iter(data + size), Iter(data2)));
+        assert(!cuda::std::equal(policy, Iter(data), Iter(data + size), Iter(data2), cuda::std::equal_to<>{}));
+        assert(cuda::std::equal(policy, Iter(data), Iter(data + size - 1), Iter(data2), Iter(data2 + size - 1)));
+
+        // ranges of different lengths are never equal
+        assert(!cuda::std::equal(policy, Iter(data), Iter(data + size - 1), Iter(data), Iter(data + size)));
+        assert(!cuda::std::equal(
+          policy, Iter(data), Iter(data + size), Iter(data), Iter(data + size - 1), cuda::std::equal_to<>{}));
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -8,13 +8,14 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class T>
-// void find(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, T val);
+//   ForwardIterator find(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last,
+//                        const T& value);
 
 #include <cuda/std/algorithm>
 #include <cuda/std/cassert>
+#include <cuda/std/numeric>
 
 #include "test_execution_policies.h"
 #include "test_iterators.h"
@@ -25,7 +26,7 @@ EXECUTION_POLICY_SFINAE_TEST(find);
 static_assert(!sfinae_test_find<int, int*, int*, int>);
 static_assert(sfinae_test_find<cuda::std::execution::parallel_policy, int*, int*, int>);
 
-int data[100];
+int data[pstl_test_max_size];
 
 template <class Iter>
 struct Test
@@ -33,19 +34,32 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
-      cuda::std::iota(data, data + size, 1);
-      const auto res = cuda::std::find(policy, Iter(data), Iter(data + size), size);
+      cuda::std::iota(data, data + size, 0);
+      auto res = cuda::std::find(policy, Iter(data), Iter(data + size), -1);
       assert(res == Iter(data + size));
+
+      if (size > 0)
+      {
+        res = cuda::std::find(policy, Iter(data), Iter(data + size), 0);
+        assert(res == Iter(data));
+
+        res = cuda::std::find(policy, Iter(data), Iter(data + size), size - 1);
+        assert(res == Iter(data + size - 1));
+
+        // the first of several matches is found
+        data[size - 1] = size / 2;
+        res            = cuda::std::find(policy, Iter(data), Iter(data + size), size / 2);
+        assert(res == Iter(data + size / 2));
+      }
     }
   }
 };
 
 void test()
 {
-  types::find(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
 }
 
 int main(int, char**)
@@ -8,13 +8,14 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class UnaryPredicate>
-// void find_if(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, UnaryPredicate pred);
+//   ForwardIterator find_if(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last,
+//                           UnaryPredicate pred);
 
 #include <cuda/std/algorithm>
 #include <cuda/std/cassert>
+#include <cuda/std/numeric>
 
 #include "test_execution_policies.h"
 #include "test_iterators.h"
@@ -25,7 +26,17 @@ EXECUTION_POLICY_SFINAE_TEST(find_if);
 static_assert(!sfinae_test_find_if<int, int*, int*, bool (*)(int)>);
 static_assert(sfinae_test_find_if<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
 
-int data[100];
+int data[pstl_test_max_size];
+
+struct equal_to
+{
+  int value_;
+
+  TEST_FUNC constexpr bool operator()(const int v) const noexcept
+  {
+    return v == value_;
+  }
+};
 
 template <class Iter>
 struct Test
@@ -33,21 +44,32 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
-      cuda::std::iota(data, data + size, 1);
-      const auto res = cuda::std::find_if(policy, Iter(data), Iter(data + size), [size](const int v) {
-        return v == size;
-      });
+      cuda::std::iota(data, data + size, 0);
+      auto res = cuda::std::find_if(policy, Iter(data), Iter(data + size), equal_to{-1});
       assert(res == Iter(data + size));
+
+      if (size > 0)
+      {
+        res = cuda::std::find_if(policy, Iter(data), Iter(data + size), equal_to{0});
+        assert(res == Iter(data));
+
+        res = cuda::std::find_if(policy, Iter(data), Iter(data + size), equal_to{size - 1});
+        assert(res == Iter(data + size - 1));
+
+        // the first of several matches is found
+        data[size - 1] = size / 2;
+        res            = cuda::std::find_if(policy, Iter(data), Iter(data + size), equal_to{size / 2});
+        assert(res == Iter(data + size / 2));
+      }
     }
   }
 };
 
 void test()
 {
-  types::find(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
 }
 
 int main(int, char**)
@@ -8,7 +8,6 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class Function>
 //   void for_each(ExecutionPolicy&& exec,
@@ -27,8 +26,8 @@ EXECUTION_POLICY_SFINAE_TEST(for_each);
 static_assert(!sfinae_test_for_each<int, int*, int*, bool (*)(int)>);
 static_assert(sfinae_test_for_each<cuda::std::execution::parallel_policy, int*, int*, bool (*)(int)>);
 
-int data[100];
-bool called[100];
+int data[pstl_test_max_size];
+bool called[pstl_test_max_size];
 
 template <class Iter>
 struct Test
@@ -36,8 +35,7 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
       cuda::std::fill(called, called + size, false);
       cuda::std::for_each(policy, Iter(data), Iter(data + size), [&](int& v) {
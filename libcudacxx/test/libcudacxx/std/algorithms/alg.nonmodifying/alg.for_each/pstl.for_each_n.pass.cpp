@@ -8,7 +8,6 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator, class Size, class Function>
 //   ForwardIterator for_each_n(ExecutionPolicy&& exec, ForwardIterator first, Size n,
@@ -26,8 +25,8 @@ EXECUTION_POLICY_SFINAE_TEST(for_each_n);
 static_assert(!sfinae_test_for_each_n<int, int*, int, bool (*)(int)>);
 static_assert(sfinae_test_for_each_n<cuda::std::execution::parallel_policy, int*, int, bool (*)(int)>);
 
-int data[100];
-bool called[100];
+int data[pstl_test_max_size];
+bool called[pstl_test_max_size];
 
 template <class Iter>
 struct Test
@@ -35,14 +34,14 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    int sizes[] = {0, 1, 2, 100};
-    for (auto size : sizes)
+    for (auto size : pstl_test_sizes)
     {
       cuda::std::fill(called, called + size, false);
-      cuda::std::for_each_n(policy, Iter(data), size, [&](int& v) {
+      const auto res = cuda::std::for_each_n(policy, Iter(data), size, [&](int& v) {
         assert(!called[&v - data]);
         called[&v - data] = true;
       });
+      assert(res == Iter(data + size));
       assert(cuda::std::all_of(called, called + size, [](bool b) {
         return b;
       }));
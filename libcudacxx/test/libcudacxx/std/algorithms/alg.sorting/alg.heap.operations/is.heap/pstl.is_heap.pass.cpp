@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class RandomAccessIterator>
+//   bool is_heap(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last);
+// template<class ExecutionPolicy, class RandomAccessIterator, class Compare>
+//   bool is_heap(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(is_heap);
+
+static_assert(!sfinae_test_is_heap<int, int*, int*>);
+static_assert(sfinae_test_is_heap<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      // a descending sequence is a max heap but not a min heap
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = size - i;
+      }
+      assert(cuda::std::is_heap(policy, Iter(data), Iter(data + size)));
+      assert(cuda::std::is_heap(policy, Iter(data), Iter(data + size), cuda::std::greater<>{}) == (size < 2));
+
+      if (size >= 2)
+      {
+        data[size - 1] = size + 1;
+        assert(!cuda::std::is_heap(policy, Iter(data), Iter(data + size)));
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::random_access_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class RandomAccessIterator>
+//   RandomAccessIterator is_heap_until(ExecutionPolicy&& exec, RandomAccessIterator first,
+//                                      RandomAccessIterator last);
+// template<class ExecutionPolicy, class RandomAccessIterator, class Compare>
+//   RandomAccessIterator is_heap_until(ExecutionPolicy&& exec, RandomAccessIterator first,
+//                                      RandomAccessIterator last, Compare comp);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(is_heap_until);
+
+static_assert(!sfinae_test_is_heap_until<int, int*, int*>);
+static_assert(sfinae_test_is_heap_until<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = size - i;
+      }
+      assert(cuda::std::is_heap_until(policy, Iter(data), Iter(data + size)) == Iter(data + size));
+
+      if (size >= 2)
+      {
+        const auto res = cuda::std::is_heap_until(policy, Iter(data), Iter(data + size), cuda::std::greater<>{});
+        assert(res == Iter(data + 1));
+
+        // the first of several elements that break the heap is found
+        data[size - 1] = size + 1;
+        assert(cuda::std::is_heap_until(policy, Iter(data), Iter(data + size)) == Iter(data + size - 1));
+        data[size / 2] = size + 1;
+        assert(cuda::std::is_heap_until(policy, Iter(data), Iter(data + size)) == Iter(data + size / 2));
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::random_access_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
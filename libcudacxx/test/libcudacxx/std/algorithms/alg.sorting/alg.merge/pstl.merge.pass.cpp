@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class ForwardIterator>
+//   ForwardIterator merge(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1,
+//                         ForwardIterator2 first2, ForwardIterator2 last2, ForwardIterator result);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class ForwardIterator,
+//          class Compare>
+//   ForwardIterator merge(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1,
+//                         ForwardIterator2 first2, ForwardIterator2 last2, ForwardIterator result, Compare comp);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(merge);
+
+static_assert(!sfinae_test_merge<int, int*, int*, int*, int*, int*>);
+static_assert(sfinae_test_merge<cuda::std::execution::parallel_policy, int*, int*, int*, int*, int*>);
+
+int lhs[pstl_test_max_size];
+int rhs[pstl_test_max_size];
+int out[2 * pstl_test_max_size];
+int expected[2 * pstl_test_max_size];
+
+// Long runs of equivalent elements in both ranges
+struct thousands_less
+{
+  TEST_FUNC constexpr bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs / 1000 < rhs / 1000;
+  }
+};
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      // even values in the first range and odd values in the second, so that the order of equivalent elements shows
+      for (int i = 0; i < size; ++i)
+      {
+        lhs[i] = 2 * i;
+        rhs[i] = 2 * i + 1;
+      }
+
+      for (const int size2 : {0, size / 2, size})
+      {
+        auto expected_end = cuda::std::merge(lhs, lhs + size, rhs, rhs + size2, expected);
+
+        auto res = cuda::std::merge(policy, Iter(lhs), Iter(lhs + size), Iter(rhs), Iter(rhs + size2), Iter(out));
+        assert(res == Iter(out + size + size2));
+        assert(cuda::std::equal(expected, expected_end, out));
+
+        expected_end = cuda::std::merge(lhs, lhs + size, rhs, rhs + size2, expected, thousands_less{});
+
+        res = cuda::std::merge(
+          policy, Iter(lhs), Iter(lhs + size), Iter(rhs), Iter(rhs + size2), Iter(out), thousands_less{});
+        assert(res == Iter(out + size + size2));
+        assert(cuda::std::equal(expected, expected_end, out));
+      }
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
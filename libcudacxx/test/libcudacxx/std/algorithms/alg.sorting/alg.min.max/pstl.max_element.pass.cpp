@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   ForwardIterator max_element(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator, class Compare>
+//   ForwardIterator max_element(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, Compare comp);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(max_element);
+
+static_assert(!sfinae_test_max_element<int, int*, int*>);
+static_assert(sfinae_test_max_element<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      // every value repeats, the first of the equal elements is found
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = (i * 7919) % 1009;
+      }
+
+      auto res = cuda::std::max_element(policy, Iter(data), Iter(data + size));
+      assert(base(res) == cuda::std::max_element(data, data + size));
+
+      res = cuda::std::max_element(policy, Iter(data), Iter(data + size), cuda::std::greater<>{});
+      assert(base(res) == cuda::std::max_element(data, data + size, cuda::std::greater<>{}));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class RandomAccessIterator>
+//   void sort(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last);
+// template<class ExecutionPolicy, class RandomAccessIterator, class Compare>
+//   void sort(ExecutionPolicy&& exec, RandomAccessIterator first, RandomAccessIterator last, Compare comp);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(sort);
+
+static_assert(!sfinae_test_sort<int, int*, int*>);
+static_assert(sfinae_test_sort<cuda::std::execution::parallel_policy, int*, int*>);
+
+int data[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = (i * 7919) % 1009;
+      }
+      cuda::std::copy(data, data + size, expected);
+      cuda::std::sort(expected, expected + size);
+
+      cuda::std::sort(policy, Iter(data), Iter(data + size));
+      assert(cuda::std::equal(data, data + size, expected));
+
+      cuda::std::sort(policy, Iter(data), Iter(data + size), cuda::std::greater<>{});
+      cuda::std::reverse(expected, expected + size);
+      assert(cuda::std::equal(data, data + size, expected));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::random_access_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
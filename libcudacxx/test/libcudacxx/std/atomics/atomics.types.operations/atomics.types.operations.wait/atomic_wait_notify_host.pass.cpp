@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// Many host threads sleeping in wait are woken by notify_one and notify_all, for values that are waited on directly
+// and for values that share the waiter slots of the implementation. Waiters of the system scope also wake up for
+// writers that do not notify them, like devices.
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+// The tokens and rounds fit into a signed char
+constexpr int num_waiters = 8;
+constexpr int num_rounds  = 15;
+
+// Every waiter takes a token handed out one at a time by notify_one, so a lost wakeup hangs the test
+template <class T>
+void test_notify_one()
+{
+  cuda::std::atomic<T> tokens(T(0));
+  cuda::std::atomic<int> taken(0);
+
+  std::thread waiters[num_waiters];
+  for (auto& waiter : waiters)
+  {
+    waiter = std::thread([&] {
+      for (int round = 0; round < num_rounds; ++round)
+      {
+        T current = tokens.load();
+        while (current == T(0) || !tokens.compare_exchange_weak(current, T(current - 1)))
+        {
+          if (current == T(0))
+          {
+            tokens.wait(T(0));
+            current = tokens.load();
+          }
+        }
+        taken.fetch_add(1);
+      }
+    });
+  }
+
+  for (int token = 0; token < num_waiters * num_rounds; ++token)
+  {
+    tokens.fetch_add(T(1));
+    tokens.notify_one();
+  }
+  for (auto& waiter : waiters)
+  {
+    waiter.join();
+  }
+  assert(taken.load() == num_waiters * num_rounds);
+  assert(tokens.load() == T(0));
+}
+
+// Every waiter waits for each round to be published by notify_all
+template <class T>
+void test_notify_all()
+{
+  cuda::std::atomic<T> round(T(0));
+  cuda::std::atomic<int> arrived(0);
+
+  std::thread waiters[num_waiters];
+  for (auto& waiter : waiters)
+  {
+    waiter = std::thread([&] {
+      for (int r = 0; r < num_rounds; ++r)
+      {
+        round.wait(T(r));
+        arrived.fetch_add(1);
+      }
+    });
+  }
+
+  for (int r = 1; r <= num_rounds; ++r)
+  {
+    while (arrived.load() < num_waiters * (r - 1))
+    {
+      std::this_thread::yield();
+    }
+    round.store(T(r));
+    round.notify_all();
+  }
+  for (auto& waiter : waiters)
+  {
+    waiter.join();
+  }
+  assert(arrived.load() == num_waiters * num_rounds);
+}
+
+// Distinct atomic_ref objects of the same value wait and notify on the same address
+void test_atomic_ref()
+{
+  int value = 0;
+
+  std::thread waiter([&] {
+    cuda::std::atomic_ref<int> ref(value);
+    ref.wait(0);
+    assert(ref.load() == 1);
+  });
+
+  cuda::std::atomic_ref<int> ref(value);
+  ref.store(1);
+  ref.notify_one();
+  waiter.join();
+}
+
+// The writer changes the value without notifying, so the waiter has to find the new value on its own
+template <class T>
+void test_no_notify()
+{
+  cuda::std::atomic<T> value(T(0));
+
+  std::thread waiter([&] {
+    value.wait(T(0));
+    assert(value.load() == T(1));
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  value.store(T(1));
+  waiter.join();
+}
+
+template <class T>
+void test()
+{
+  test_notify_one<T>();
+  test_notify_all<T>();
+  test_no_notify<T>();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test<signed char>(); test<short>(); test<int>(); test<unsigned>(); test<long long>(); test<float>();
+                test<double>(); test_atomic_ref();))
+
+  return 0;
+}
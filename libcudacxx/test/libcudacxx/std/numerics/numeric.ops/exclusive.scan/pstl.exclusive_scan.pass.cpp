@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class T>
+//   ForwardIterator2 exclusive_scan(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                   ForwardIterator2 result, T init);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class T, class BinaryOperation>
+//   ForwardIterator2 exclusive_scan(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                   ForwardIterator2 result, T init, BinaryOperation binary_op);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(exclusive_scan);
+
+static_assert(!sfinae_test_exclusive_scan<int, int*, int*, int*, int>);
+static_assert(sfinae_test_exclusive_scan<cuda::std::execution::parallel_policy, int*, int*, int*, int>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      cuda::std::exclusive_scan(data, data + size, expected, 42);
+      auto res = cuda::std::exclusive_scan(policy, Iter(data), Iter(data + size), Iter(out), 42);
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(out, out + size, expected));
+
+      cuda::std::exclusive_scan(data, data + size, expected, 1, cuda::std::bit_xor<>{});
+      res = cuda::std::exclusive_scan(policy, Iter(data), Iter(data + size), Iter(out), 1, cuda::std::bit_xor<>{});
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(out, out + size, expected));
+
+      // in place
+      cuda::std::exclusive_scan(data, data + size, expected, 42);
+      res = cuda::std::exclusive_scan(policy, Iter(data), Iter(data + size), Iter(data), 42);
+      assert(res == Iter(data + size));
+      assert(cuda::std::equal(data, data + size, expected));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -8,7 +8,6 @@
 //===----------------------------------------------------------------------===//
 
 // UNSUPPORTED: nvrtc
-// XFAIL: true
 
 // template<class ExecutionPolicy, class ForwardIterator>
 //   typename iterator_traits<ForwardIterator>::value_type
@@ -30,13 +29,13 @@
 
 EXECUTION_POLICY_SFINAE_TEST(reduce);
 
-static_assert(!sfinae_test_reduce<cuda::std::execution::parallel_policy, int*, int*>);
+static_assert(!sfinae_test_reduce<int, int*, int*>);
 static_assert(sfinae_test_reduce<cuda::std::execution::parallel_policy, int*, int*>);
 
-static_assert(!sfinae_test_reduce<cuda::std::execution::parallel_policy, int*, int*, int>);
+static_assert(!sfinae_test_reduce<int, int*, int*, int>);
 static_assert(sfinae_test_reduce<cuda::std::execution::parallel_policy, int*, int*, int>);
 
-static_assert(!sfinae_test_reduce<cuda::std::execution::parallel_policy, int*, int*, int, int (*)(int, int)>);
+static_assert(!sfinae_test_reduce<int, int*, int*, int, int (*)(int, int)>);
 static_assert(sfinae_test_reduce<cuda::std::execution::parallel_policy, int*, int*, int, int (*)(int, int)>);
 
 class MoveOnly
@@ -120,8 +119,7 @@ public:
 };
 static_assert(cuda::std::is_convertible_v<MoveOnly, MoveOnly>);
 
-constexpr int max_size = 350;
-int data[max_size];
+int data[pstl_test_max_size];
 
 template <class Iter, class ValueT>
 struct Test
@@ -129,10 +127,10 @@ struct Test
   template <class Policy>
   void operator()(Policy&& policy)
   {
-    const cuda::std::pair<int, int> runs[] = {{0, 34}, {1, 36}, {2, 39}, {100, 5184}, {max_size, 61809}};
-    for (const auto& pair : runs)
+    for (auto size : pstl_test_sizes)
     {
-      auto [size, expected] = pair;
+      // the operation adds 2 on every call, which must happen once per element
+      const int expected = 34 + 2 * size + (size / 100) * 4950 + (size % 100) * (size % 100 - 1) / 2;
 
       {
         decltype(auto) ret =
@@ -158,7 +156,10 @@ struct Test
 
 void test()
 {
-  cuda::std::iota(data, data + max_size, 0);
+  for (int i = 0; i < pstl_test_max_size; ++i)
+  {
+    data[i] = i % 100;
+  }
   types::for_each(types::forward_iterator_list<int*>{}, types::apply_type_identity{[](auto v) {
                     using Iter = typename decltype(v)::type;
                     types::for_each(
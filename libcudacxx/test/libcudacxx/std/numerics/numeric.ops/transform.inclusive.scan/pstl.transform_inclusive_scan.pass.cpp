@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class BinaryOperation,
+//          class UnaryOperation>
+//   ForwardIterator2 transform_inclusive_scan(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                             ForwardIterator2 result, BinaryOperation binary_op,
+//                                             UnaryOperation unary_op);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class BinaryOperation,
+//          class UnaryOperation, class T>
+//   ForwardIterator2 transform_inclusive_scan(ExecutionPolicy&& exec, ForwardIterator1 first, ForwardIterator1 last,
+//                                             ForwardIterator2 result, BinaryOperation binary_op,
+//                                             UnaryOperation unary_op, T init);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(transform_inclusive_scan);
+
+static_assert(!sfinae_test_transform_inclusive_scan<int, int*, int*, int*, int (*)(int, int), int (*)(int)>);
+static_assert(sfinae_test_transform_inclusive_scan<cuda::std::execution::parallel_policy,
+                                                   int*,
+                                                   int*,
+                                                   int*,
+                                                   int (*)(int, int),
+                                                   int (*)(int)>);
+
+int data[pstl_test_max_size];
+int out[pstl_test_max_size];
+int expected[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      cuda::std::transform_inclusive_scan(data, data + size, expected, cuda::std::plus<>{}, cuda::std::negate<>{});
+      auto res = cuda::std::transform_inclusive_scan(
+        policy, Iter(data), Iter(data + size), Iter(out), cuda::std::plus<>{}, cuda::std::negate<>{});
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(out, out + size, expected));
+
+      cuda::std::transform_inclusive_scan(data, data + size, expected, cuda::std::plus<>{}, cuda::std::negate<>{}, 42);
+      res = cuda::std::transform_inclusive_scan(
+        policy, Iter(data), Iter(data + size), Iter(out), cuda::std::plus<>{}, cuda::std::negate<>{}, 42);
+      assert(res == Iter(out + size));
+      assert(cuda::std::equal(out, out + size, expected));
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class T>
+//   T transform_reduce(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1,
+//                      ForwardIterator2 first2, T init);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class T, class BinaryOperation1,
+//          class BinaryOperation2>
+//   T transform_reduce(ExecutionPolicy&& exec, ForwardIterator1 first1, ForwardIterator1 last1,
+//                      ForwardIterator2 first2, T init, BinaryOperation1 binary_op1, BinaryOperation2 binary_op2);
+// template<class ExecutionPolicy, class ForwardIterator, class T, class BinaryOperation, class UnaryOperation>
+//   T transform_reduce(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, T init,
+//                      BinaryOperation binary_op, UnaryOperation unary_op);
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+EXECUTION_POLICY_SFINAE_TEST(transform_reduce);
+
+static_assert(!sfinae_test_transform_reduce<int, int*, int*, int*, int>);
+static_assert(sfinae_test_transform_reduce<cuda::std::execution::parallel_policy, int*, int*, int*, int>);
+
+int data[pstl_test_max_size];
+int data2[pstl_test_max_size];
+
+template <class Iter>
+struct Test
+{
+  template <class Policy>
+  void operator()(Policy&& policy)
+  {
+    for (auto size : pstl_test_sizes)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        data[i] = i % 10;
+      }
+
+      cuda::std::iota(data2, data2 + size, 0);
+
+      auto expected = cuda::std::transform_reduce(data, data + size, data2, 42ll);
+      assert(cuda::std::transform_reduce(policy, Iter(data), Iter(data + size), Iter(data2), 42ll) == expected);
+
+      expected = cuda::std::transform_reduce(data, data + size, data2, 42ll, cuda::std::plus<>{}, cuda::std::minus<>{});
+      assert(cuda::std::transform_reduce(
+               policy, Iter(data), Iter(data + size), Iter(data2), 42ll, cuda::std::plus<>{}, cuda::std::minus<>{})
+             == expected);
+
+      expected = cuda::std::transform_reduce(data, data + size, 42ll, cuda::std::plus<>{}, cuda::std::negate<>{});
+      assert(cuda::std::transform_reduce(
+               policy, Iter(data), Iter(data + size), 42ll, cuda::std::plus<>{}, cuda::std::negate<>{})
+             == expected);
+    }
+  }
+};
+
+void test()
+{
+  types::for_each(types::forward_iterator_list<int*>{}, TestIteratorWithPolicies<Test>{});
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+
+  return 0;
+}
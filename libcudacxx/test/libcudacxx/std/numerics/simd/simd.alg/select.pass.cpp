@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: enable-tile
+// error: asm statement is unsupported in tile code
+
+// <cuda/std/__simd_>
+
+// [simd.alg], select
+//
+// template<class T, class U>
+//   constexpr auto select(bool c, const T& a, const U& b) -> remove_cvref_t<decltype(c ? a : b)>;
+//
+// template<size_t Bytes, class Abi, class T, class U>
+//   constexpr auto select(const basic_mask<Bytes, Abi>& c, const T& a, const U& b) noexcept
+//     -> decltype(simd-select-impl(c, a, b));
+
+#include <cuda/std/__simd_>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "../simd_test_utils.h"
+#include "test_macros.h"
+
+template <typename T, int N>
+TEST_FUNC constexpr void test_select_vec()
+{
+  using Vec  = simd::basic_vec<T, simd::fixed_size<N>>;
+  using Mask = typename Vec::mask_type;
+
+  Mask even(is_even{});
+  Vec lhs(iota_generator<T>{});
+  Vec rhs(T{42});
+
+  static_assert(cuda::std::is_same_v<decltype(simd::select(even, lhs, rhs)), Vec>);
+  static_assert(noexcept(simd::select(even, lhs, rhs)));
+
+  Vec res = simd::select(even, lhs, rhs);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(res[i] == ((i % 2 == 0) ? lhs[i] : T{42}));
+  }
+
+  Vec res2 = simd::select(even, lhs, T{42});
+  assert(simd::all_of(res2 == res));
+  assert(simd::all_of(simd::select(Mask(true), lhs, rhs) == lhs));
+  assert(simd::all_of(simd::select(Mask(false), lhs, rhs) == rhs));
+}
+
+template <int Bytes, int N>
+TEST_FUNC constexpr void test_select_mask()
+{
+  using Mask = simd::basic_mask<Bytes, simd::fixed_size<N>>;
+
+  Mask even(is_even{});
+  Mask first(is_first_half{});
+
+  static_assert(cuda::std::is_same_v<decltype(simd::select(even, first, !first)), Mask>);
+  static_assert(noexcept(simd::select(even, first, !first)));
+
+  Mask res = simd::select(even, first, !first);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(res[i] == ((i % 2 == 0) ? (i < 2) : !(i < 2)));
+  }
+
+  static_assert(cuda::std::is_same_v<decltype(simd::select(even, true, false)), Mask>);
+  assert(simd::all_of(simd::select(even, true, false) == even));
+  assert(simd::all_of(simd::select(even, false, true) == !even));
+  assert(simd::all_of(simd::select(even, true, true)));
+  assert(simd::none_of(simd::select(even, false, false)));
+}
+
+TEST_FUNC constexpr void test_select_bool()
+{
+  static_assert(cuda::std::is_same_v<decltype(simd::select(true, 1, 2)), int>);
+  static_assert(cuda::std::is_same_v<decltype(simd::select(true, 1, 2.0)), double>);
+  assert(simd::select(true, 1, 2) == 1);
+  assert(simd::select(false, 1, 2) == 2);
+}
+
+template <typename T>
+TEST_FUNC constexpr void test_type()
+{
+  test_select_vec<T, 1>();
+  test_select_vec<T, 4>();
+  test_select_vec<T, 19>();
+  test_select_mask<sizeof(T), 1>();
+  test_select_mask<sizeof(T), 4>();
+  test_select_mask<sizeof(T), 19>();
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_type<int8_t>();
+  test_type<uint16_t>();
+  test_type<int32_t>();
+  test_type<int64_t>();
+  test_type<float>();
+  test_type<double>();
+  test_select_bool();
+  return true;
+}
+
+int main(int, char**)
+{
+  assert(test());
+  static_assert(test());
+  return 0;
+}
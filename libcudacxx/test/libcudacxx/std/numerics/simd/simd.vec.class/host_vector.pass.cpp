@@ -0,0 +1,207 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: enable-tile
+// error: asm statement is unsupported in tile code
+
+// <cuda/std/__simd_>
+
+// Sizes that span several host vector registers and leave a scalar tail, and the native ABI. Covers the arithmetic,
+// masks, select, shifts, loads and stores.
+
+#include <cuda/std/__simd_>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "../simd_test_utils.h"
+#include "test_macros.h"
+
+template <typename T>
+TEST_FUNC constexpr T value_at(int i)
+{
+  return static_cast<T>((i * 37 + 11) % 23 - (cuda::std::is_signed_v<T> ? 9 : 0));
+}
+
+template <typename T>
+struct value_generator
+{
+  template <typename I>
+  TEST_FUNC constexpr T operator()(I i) const
+  {
+    return value_at<T>(static_cast<int>(i));
+  }
+};
+
+template <typename T, int N>
+TEST_FUNC constexpr void test_type()
+{
+  using Vec  = simd::basic_vec<T, simd::fixed_size<N>>;
+  using Mask = typename Vec::mask_type;
+
+  Vec vec(value_generator<T>{});
+  Vec res  = vec + vec * vec;
+  Mask cmp = vec < res;
+
+  T sum = T{};
+  T min = value_at<T>(0);
+  T max = value_at<T>(0);
+  for (int i = 0; i < N; ++i)
+  {
+    const T value    = value_at<T>(i);
+    const T expected = static_cast<T>(value + static_cast<T>(value * value));
+    assert(res[i] == expected);
+    assert(cmp[i] == (value < expected));
+    assert((-vec)[i] == static_cast<T>(-value));
+
+    sum = static_cast<T>(sum + value);
+    min = value < min ? value : min;
+    max = value > max ? value : max;
+  }
+  assert(simd::reduce(vec) == sum);
+  assert(simd::reduce_min(vec) == min);
+  assert(simd::reduce_max(vec) == max);
+}
+
+template <typename T, int N>
+TEST_FUNC constexpr void test_mask_select()
+{
+  using Vec  = simd::basic_vec<T, simd::fixed_size<N>>;
+  using Mask = typename Vec::mask_type;
+
+  Vec vec(value_generator<T>{});
+  Mask cmp = vec < Vec(T{5});
+  Mask even(is_even{});
+
+  Mask both   = cmp && even;
+  Mask either = cmp || even;
+  Mask diff   = cmp ^ even;
+  Mask inv    = !cmp;
+  Vec sel     = simd::select(cmp, vec, Vec(T{5}));
+  for (int i = 0; i < N; ++i)
+  {
+    const bool less = value_at<T>(i) < T{5};
+    assert(cmp[i] == less);
+    assert(both[i] == (less && i % 2 == 0));
+    assert(either[i] == (less || i % 2 == 0));
+    assert(diff[i] == (less != (i % 2 == 0)));
+    assert(inv[i] == !less);
+    assert(sel[i] == (less ? value_at<T>(i) : T{5}));
+  }
+  assert(simd::reduce_count(cmp) + simd::reduce_count(inv) == N);
+}
+
+template <typename T, int N>
+TEST_FUNC constexpr void test_shift()
+{
+  using Vec = simd::basic_vec<T, simd::fixed_size<N>>;
+
+  // left shifts of negative values are undefined
+  Vec vec([](auto i) {
+    return static_cast<T>((i * 37 + 11) % 23);
+  });
+  Vec amount([](auto i) {
+    return static_cast<T>(i % 7);
+  });
+  Vec left  = vec << amount;
+  Vec right = vec >> amount;
+  for (int i = 0; i < N; ++i)
+  {
+    const T value = static_cast<T>((i * 37 + 11) % 23);
+    assert(left[i] == static_cast<T>(value << (i % 7)));
+    assert(right[i] == static_cast<T>(value >> (i % 7)));
+  }
+  assert(simd::all_of((vec << 3) == (vec * Vec(T{8}))));
+}
+
+template <typename T, int N>
+TEST_FUNC constexpr void test_load_store()
+{
+  using Vec  = simd::basic_vec<T, simd::fixed_size<N>>;
+  using Mask = typename Vec::mask_type;
+
+  T data[N]{};
+  for (int i = 0; i < N; ++i)
+  {
+    data[i] = value_at<T>(i);
+  }
+  Mask even(is_even{});
+
+  Vec full    = simd::unchecked_load<Vec>(data, N);
+  Vec masked  = simd::unchecked_load<Vec>(data, N, even);
+  Vec partial = simd::partial_load<Vec>(data, N - 1);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(full[i] == data[i]);
+    assert(masked[i] == ((i % 2 == 0) ? data[i] : T{}));
+    assert(partial[i] == ((i < N - 1) ? data[i] : T{}));
+  }
+
+  T out[N]{};
+  simd::unchecked_store(full + full, out, N);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(out[i] == static_cast<T>(data[i] + data[i]));
+  }
+  simd::unchecked_store(full, out, N, even);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(out[i] == ((i % 2 == 0) ? data[i] : static_cast<T>(data[i] + data[i])));
+  }
+}
+
+template <typename T, int N>
+TEST_FUNC constexpr void test_all()
+{
+  test_type<T, N>();
+  test_mask_select<T, N>();
+  test_load_store<T, N>();
+  if constexpr (cuda::std::is_integral_v<T>)
+  {
+    test_shift<T, N>();
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_all<int8_t, 63>();
+  test_all<uint8_t, 64>();
+  test_all<int16_t, 33>();
+  test_all<int32_t, 19>();
+  test_all<uint32_t, 61>();
+  test_all<int64_t, 9>();
+  test_all<uint64_t, 16>();
+  test_all<float, 7>();
+  test_all<float, 37>();
+  test_all<double, 5>();
+  return true;
+}
+
+TEST_FUNC constexpr bool test_native()
+{
+  using Vec = simd::basic_vec<float>;
+  static_assert(Vec::size() >= 1);
+  Vec vec(value_generator<float>{});
+  float sum = 0.0f;
+  for (int i = 0; i < Vec::size(); ++i)
+  {
+    sum += value_at<float>(i);
+  }
+  assert(simd::reduce(vec) == sum);
+  return true;
+}
+
+int main(int, char**)
+{
+  assert(test());
+  static_assert(test());
+  assert(test_native());
+  static_assert(test_native());
+  return 0;
+}
@@ -0,0 +1,193 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// CONSTEXPR_STEPS: 15000000
+
+#include <cuda/std/array>
+#include <cuda/std/bit>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr double inf_value = cuda::std::numeric_limits<double>::infinity();
+constexpr double nan_value = cuda::std::numeric_limits<double>::quiet_NaN();
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::size_t consumed;
+  cuda::std::errc ec;
+  double val; //!< The parsed value, or the initial value 42 when the input is not accepted.
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+//
+// // pairs of the input and the index of its format in fmts
+// constexpr const char* list[] = {...};
+//
+// int main()
+// {
+//   const char* fmt_names[]        = {"", "scientific", "fixed", "general", "hex"};
+//   const std::chars_format fmts[] = {
+//     std::chars_format{},
+//     std::chars_format::scientific,
+//     std::chars_format::fixed,
+//     std::chars_format::general,
+//     std::chars_format::hex};
+//
+//   for (std::size_t i = 0; i < std::size(list); i += 2)
+//   {
+//     const char* str   = list[i];
+//     const int f       = list[i + 1][0] - '0';
+//     T value           = double{42};
+//     const auto result = std::from_chars(str, str + std::strlen(str), value, fmts[f]);
+//     const char* ec    = (result.ec == std::errc{})                 ? "cuda::std::errc{}"
+//                       : (result.ec == std::errc::invalid_argument) ? "cuda::std::errc::invalid_argument"
+//                                                                    : "cuda::std::errc::result_out_of_range";
+//     // the value is printed with %a, or as inf or nan
+//     std::printf("    TestItem{\"%s\", cuda::std::chars_format::%s, %d, %s, %a},\n",
+//                 str, fmt_names[f], static_cast<int>(result.ptr - str), ec, static_cast<double>(value));
+//   }
+// }
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 47> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"-0.0", cuda::std::chars_format::general, 4, cuda::std::errc{}, -0x0p+0},
+    TestItem{"1.5", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.8p+0},
+    TestItem{"1.5e3", cuda::std::chars_format::general, 5, cuda::std::errc{}, 0x1.77p+10},
+    TestItem{"1.5e3", cuda::std::chars_format::scientific, 5, cuda::std::errc{}, 0x1.77p+10},
+    TestItem{"1.5", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 42.0},
+    TestItem{"1.5e3", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.8p+0},
+    TestItem{".5", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1p-1},
+    TestItem{"5.", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1.4p+2},
+    TestItem{"0.1", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.999999999999ap-4},
+    TestItem{"1e22", cuda::std::chars_format::general, 4, cuda::std::errc{}, 0x1.0f0cf064dd592p+73},
+    TestItem{
+      "123456789012345678901234567890", cuda::std::chars_format::general, 30, cuda::std::errc{}, 0x1.8ee90ff6c373ep+96},
+    TestItem{
+      "0.30000000000000001665334536938", cuda::std::chars_format::general, 31, cuda::std::errc{}, 0x1.3333333333334p-2},
+    TestItem{"9007199254740993", cuda::std::chars_format::general, 16, cuda::std::errc{}, 0x1p+53},
+    TestItem{"9007199254740995", cuda::std::chars_format::general, 16, cuda::std::errc{}, 0x1.0000000000002p+53},
+    TestItem{"1.00000000000000011102230246251565404236316680908203125",
+             cuda::std::chars_format::general,
+             55,
+             cuda::std::errc{},
+             0x1p+0},
+    TestItem{"1.00000000000000011102230246251565404236316680908203126",
+             cuda::std::chars_format::general,
+             55,
+             cuda::std::errc{},
+             0x1.0000000000001p+0},
+    TestItem{
+      "1.7976931348623157e308", cuda::std::chars_format::general, 22, cuda::std::errc{}, 0x1.fffffffffffffp+1023},
+    TestItem{"2.2250738585072014e-308", cuda::std::chars_format::general, 23, cuda::std::errc{}, 0x1p-1022},
+    TestItem{
+      "4.9406564584124654e-324", cuda::std::chars_format::general, 23, cuda::std::errc{}, 0x0.0000000000001p-1022},
+    TestItem{
+      "2.4703282292062328e-324", cuda::std::chars_format::general, 23, cuda::std::errc{}, 0x0.0000000000001p-1022},
+    TestItem{
+      "2.4703282292062327e-324", cuda::std::chars_format::general, 23, cuda::std::errc::result_out_of_range, 42.0},
+    TestItem{"1e309", cuda::std::chars_format::general, 5, cuda::std::errc::result_out_of_range, 42.0},
+    TestItem{"-1e-400", cuda::std::chars_format::general, 7, cuda::std::errc::result_out_of_range, 42.0},
+    TestItem{"1e", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1e+", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1E-2", cuda::std::chars_format::general, 4, cuda::std::errc{}, 0x1.47ae147ae147bp-7},
+    TestItem{
+      "1e100000000000000000000", cuda::std::chars_format::general, 23, cuda::std::errc::result_out_of_range, 42.0},
+    TestItem{
+      "1e-100000000000000000000", cuda::std::chars_format::general, 24, cuda::std::errc::result_out_of_range, 42.0},
+    TestItem{"1.8p1", cuda::std::chars_format::hex, 5, cuda::std::errc{}, 0x1.8p+1},
+    TestItem{"-1p-1074", cuda::std::chars_format::hex, 8, cuda::std::errc{}, -0x0.0000000000001p-1022},
+    TestItem{"FF", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.fep+7},
+    TestItem{"1.fffffffffffff8p+1023", cuda::std::chars_format::hex, 22, cuda::std::errc::result_out_of_range, 42.0},
+    TestItem{"0.8p-1022", cuda::std::chars_format::hex, 9, cuda::std::errc{}, 0x0.8p-1022},
+    TestItem{"1p", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"inf", cuda::std::chars_format::general, 3, cuda::std::errc{}, inf_value},
+    TestItem{"-Infinity", cuda::std::chars_format::general, 9, cuda::std::errc{}, -inf_value},
+    TestItem{"infinit", cuda::std::chars_format::general, 3, cuda::std::errc{}, inf_value},
+    TestItem{"nan", cuda::std::chars_format::general, 3, cuda::std::errc{}, nan_value},
+    TestItem{"-NaN(abc_123)", cuda::std::chars_format::general, 13, cuda::std::errc{}, nan_value},
+    TestItem{"nan(", cuda::std::chars_format::general, 3, cuda::std::errc{}, nan_value},
+    TestItem{".", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 42.0},
+    TestItem{"e5", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 42.0},
+    TestItem{"+1", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 42.0},
+    TestItem{" 1", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 42.0},
+    TestItem{"-", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 42.0},
+    TestItem{"0x1p1", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x0p+0},
+  }};
+}
+
+TEST_FUNC constexpr void test_from_chars(const TestItem& item)
+{
+  const auto len = cuda::std::strlen(item.str);
+
+  double value{42};
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + item.consumed);
+
+  if (item.val != item.val)
+  {
+    assert(value != value);
+  }
+  else
+  {
+    // the sign of zero must match too
+    assert(cuda::std::bit_cast<cuda::std::uint64_t>(value) == cuda::std::bit_cast<cuda::std::uint64_t>(item.val));
+  }
+
+  // The general format is the default
+  if (item.fmt == cuda::std::chars_format::general)
+  {
+    double default_value{42};
+    const auto default_result = cuda::std::from_chars(item.str, item.str + len, default_value);
+    assert(default_result.ec == result.ec);
+    assert(default_result.ptr == result.ptr);
+    assert(default_value == value || (default_value != default_value && value != value));
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<double&>(),
+                                       cuda::std::chars_format{}))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<double&>())));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// CONSTEXPR_STEPS: 15000000
+
+#include <cuda/std/array>
+#include <cuda/std/bit>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr float inf_value = cuda::std::numeric_limits<float>::infinity();
+constexpr float nan_value = cuda::std::numeric_limits<float>::quiet_NaN();
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::size_t consumed;
+  cuda::std::errc ec;
+  float val; //!< The parsed value, or the initial value 42 when the input is not accepted.
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+//
+// // pairs of the input and the index of its format in fmts
+// constexpr const char* list[] = {...};
+//
+// int main()
+// {
+//   const char* fmt_names[]        = {"", "scientific", "fixed", "general", "hex"};
+//   const std::chars_format fmts[] = {
+//     std::chars_format{},
+//     std::chars_format::scientific,
+//     std::chars_format::fixed,
+//     std::chars_format::general,
+//     std::chars_format::hex};
+//
+//   for (std::size_t i = 0; i < std::size(list); i += 2)
+//   {
+//     const char* str   = list[i];
+//     const int f       = list[i + 1][0] - '0';
+//     T value           = float{42};
+//     const auto result = std::from_chars(str, str + std::strlen(str), value, fmts[f]);
+//     const char* ec    = (result.ec == std::errc{})                 ? "cuda::std::errc{}"
+//                       : (result.ec == std::errc::invalid_argument) ? "cuda::std::errc::invalid_argument"
+//                                                                    : "cuda::std::errc::result_out_of_range";
+//     // the value is printed with %a, or as inf or nan
+//     std::printf("    TestItem{\"%s\", cuda::std::chars_format::%s, %d, %s, %a},\n",
+//                 str, fmt_names[f], static_cast<int>(result.ptr - str), ec, static_cast<double>(value));
+//   }
+// }
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 23> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"-0.0", cuda::std::chars_format::general, 4, cuda::std::errc{}, -0x0p+0f},
+    TestItem{"1.5", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.8p+0f},
+    TestItem{"1.5e3", cuda::std::chars_format::scientific, 5, cuda::std::errc{}, 0x1.77p+10f},
+    TestItem{"0.1", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.99999ap-4f},
+    TestItem{"16777217", cuda::std::chars_format::general, 8, cuda::std::errc{}, 0x1p+24f},
+    TestItem{"16777219", cuda::std::chars_format::general, 8, cuda::std::errc{}, 0x1.000004p+24f},
+    TestItem{"1.00000005960464477539062500", cuda::std::chars_format::general, 28, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.00000005960464477539062501", cuda::std::chars_format::general, 28, cuda::std::errc{}, 0x1.000002p+0f},
+    TestItem{"3.40282347e38", cuda::std::chars_format::general, 13, cuda::std::errc{}, 0x1.fffffep+127f},
+    TestItem{"3.4028236e38", cuda::std::chars_format::general, 12, cuda::std::errc::result_out_of_range, 42.0f},
+    TestItem{"1.17549435e-38", cuda::std::chars_format::general, 14, cuda::std::errc{}, 0x1p-126f},
+    TestItem{"1.4e-45", cuda::std::chars_format::general, 7, cuda::std::errc{}, 0x1p-149f},
+    TestItem{
+      "7.006492321624085e-46", cuda::std::chars_format::general, 21, cuda::std::errc::result_out_of_range, 42.0f},
+    TestItem{"7.006492321624086e-46", cuda::std::chars_format::general, 21, cuda::std::errc{}, 0x1p-149f},
+    TestItem{"123456789012345678901234567890", cuda::std::chars_format::general, 30, cuda::std::errc{}, 0x1.8ee91p+96f},
+    TestItem{"1.8p1", cuda::std::chars_format::hex, 5, cuda::std::errc{}, 0x1.8p+1f},
+    TestItem{"-1p-149", cuda::std::chars_format::hex, 7, cuda::std::errc{}, -0x1p-149f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::hex, 12, cuda::std::errc::result_out_of_range, 42.0f},
+    TestItem{"inf", cuda::std::chars_format::general, 3, cuda::std::errc{}, inf_value},
+    TestItem{"nan", cuda::std::chars_format::general, 3, cuda::std::errc{}, nan_value},
+    TestItem{"1e39", cuda::std::chars_format::general, 4, cuda::std::errc::result_out_of_range, 42.0f},
+    TestItem{"e5", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 42.0f},
+  }};
+}
+
+TEST_FUNC constexpr void test_from_chars(const TestItem& item)
+{
+  const auto len = cuda::std::strlen(item.str);
+
+  float value{42};
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + item.consumed);
+
+  if (item.val != item.val)
+  {
+    assert(value != value);
+  }
+  else
+  {
+    // the sign of zero must match too
+    assert(cuda::std::bit_cast<cuda::std::uint32_t>(value) == cuda::std::bit_cast<cuda::std::uint32_t>(item.val));
+  }
+
+  // The general format is the default
+  if (item.fmt == cuda::std::chars_format::general)
+  {
+    float default_value{42};
+    const auto default_result = cuda::std::from_chars(item.str, item.str + len, default_value);
+    assert(default_result.ec == result.ec);
+    assert(default_result.ptr == result.ptr);
+    assert(default_value == value || (default_value != default_value && value != value));
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<float&>(),
+                                       cuda::std::chars_format{}))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<float&>())));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
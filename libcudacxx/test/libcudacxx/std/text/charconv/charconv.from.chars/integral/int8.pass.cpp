@@ -16,6 +16,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <cuda/utility>
 
@@ -784,6 +785,110 @@ TEST_FUNC constexpr void test_overflow()
   }
 }
 
+// Test the base 10 inputs around the words of 8 characters, which are parsed at once as long as their digits cannot
+// overflow. Both the end of the input and a non-digit are put at every position of the words.
+template <class T>
+TEST_FUNC constexpr void test_word_boundaries()
+{
+  constexpr int base                     = 10;
+  constexpr char digits[]                = "98765432109876543210987654321098765432";
+  constexpr cuda::std::ptrdiff_t ndigits = sizeof(digits) - 1;
+  constexpr char non_digits[]            = {'0' - 1, '9' + 1, ' ', 'a', '\xb0'};
+
+  for (cuda::std::ptrdiff_t len = 0; len <= ndigits && len <= cuda::std::numeric_limits<T>::digits10; ++len)
+  {
+    T val{};
+    for (cuda::std::ptrdiff_t i = 0; i < len; ++i)
+    {
+      val = static_cast<T>(val * 10 + (digits[i] - '0'));
+    }
+    const auto exp_errc = (len == 0) ? cuda::std::errc::invalid_argument : cuda::std::errc{};
+
+    // 1. Test the input that ends after len digits
+    test_from_chars<T>(digits, len, base, len, exp_errc, val);
+
+    // 2. Test a non-digit after len digits, which is followed by more digits
+    for (const char non_digit : non_digits)
+    {
+      char buff[ndigits + 2]{};
+      cuda::std::strncpy(buff, digits, ndigits);
+      buff[len] = non_digit;
+      test_from_chars<T>(buff, ndigits, base, len, exp_errc, val);
+    }
+
+    // 3. Test the same with '-' at the beginning, which moves the words by one character (signed only)
+    if constexpr (cuda::std::is_signed_v<T>)
+    {
+      const auto exp_ptr_offset = (len == 0) ? 0 : len + 1;
+
+      char buff[ndigits + 2]{};
+      buff[0] = '-';
+      cuda::std::strncpy(buff + 1, digits, ndigits);
+      test_from_chars<T>(buff, len + 1, base, exp_ptr_offset, exp_errc, static_cast<T>(-val));
+
+      buff[len + 1] = '9' + 1;
+      test_from_chars<T>(buff, ndigits + 1, base, exp_ptr_offset, exp_errc, static_cast<T>(-val));
+    }
+  }
+}
+
+// Test the base 10 string of a limit, behind runs of leading zeros of different lengths
+template <class T>
+TEST_FUNC constexpr void test_limit(const char* str, cuda::std::errc exp_errc, T exp_val = {})
+{
+  constexpr int base                    = 10;
+  constexpr cuda::std::size_t buff_size = 150;
+
+  const cuda::std::ptrdiff_t sign = (str[0] == '-');
+  const auto len                  = static_cast<cuda::std::ptrdiff_t>(cuda::std::strlen(str));
+
+  for (const cuda::std::ptrdiff_t zeros : {0, 1, 7, 8, 9, 15, 16, 17, 64, 100})
+  {
+    char buff[buff_size]{};
+    buff[0] = '-';
+    for (cuda::std::ptrdiff_t i = sign; i < sign + zeros; ++i)
+    {
+      buff[i] = '0';
+    }
+    cuda::std::strncpy(buff + sign + zeros, str + sign, len - sign);
+
+    // 1. Test the original string
+    const auto size = len + zeros;
+    test_from_chars<T>(buff, size, base, size, exp_errc, exp_val);
+
+    // 2. Test a string that has invalid characters at the end
+    buff[size] = '9' + 1;
+    test_from_chars<T>(buff, size + 1, base, size, exp_errc, exp_val);
+  }
+}
+
+template <class T>
+TEST_FUNC constexpr void test_limits()
+{
+  // 1. Test `max` and `max + 1`
+  if constexpr (cuda::std::is_signed_v<T>)
+  {
+    test_limit<T>("127", cuda::std::errc{}, cuda::std::numeric_limits<T>::max());
+    test_limit<T>("128", cuda::std::errc::result_out_of_range);
+  }
+  else
+  {
+    test_limit<T>("255", cuda::std::errc{}, cuda::std::numeric_limits<T>::max());
+    test_limit<T>("256", cuda::std::errc::result_out_of_range);
+  }
+
+  // 2. Test `min` and `min - 1`
+  if constexpr (cuda::std::is_signed_v<T>)
+  {
+    test_limit<T>("-128", cuda::std::errc{}, cuda::std::numeric_limits<T>::min());
+    test_limit<T>("-129", cuda::std::errc::result_out_of_range);
+  }
+  else
+  {
+    test_limit<T>("0", cuda::std::errc{}, cuda::std::numeric_limits<T>::min());
+  }
+}
+
 template <int Base>
 TEST_FUNC constexpr bool test_base()
 {
@@ -804,6 +909,17 @@ TEST_FUNC constexpr bool test_base()
     test_overflow<cuda::std::uint8_t>();
   }
 
+  // Test the words and the limits (base 10 only)
+  if constexpr (Base == 10)
+  {
+    test_word_boundaries<char>();
+    test_word_boundaries<cuda::std::int8_t>();
+    test_word_boundaries<cuda::std::uint8_t>();
+    test_limits<char>();
+    test_limits<cuda::std::int8_t>();
+    test_limits<cuda::std::uint8_t>();
+  }
+
   return true;
 }
 
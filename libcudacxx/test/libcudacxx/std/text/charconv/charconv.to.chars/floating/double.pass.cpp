@@ -0,0 +1,408 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// CONSTEXPR_STEPS: 15000000
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+// The overload without a format
+constexpr cuda::std::chars_format no_format{};
+
+struct TestItem
+{
+  double val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <iostream>
+// #include <string>
+//
+// constexpr double list[] = {
+//   0.0, -0.0, 1.0, -1.5, 0.1, 0.3, 123.456, 1e22, 1e23, -9007199254740993.0, 1.234e-7, 5e-324,
+//   2.2250738585072014e-308, 1.7976931348623157e308, 999999.5, 0.000125};
+// constexpr const char* list_str[] = {...}; // the values above as strings
+//
+// int main()
+// {
+//   const std::chars_format fmts[] = {
+//     std::chars_format{},
+//     std::chars_format::scientific,
+//     std::chars_format::fixed,
+//     std::chars_format::general,
+//     std::chars_format::hex};
+//   const char* fmt_names[] = {"", "scientific", "fixed", "general", "hex"};
+//
+//   for (std::size_t i = 0; i < std::size(list); ++i)
+//   {
+//     for (int f = 0; f < 5; ++f)
+//     {
+//       for (int precision : {-1, 0, 5})
+//       {
+//         if (f == 0 && precision != -1)
+//         {
+//           continue;
+//         }
+//         char buff[1000];
+//         std::to_chars_result result{};
+//         if (f == 0)
+//         {
+//           result = std::to_chars(buff, buff + 1000, list[i]);
+//         }
+//         else if (precision < 0)
+//         {
+//           result = std::to_chars(buff, buff + 1000, list[i], fmts[f]);
+//         }
+//         else
+//         {
+//           result = std::to_chars(buff, buff + 1000, list[i], fmts[f], precision);
+//         }
+//         if (result.ptr - buff > 60)
+//         {
+//           continue;
+//         }
+//         const std::string fmt = (f == 0) ? "no_format" : std::string("cuda::std::chars_format::") + fmt_names[f];
+//         std::cout << "    TestItem{" << list_str[i] << ", " << fmt << ", " << precision << ", \""
+//                   << std::string(buff, result.ptr) << "\"},\n";
+//       }
+//     }
+//   }
+// }
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 203> get_test_items()
+{
+  return {{
+    TestItem{0.0, no_format, -1, "0"},
+    TestItem{0.0, cuda::std::chars_format::scientific, -1, "0e+00"},
+    TestItem{0.0, cuda::std::chars_format::scientific, 0, "0e+00"},
+    TestItem{0.0, cuda::std::chars_format::scientific, 5, "0.00000e+00"},
+    TestItem{0.0, cuda::std::chars_format::fixed, -1, "0"},
+    TestItem{0.0, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.0, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{0.0, cuda::std::chars_format::general, -1, "0"},
+    TestItem{0.0, cuda::std::chars_format::general, 0, "0"},
+    TestItem{0.0, cuda::std::chars_format::general, 5, "0"},
+    TestItem{0.0, cuda::std::chars_format::hex, -1, "0p+0"},
+    TestItem{0.0, cuda::std::chars_format::hex, 0, "0p+0"},
+    TestItem{0.0, cuda::std::chars_format::hex, 5, "0.00000p+0"},
+    TestItem{-0.0, no_format, -1, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, -1, "-0e+00"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, 0, "-0e+00"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, 5, "-0.00000e+00"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, -1, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, 0, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, 5, "-0.00000"},
+    TestItem{-0.0, cuda::std::chars_format::general, -1, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::general, 0, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::general, 5, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, -1, "-0p+0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, 0, "-0p+0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, 5, "-0.00000p+0"},
+    TestItem{1.0, no_format, -1, "1"},
+    TestItem{1.0, cuda::std::chars_format::scientific, -1, "1e+00"},
+    TestItem{1.0, cuda::std::chars_format::scientific, 0, "1e+00"},
+    TestItem{1.0, cuda::std::chars_format::scientific, 5, "1.00000e+00"},
+    TestItem{1.0, cuda::std::chars_format::fixed, -1, "1"},
+    TestItem{1.0, cuda::std::chars_format::fixed, 0, "1"},
+    TestItem{1.0, cuda::std::chars_format::fixed, 5, "1.00000"},
+    TestItem{1.0, cuda::std::chars_format::general, -1, "1"},
+    TestItem{1.0, cuda::std::chars_format::general, 0, "1"},
+    TestItem{1.0, cuda::std::chars_format::general, 5, "1"},
+    TestItem{1.0, cuda::std::chars_format::hex, -1, "1p+0"},
+    TestItem{1.0, cuda::std::chars_format::hex, 0, "1p+0"},
+    TestItem{1.0, cuda::std::chars_format::hex, 5, "1.00000p+0"},
+    TestItem{-1.5, no_format, -1, "-1.5"},
+    TestItem{-1.5, cuda::std::chars_format::scientific, -1, "-1.5e+00"},
+    TestItem{-1.5, cuda::std::chars_format::scientific, 0, "-2e+00"},
+    TestItem{-1.5, cuda::std::chars_format::scientific, 5, "-1.50000e+00"},
+    TestItem{-1.5, cuda::std::chars_format::fixed, -1, "-1.5"},
+    TestItem{-1.5, cuda::std::chars_format::fixed, 0, "-2"},
+    TestItem{-1.5, cuda::std::chars_format::fixed, 5, "-1.50000"},
+    TestItem{-1.5, cuda::std::chars_format::general, -1, "-1.5"},
+    TestItem{-1.5, cuda::std::chars_format::general, 0, "-2"},
+    TestItem{-1.5, cuda::std::chars_format::general, 5, "-1.5"},
+    TestItem{-1.5, cuda::std::chars_format::hex, -1, "-1.8p+0"},
+    TestItem{-1.5, cuda::std::chars_format::hex, 0, "-2p+0"},
+    TestItem{-1.5, cuda::std::chars_format::hex, 5, "-1.80000p+0"},
+    TestItem{0.1, no_format, -1, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::scientific, -1, "1e-01"},
+    TestItem{0.1, cuda::std::chars_format::scientific, 0, "1e-01"},
+    TestItem{0.1, cuda::std::chars_format::scientific, 5, "1.00000e-01"},
+    TestItem{0.1, cuda::std::chars_format::fixed, -1, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.1, cuda::std::chars_format::fixed, 5, "0.10000"},
+    TestItem{0.1, cuda::std::chars_format::general, -1, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::general, 0, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::general, 5, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::hex, -1, "1.999999999999ap-4"},
+    TestItem{0.1, cuda::std::chars_format::hex, 0, "2p-4"},
+    TestItem{0.1, cuda::std::chars_format::hex, 5, "1.9999ap-4"},
+    TestItem{0.3, no_format, -1, "0.3"},
+    TestItem{0.3, cuda::std::chars_format::scientific, -1, "3e-01"},
+    TestItem{0.3, cuda::std::chars_format::scientific, 0, "3e-01"},
+    TestItem{0.3, cuda::std::chars_format::scientific, 5, "3.00000e-01"},
+    TestItem{0.3, cuda::std::chars_format::fixed, -1, "0.3"},
+    TestItem{0.3, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.3, cuda::std::chars_format::fixed, 5, "0.30000"},
+    TestItem{0.3, cuda::std::chars_format::general, -1, "0.3"},
+    TestItem{0.3, cuda::std::chars_format::general, 0, "0.3"},
+    TestItem{0.3, cuda::std::chars_format::general, 5, "0.3"},
+    TestItem{0.3, cuda::std::chars_format::hex, -1, "1.3333333333333p-2"},
+    TestItem{0.3, cuda::std::chars_format::hex, 0, "1p-2"},
+    TestItem{0.3, cuda::std::chars_format::hex, 5, "1.33333p-2"},
+    TestItem{123.456, no_format, -1, "123.456"},
+    TestItem{123.456, cuda::std::chars_format::scientific, -1, "1.23456e+02"},
+    TestItem{123.456, cuda::std::chars_format::scientific, 0, "1e+02"},
+    TestItem{123.456, cuda::std::chars_format::scientific, 5, "1.23456e+02"},
+    TestItem{123.456, cuda::std::chars_format::fixed, -1, "123.456"},
+    TestItem{123.456, cuda::std::chars_format::fixed, 0, "123"},
+    TestItem{123.456, cuda::std::chars_format::fixed, 5, "123.45600"},
+    TestItem{123.456, cuda::std::chars_format::general, -1, "123.456"},
+    TestItem{123.456, cuda::std::chars_format::general, 0, "1e+02"},
+    TestItem{123.456, cuda::std::chars_format::general, 5, "123.46"},
+    TestItem{123.456, cuda::std::chars_format::hex, -1, "1.edd2f1a9fbe77p+6"},
+    TestItem{123.456, cuda::std::chars_format::hex, 0, "2p+6"},
+    TestItem{123.456, cuda::std::chars_format::hex, 5, "1.edd2fp+6"},
+    TestItem{1e22, no_format, -1, "1e+22"},
+    TestItem{1e22, cuda::std::chars_format::scientific, -1, "1e+22"},
+    TestItem{1e22, cuda::std::chars_format::scientific, 0, "1e+22"},
+    TestItem{1e22, cuda::std::chars_format::scientific, 5, "1.00000e+22"},
+    TestItem{1e22, cuda::std::chars_format::fixed, -1, "10000000000000000000000"},
+    TestItem{1e22, cuda::std::chars_format::fixed, 0, "10000000000000000000000"},
+    TestItem{1e22, cuda::std::chars_format::fixed, 5, "10000000000000000000000.00000"},
+    TestItem{1e22, cuda::std::chars_format::general, -1, "1e+22"},
+    TestItem{1e22, cuda::std::chars_format::general, 0, "1e+22"},
+    TestItem{1e22, cuda::std::chars_format::general, 5, "1e+22"},
+    TestItem{1e22, cuda::std::chars_format::hex, -1, "1.0f0cf064dd592p+73"},
+    TestItem{1e22, cuda::std::chars_format::hex, 0, "1p+73"},
+    TestItem{1e22, cuda::std::chars_format::hex, 5, "1.0f0cfp+73"},
+    TestItem{1e23, no_format, -1, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, -1, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, 0, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, 5, "1.00000e+23"},
+    TestItem{1e23, cuda::std::chars_format::fixed, -1, "99999999999999991611392"},
+    TestItem{1e23, cuda::std::chars_format::fixed, 0, "99999999999999991611392"},
+    TestItem{1e23, cuda::std::chars_format::fixed, 5, "99999999999999991611392.00000"},
+    TestItem{1e23, cuda::std::chars_format::general, -1, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::general, 0, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::general, 5, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::hex, -1, "1.52d02c7e14af6p+76"},
+    TestItem{1e23, cuda::std::chars_format::hex, 0, "1p+76"},
+    TestItem{1e23, cuda::std::chars_format::hex, 5, "1.52d03p+76"},
+    TestItem{-9007199254740993.0, no_format, -1, "-9007199254740992"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::scientific, -1, "-9.007199254740992e+15"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::scientific, 0, "-9e+15"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::scientific, 5, "-9.00720e+15"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::fixed, -1, "-9007199254740992"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::fixed, 0, "-9007199254740992"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::fixed, 5, "-9007199254740992.00000"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::general, -1, "-9.007199254740992e+15"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::general, 0, "-9e+15"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::general, 5, "-9.0072e+15"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::hex, -1, "-1p+53"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::hex, 0, "-1p+53"},
+    TestItem{-9007199254740993.0, cuda::std::chars_format::hex, 5, "-1.00000p+53"},
+    TestItem{1.234e-7, no_format, -1, "1.234e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::scientific, -1, "1.234e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::scientific, 0, "1e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::scientific, 5, "1.23400e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::fixed, -1, "0.0000001234"},
+    TestItem{1.234e-7, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1.234e-7, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{1.234e-7, cuda::std::chars_format::general, -1, "1.234e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::general, 0, "1e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::general, 5, "1.234e-07"},
+    TestItem{1.234e-7, cuda::std::chars_format::hex, -1, "1.08ffde1023e12p-23"},
+    TestItem{1.234e-7, cuda::std::chars_format::hex, 0, "1p-23"},
+    TestItem{1.234e-7, cuda::std::chars_format::hex, 5, "1.08ffep-23"},
+    TestItem{5e-324, no_format, -1, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, -1, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, 0, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, 5, "4.94066e-324"},
+    TestItem{5e-324, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{5e-324, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{5e-324, cuda::std::chars_format::general, -1, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, 0, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, 5, "4.9407e-324"},
+    TestItem{5e-324, cuda::std::chars_format::hex, -1, "0.0000000000001p-1022"},
+    TestItem{5e-324, cuda::std::chars_format::hex, 0, "0p-1022"},
+    TestItem{5e-324, cuda::std::chars_format::hex, 5, "0.00000p-1022"},
+    TestItem{2.2250738585072014e-308, no_format, -1, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, -1, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, 0, "2e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, 5, "2.22507e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, -1, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, 0, "2e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, 5, "2.2251e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, -1, "1p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, 0, "1p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, 5, "1.00000p-1022"},
+    TestItem{1.7976931348623157e308, no_format, -1, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, -1, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, 0, "2e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, 5, "1.79769e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, -1, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, 0, "2e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, 5, "1.7977e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, -1, "1.fffffffffffffp+1023"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, 0, "2p+1023"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, 5, "2.00000p+1023"},
+    TestItem{999999.5, no_format, -1, "999999.5"},
+    TestItem{999999.5, cuda::std::chars_format::scientific, -1, "9.999995e+05"},
+    TestItem{999999.5, cuda::std::chars_format::scientific, 0, "1e+06"},
+    TestItem{999999.5, cuda::std::chars_format::scientific, 5, "1.00000e+06"},
+    TestItem{999999.5, cuda::std::chars_format::fixed, -1, "999999.5"},
+    TestItem{999999.5, cuda::std::chars_format::fixed, 0, "1000000"},
+    TestItem{999999.5, cuda::std::chars_format::fixed, 5, "999999.50000"},
+    TestItem{999999.5, cuda::std::chars_format::general, -1, "999999.5"},
+    TestItem{999999.5, cuda::std::chars_format::general, 0, "1e+06"},
+    TestItem{999999.5, cuda::std::chars_format::general, 5, "1e+06"},
+    TestItem{999999.5, cuda::std::chars_format::hex, -1, "1.e847fp+19"},
+    TestItem{999999.5, cuda::std::chars_format::hex, 0, "2p+19"},
+    TestItem{999999.5, cuda::std::chars_format::hex, 5, "1.e847fp+19"},
+    TestItem{0.000125, no_format, -1, "0.000125"},
+    TestItem{0.000125, cuda::std::chars_format::scientific, -1, "1.25e-04"},
+    TestItem{0.000125, cuda::std::chars_format::scientific, 0, "1e-04"},
+    TestItem{0.000125, cuda::std::chars_format::scientific, 5, "1.25000e-04"},
+    TestItem{0.000125, cuda::std::chars_format::fixed, -1, "0.000125"},
+    TestItem{0.000125, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.000125, cuda::std::chars_format::fixed, 5, "0.00013"},
+    TestItem{0.000125, cuda::std::chars_format::general, -1, "0.000125"},
+    TestItem{0.000125, cuda::std::chars_format::general, 0, "0.0001"},
+    TestItem{0.000125, cuda::std::chars_format::general, 5, "0.000125"},
+    TestItem{0.000125, cuda::std::chars_format::hex, -1, "1.0624dd2f1a9fcp-13"},
+    TestItem{0.000125, cuda::std::chars_format::hex, 0, "1p-13"},
+    TestItem{0.000125, cuda::std::chars_format::hex, 5, "1.0624ep-13"},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::to_chars_result call_to_chars(char* first, char* last, const TestItem& item)
+{
+  if (item.fmt == no_format)
+  {
+    return cuda::std::to_chars(first, last, item.val);
+  }
+  if (item.precision < 0)
+  {
+    return cuda::std::to_chars(first, last, item.val, item.fmt);
+  }
+  return cuda::std::to_chars(first, last, item.val, item.fmt, item.precision);
+}
+
+TEST_FUNC constexpr void test_to_chars(const TestItem& item)
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(item.str);
+
+  // Check valid buffer size
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, item.str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+TEST_FUNC constexpr void test_special_values()
+{
+  const TestItem items[] = {
+    TestItem{cuda::std::numeric_limits<double>::infinity(), no_format, -1, "inf"},
+    TestItem{-cuda::std::numeric_limits<double>::infinity(), cuda::std::chars_format::scientific, -1, "-inf"},
+    TestItem{cuda::std::numeric_limits<double>::infinity(), cuda::std::chars_format::fixed, 5, "inf"},
+    TestItem{cuda::std::numeric_limits<double>::quiet_NaN(), cuda::std::chars_format::general, -1, "nan"},
+    TestItem{-cuda::std::numeric_limits<double>::quiet_NaN(), cuda::std::chars_format::hex, 5, "-nan"},
+  };
+  for (const auto& item : items)
+  {
+    test_to_chars(item);
+  }
+}
+
+TEST_FUNC constexpr void test_large_precision()
+{
+  // The digits past the exact decimal expansion are zeros
+  constexpr int precision = 500;
+  char buff[precision + 10]{};
+
+  const auto result =
+    cuda::std::to_chars(buff, buff + precision + 10, double{0.5}, cuda::std::chars_format::fixed, precision);
+  assert(result.ec == cuda::std::errc{});
+  assert(result.ptr == buff + precision + 2);
+  assert(buff[0] == '0' && buff[1] == '.' && buff[2] == '5');
+  for (int i = 3; i < precision + 2; ++i)
+  {
+    assert(buff[i] == '0');
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<
+                cuda::std::to_chars_result,
+                decltype(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format{}, int{})));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_to_chars(item);
+  }
+
+  test_special_values();
+  test_large_precision();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,400 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// CONSTEXPR_STEPS: 15000000
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+// The overload without a format
+constexpr cuda::std::chars_format no_format{};
+
+struct TestItem
+{
+  float val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <iostream>
+// #include <string>
+//
+// constexpr float list[] = {
+//   0.0f, -0.0f, 1.0f, -1.5f, 0.1f, 0.3f, 123.456f, 1e10f, -16777217.0f, 1.234e-7f, 1e-45f, 1.17549435e-38f,
+//   3.40282347e38f, 999999.5f, 0.000125f};
+// constexpr const char* list_str[] = {...}; // the values above as strings
+//
+// int main()
+// {
+//   const std::chars_format fmts[] = {
+//     std::chars_format{},
+//     std::chars_format::scientific,
+//     std::chars_format::fixed,
+//     std::chars_format::general,
+//     std::chars_format::hex};
+//   const char* fmt_names[] = {"", "scientific", "fixed", "general", "hex"};
+//
+//   for (std::size_t i = 0; i < std::size(list); ++i)
+//   {
+//     for (int f = 0; f < 5; ++f)
+//     {
+//       for (int precision : {-1, 0, 5})
+//       {
+//         if (f == 0 && precision != -1)
+//         {
+//           continue;
+//         }
+//         char buff[1000];
+//         std::to_chars_result result{};
+//         if (f == 0)
+//         {
+//           result = std::to_chars(buff, buff + 1000, list[i]);
+//         }
+//         else if (precision < 0)
+//         {
+//           result = std::to_chars(buff, buff + 1000, list[i], fmts[f]);
+//         }
+//         else
+//         {
+//           result = std::to_chars(buff, buff + 1000, list[i], fmts[f], precision);
+//         }
+//         if (result.ptr - buff > 60)
+//         {
+//           continue;
+//         }
+//         const std::string fmt = (f == 0) ? "no_format" : std::string("cuda::std::chars_format::") + fmt_names[f];
+//         std::cout << "    TestItem{" << list_str[i] << ", " << fmt << ", " << precision << ", \""
+//                   << std::string(buff, result.ptr) << "\"},\n";
+//       }
+//     }
+//   }
+// }
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 195> get_test_items()
+{
+  return {{
+    TestItem{0.0f, no_format, -1, "0"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, -1, "0e+00"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, 0, "0e+00"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, 5, "0.00000e+00"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, -1, "0"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{0.0f, cuda::std::chars_format::general, -1, "0"},
+    TestItem{0.0f, cuda::std::chars_format::general, 0, "0"},
+    TestItem{0.0f, cuda::std::chars_format::general, 5, "0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, -1, "0p+0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, 0, "0p+0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, 5, "0.00000p+0"},
+    TestItem{-0.0f, no_format, -1, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, -1, "-0e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, 0, "-0e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, 5, "-0.00000e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, -1, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, 0, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, 5, "-0.00000"},
+    TestItem{-0.0f, cuda::std::chars_format::general, -1, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::general, 0, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::general, 5, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, -1, "-0p+0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, 0, "-0p+0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, 5, "-0.00000p+0"},
+    TestItem{1.0f, no_format, -1, "1"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, -1, "1e+00"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, 0, "1e+00"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, 5, "1.00000e+00"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, -1, "1"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, 0, "1"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, 5, "1.00000"},
+    TestItem{1.0f, cuda::std::chars_format::general, -1, "1"},
+    TestItem{1.0f, cuda::std::chars_format::general, 0, "1"},
+    TestItem{1.0f, cuda::std::chars_format::general, 5, "1"},
+    TestItem{1.0f, cuda::std::chars_format::hex, -1, "1p+0"},
+    TestItem{1.0f, cuda::std::chars_format::hex, 0, "1p+0"},
+    TestItem{1.0f, cuda::std::chars_format::hex, 5, "1.00000p+0"},
+    TestItem{-1.5f, no_format, -1, "-1.5"},
+    TestItem{-1.5f, cuda::std::chars_format::scientific, -1, "-1.5e+00"},
+    TestItem{-1.5f, cuda::std::chars_format::scientific, 0, "-2e+00"},
+    TestItem{-1.5f, cuda::std::chars_format::scientific, 5, "-1.50000e+00"},
+    TestItem{-1.5f, cuda::std::chars_format::fixed, -1, "-1.5"},
+    TestItem{-1.5f, cuda::std::chars_format::fixed, 0, "-2"},
+    TestItem{-1.5f, cuda::std::chars_format::fixed, 5, "-1.50000"},
+    TestItem{-1.5f, cuda::std::chars_format::general, -1, "-1.5"},
+    TestItem{-1.5f, cuda::std::chars_format::general, 0, "-2"},
+    TestItem{-1.5f, cuda::std::chars_format::general, 5, "-1.5"},
+    TestItem{-1.5f, cuda::std::chars_format::hex, -1, "-1.8p+0"},
+    TestItem{-1.5f, cuda::std::chars_format::hex, 0, "-2p+0"},
+    TestItem{-1.5f, cuda::std::chars_format::hex, 5, "-1.80000p+0"},
+    TestItem{0.1f, no_format, -1, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, -1, "1e-01"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, 0, "1e-01"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, 5, "1.00000e-01"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, -1, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, 5, "0.10000"},
+    TestItem{0.1f, cuda::std::chars_format::general, -1, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::general, 0, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::general, 5, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::hex, -1, "1.99999ap-4"},
+    TestItem{0.1f, cuda::std::chars_format::hex, 0, "2p-4"},
+    TestItem{0.1f, cuda::std::chars_format::hex, 5, "1.9999ap-4"},
+    TestItem{0.3f, no_format, -1, "0.3"},
+    TestItem{0.3f, cuda::std::chars_format::scientific, -1, "3e-01"},
+    TestItem{0.3f, cuda::std::chars_format::scientific, 0, "3e-01"},
+    TestItem{0.3f, cuda::std::chars_format::scientific, 5, "3.00000e-01"},
+    TestItem{0.3f, cuda::std::chars_format::fixed, -1, "0.3"},
+    TestItem{0.3f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.3f, cuda::std::chars_format::fixed, 5, "0.30000"},
+    TestItem{0.3f, cuda::std::chars_format::general, -1, "0.3"},
+    TestItem{0.3f, cuda::std::chars_format::general, 0, "0.3"},
+    TestItem{0.3f, cuda::std::chars_format::general, 5, "0.3"},
+    TestItem{0.3f, cuda::std::chars_format::hex, -1, "1.333334p-2"},
+    TestItem{0.3f, cuda::std::chars_format::hex, 0, "1p-2"},
+    TestItem{0.3f, cuda::std::chars_format::hex, 5, "1.33333p-2"},
+    TestItem{123.456f, no_format, -1, "123.456"},
+    TestItem{123.456f, cuda::std::chars_format::scientific, -1, "1.23456e+02"},
+    TestItem{123.456f, cuda::std::chars_format::scientific, 0, "1e+02"},
+    TestItem{123.456f, cuda::std::chars_format::scientific, 5, "1.23456e+02"},
+    TestItem{123.456f, cuda::std::chars_format::fixed, -1, "123.456"},
+    TestItem{123.456f, cuda::std::chars_format::fixed, 0, "123"},
+    TestItem{123.456f, cuda::std::chars_format::fixed, 5, "123.45600"},
+    TestItem{123.456f, cuda::std::chars_format::general, -1, "123.456"},
+    TestItem{123.456f, cuda::std::chars_format::general, 0, "1e+02"},
+    TestItem{123.456f, cuda::std::chars_format::general, 5, "123.46"},
+    TestItem{123.456f, cuda::std::chars_format::hex, -1, "1.edd2f2p+6"},
+    TestItem{123.456f, cuda::std::chars_format::hex, 0, "2p+6"},
+    TestItem{123.456f, cuda::std::chars_format::hex, 5, "1.edd2fp+6"},
+    TestItem{1e10f, no_format, -1, "1e+10"},
+    TestItem{1e10f, cuda::std::chars_format::scientific, -1, "1e+10"},
+    TestItem{1e10f, cuda::std::chars_format::scientific, 0, "1e+10"},
+    TestItem{1e10f, cuda::std::chars_format::scientific, 5, "1.00000e+10"},
+    TestItem{1e10f, cuda::std::chars_format::fixed, -1, "10000000000"},
+    TestItem{1e10f, cuda::std::chars_format::fixed, 0, "10000000000"},
+    TestItem{1e10f, cuda::std::chars_format::fixed, 5, "10000000000.00000"},
+    TestItem{1e10f, cuda::std::chars_format::general, -1, "1e+10"},
+    TestItem{1e10f, cuda::std::chars_format::general, 0, "1e+10"},
+    TestItem{1e10f, cuda::std::chars_format::general, 5, "1e+10"},
+    TestItem{1e10f, cuda::std::chars_format::hex, -1, "1.2a05f2p+33"},
+    TestItem{1e10f, cuda::std::chars_format::hex, 0, "1p+33"},
+    TestItem{1e10f, cuda::std::chars_format::hex, 5, "1.2a05fp+33"},
+    TestItem{-16777217.0f, no_format, -1, "-16777216"},
+    TestItem{-16777217.0f, cuda::std::chars_format::scientific, -1, "-1.6777216e+07"},
+    TestItem{-16777217.0f, cuda::std::chars_format::scientific, 0, "-2e+07"},
+    TestItem{-16777217.0f, cuda::std::chars_format::scientific, 5, "-1.67772e+07"},
+    TestItem{-16777217.0f, cuda::std::chars_format::fixed, -1, "-16777216"},
+    TestItem{-16777217.0f, cuda::std::chars_format::fixed, 0, "-16777216"},
+    TestItem{-16777217.0f, cuda::std::chars_format::fixed, 5, "-16777216.00000"},
+    TestItem{-16777217.0f, cuda::std::chars_format::general, -1, "-1.6777216e+07"},
+    TestItem{-16777217.0f, cuda::std::chars_format::general, 0, "-2e+07"},
+    TestItem{-16777217.0f, cuda::std::chars_format::general, 5, "-1.6777e+07"},
+    TestItem{-16777217.0f, cuda::std::chars_format::hex, -1, "-1p+24"},
+    TestItem{-16777217.0f, cuda::std::chars_format::hex, 0, "-1p+24"},
+    TestItem{-16777217.0f, cuda::std::chars_format::hex, 5, "-1.00000p+24"},
+    TestItem{1.234e-7f, no_format, -1, "1.234e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::scientific, -1, "1.234e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::scientific, 0, "1e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::scientific, 5, "1.23400e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::fixed, -1, "0.0000001234"},
+    TestItem{1.234e-7f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1.234e-7f, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{1.234e-7f, cuda::std::chars_format::general, -1, "1.234e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::general, 0, "1e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::general, 5, "1.234e-07"},
+    TestItem{1.234e-7f, cuda::std::chars_format::hex, -1, "1.08ffdep-23"},
+    TestItem{1.234e-7f, cuda::std::chars_format::hex, 0, "1p-23"},
+    TestItem{1.234e-7f, cuda::std::chars_format::hex, 5, "1.08ffep-23"},
+    TestItem{1e-45f, no_format, -1, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, -1, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, 0, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, 5, "1.40130e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, -1, "0.000000000000000000000000000000000000000000001"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{1e-45f, cuda::std::chars_format::general, -1, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, 0, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, 5, "1.4013e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, -1, "0.000002p-126"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, 0, "0p-126"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, 5, "0.00000p-126"},
+    TestItem{1.17549435e-38f, no_format, -1, "1.1754944e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, -1, "1.1754944e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, 0, "1e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, 5, "1.17549e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, -1, "0.000000000000000000000000000000000000011754944"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, 5, "0.00000"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, -1, "1.1754944e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, 0, "1e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, 5, "1.1755e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, -1, "1p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, 0, "1p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, 5, "1.00000p-126"},
+    TestItem{3.40282347e38f, no_format, -1, "3.4028235e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, -1, "3.4028235e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, 0, "3e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, 5, "3.40282e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, -1, "340282346638528859811704183484516925440"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, 0, "340282346638528859811704183484516925440"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, 5, "340282346638528859811704183484516925440.00000"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, -1, "3.4028235e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, 0, "3e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, 5, "3.4028e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, -1, "1.fffffep+127"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, 0, "2p+127"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, 5, "2.00000p+127"},
+    TestItem{999999.5f, no_format, -1, "999999.5"},
+    TestItem{999999.5f, cuda::std::chars_format::scientific, -1, "9.999995e+05"},
+    TestItem{999999.5f, cuda::std::chars_format::scientific, 0, "1e+06"},
+    TestItem{999999.5f, cuda::std::chars_format::scientific, 5, "1.00000e+06"},
+    TestItem{999999.5f, cuda::std::chars_format::fixed, -1, "999999.5"},
+    TestItem{999999.5f, cuda::std::chars_format::fixed, 0, "1000000"},
+    TestItem{999999.5f, cuda::std::chars_format::fixed, 5, "999999.50000"},
+    TestItem{999999.5f, cuda::std::chars_format::general, -1, "999999.5"},
+    TestItem{999999.5f, cuda::std::chars_format::general, 0, "1e+06"},
+    TestItem{999999.5f, cuda::std::chars_format::general, 5, "1e+06"},
+    TestItem{999999.5f, cuda::std::chars_format::hex, -1, "1.e847fp+19"},
+    TestItem{999999.5f, cuda::std::chars_format::hex, 0, "2p+19"},
+    TestItem{999999.5f, cuda::std::chars_format::hex, 5, "1.e847fp+19"},
+    TestItem{0.000125f, no_format, -1, "0.000125"},
+    TestItem{0.000125f, cuda::std::chars_format::scientific, -1, "1.25e-04"},
+    TestItem{0.000125f, cuda::std::chars_format::scientific, 0, "1e-04"},
+    TestItem{0.000125f, cuda::std::chars_format::scientific, 5, "1.25000e-04"},
+    TestItem{0.000125f, cuda::std::chars_format::fixed, -1, "0.000125"},
+    TestItem{0.000125f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.000125f, cuda::std::chars_format::fixed, 5, "0.00013"},
+    TestItem{0.000125f, cuda::std::chars_format::general, -1, "0.000125"},
+    TestItem{0.000125f, cuda::std::chars_format::general, 0, "0.0001"},
+    TestItem{0.000125f, cuda::std::chars_format::general, 5, "0.000125"},
+    TestItem{0.000125f, cuda::std::chars_format::hex, -1, "1.0624dep-13"},
+    TestItem{0.000125f, cuda::std::chars_format::hex, 0, "1p-13"},
+    TestItem{0.000125f, cuda::std::chars_format::hex, 5, "1.0624ep-13"},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::to_chars_result call_to_chars(char* first, char* last, const TestItem& item)
+{
+  if (item.fmt == no_format)
+  {
+    return cuda::std::to_chars(first, last, item.val);
+  }
+  if (item.precision < 0)
+  {
+    return cuda::std::to_chars(first, last, item.val, item.fmt);
+  }
+  return cuda::std::to_chars(first, last, item.val, item.fmt, item.precision);
+}
+
+TEST_FUNC constexpr void test_to_chars(const TestItem& item)
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(item.str);
+
+  // Check valid buffer size
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, item.str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+TEST_FUNC constexpr void test_special_values()
+{
+  const TestItem items[] = {
+    TestItem{cuda::std::numeric_limits<float>::infinity(), no_format, -1, "inf"},
+    TestItem{-cuda::std::numeric_limits<float>::infinity(), cuda::std::chars_format::scientific, -1, "-inf"},
+    TestItem{cuda::std::numeric_limits<float>::infinity(), cuda::std::chars_format::fixed, 5, "inf"},
+    TestItem{cuda::std::numeric_limits<float>::quiet_NaN(), cuda::std::chars_format::general, -1, "nan"},
+    TestItem{-cuda::std::numeric_limits<float>::quiet_NaN(), cuda::std::chars_format::hex, 5, "-nan"},
+  };
+  for (const auto& item : items)
+  {
+    test_to_chars(item);
+  }
+}
+
+TEST_FUNC constexpr void test_large_precision()
+{
+  // The digits past the exact decimal expansion are zeros
+  constexpr int precision = 500;
+  char buff[precision + 10]{};
+
+  const auto result =
+    cuda::std::to_chars(buff, buff + precision + 10, float{0.5}, cuda::std::chars_format::fixed, precision);
+  assert(result.ec == cuda::std::errc{});
+  assert(result.ptr == buff + precision + 2);
+  assert(buff[0] == '0' && buff[1] == '.' && buff[2] == '5');
+  for (int i = 3; i < precision + 2; ++i)
+  {
+    assert(buff[i] == '0');
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<
+                cuda::std::to_chars_result,
+                decltype(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format{}, int{})));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_to_chars(item);
+  }
+
+  test_special_values();
+  test_large_precision();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -13,6 +13,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <cuda/utility>
 
@@ -1228,6 +1229,64 @@ TEST_FUNC constexpr void test_to_chars(const TestItem& item)
   }
 }
 
+// Test the base 10 values around the chunks of 18 digits, which are converted with 64-bit divisions
+template <class T>
+TEST_FUNC constexpr void test_chunks()
+{
+  constexpr __int128_t pow10_18 = 1'000'000'000'000'000'000;
+  constexpr __int128_t pow2_64  = __int128_t{1} << 64;
+
+  constexpr TestItem items[] = {
+    {pow10_18 - 1, "999999999999999999", "999999999999999999"},
+    {pow10_18, "1000000000000000000", "1000000000000000000"},
+    {pow10_18 + 1, "1000000000000000001", "1000000000000000001"},
+    {pow2_64 - 1, "18446744073709551615", "18446744073709551615"},
+    {pow2_64, "18446744073709551616", "18446744073709551616"},
+    {pow10_18 * pow10_18 - 1, "999999999999999999999999999999999999", "999999999999999999999999999999999999"},
+    {pow10_18 * pow10_18, "1000000000000000000000000000000000000", "1000000000000000000000000000000000000"},
+    {pow10_18 * pow10_18 + 1, "1000000000000000000000000000000000001", "1000000000000000000000000000000000001"},
+    {pow10_18 * (pow10_18 + 1), "1000000000000000001000000000000000000", "1000000000000000001000000000000000000"},
+    {170 * pow10_18 * pow10_18 - 1,
+     "169999999999999999999999999999999999999",
+     "169999999999999999999999999999999999999"},
+    {-(pow10_18 - 1), "-999999999999999999", "340282366920938463462374607431768211457"},
+    {-pow10_18, "-1000000000000000000", "340282366920938463462374607431768211456"},
+    {-(pow10_18 + 1), "-1000000000000000001", "340282366920938463462374607431768211455"},
+    {-(pow2_64 - 1), "-18446744073709551615", "340282366920938463444927863358058659841"},
+    {-pow2_64, "-18446744073709551616", "340282366920938463444927863358058659840"},
+    {-(pow10_18 * pow10_18 - 1), "-999999999999999999999999999999999999", "339282366920938463463374607431768211457"},
+    {-(pow10_18 * pow10_18), "-1000000000000000000000000000000000000", "339282366920938463463374607431768211456"},
+    {-(pow10_18 * pow10_18 + 1), "-1000000000000000000000000000000000001", "339282366920938463463374607431768211455"},
+    {-(pow10_18 * (pow10_18 + 1)), "-1000000000000000001000000000000000000", "339282366920938463462374607431768211456"},
+    {-(170 * pow10_18 * pow10_18 - 1),
+     "-169999999999999999999999999999999999999",
+     "170282366920938463463374607431768211457"},
+  };
+
+  for (const auto& item : items)
+  {
+    test_to_chars<T, 10>(item);
+  }
+}
+
+template <class T>
+TEST_FUNC constexpr void test_limits()
+{
+  TestItem item{};
+
+  // 1. Test `max`
+  item.val          = static_cast<__int128_t>(cuda::std::numeric_limits<T>::max());
+  item.str_signed   = "170141183460469231731687303715884105727";
+  item.str_unsigned = "340282366920938463463374607431768211455";
+  test_to_chars<T, 10>(item);
+
+  // 2. Test `min`
+  item.val          = static_cast<__int128_t>(cuda::std::numeric_limits<T>::min());
+  item.str_signed   = "-170141183460469231731687303715884105728";
+  item.str_unsigned = "0";
+  test_to_chars<T, 10>(item);
+}
+
 template <int Base>
 TEST_FUNC constexpr bool test_base()
 {
@@ -1239,6 +1298,15 @@ TEST_FUNC constexpr bool test_base()
     test_to_chars<__uint128_t, Base>(item);
   }
 
+  // Test the chunks and the limits (base 10 only)
+  if constexpr (Base == 10)
+  {
+    test_chunks<__int128_t>();
+    test_chunks<__uint128_t>();
+    test_limits<__int128_t>();
+    test_limits<__uint128_t>();
+  }
+
   return true;
 }
 
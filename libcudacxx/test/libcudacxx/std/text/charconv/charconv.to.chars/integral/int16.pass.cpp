@@ -13,6 +13,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <cuda/utility>
 
@@ -1192,6 +1193,24 @@ TEST_FUNC constexpr void test_to_chars(const TestItem& item)
   }
 }
 
+template <class T>
+TEST_FUNC constexpr void test_limits()
+{
+  TestItem item{};
+
+  // 1. Test `max`
+  item.val          = static_cast<cuda::std::int16_t>(cuda::std::numeric_limits<T>::max());
+  item.str_signed   = "32767";
+  item.str_unsigned = "65535";
+  test_to_chars<T, 10>(item);
+
+  // 2. Test `min`
+  item.val          = static_cast<cuda::std::int16_t>(cuda::std::numeric_limits<T>::min());
+  item.str_signed   = "-32768";
+  item.str_unsigned = "0";
+  test_to_chars<T, 10>(item);
+}
+
 template <int Base>
 TEST_FUNC constexpr bool test_base()
 {
@@ -1203,6 +1222,13 @@ TEST_FUNC constexpr bool test_base()
     test_to_chars<cuda::std::uint16_t, Base>(item);
   }
 
+  // Test the limits (base 10 only)
+  if constexpr (Base == 10)
+  {
+    test_limits<cuda::std::int16_t>();
+    test_limits<cuda::std::uint16_t>();
+  }
+
   return true;
 }
 
@@ -13,6 +13,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <cuda/utility>
 
@@ -1126,6 +1127,24 @@ TEST_FUNC constexpr void test_to_chars(const TestItem& item)
   }
 }
 
+template <class T>
+TEST_FUNC constexpr void test_limits()
+{
+  TestItem item{};
+
+  // 1. Test `max`
+  item.val          = static_cast<cuda::std::int32_t>(cuda::std::numeric_limits<T>::max());
+  item.str_signed   = "2147483647";
+  item.str_unsigned = "4294967295";
+  test_to_chars<T, 10>(item);
+
+  // 2. Test `min`
+  item.val          = static_cast<cuda::std::int32_t>(cuda::std::numeric_limits<T>::min());
+  item.str_signed   = "-2147483648";
+  item.str_unsigned = "0";
+  test_to_chars<T, 10>(item);
+}
+
 template <int Base>
 TEST_FUNC constexpr bool test_base()
 {
@@ -1137,6 +1156,13 @@ TEST_FUNC constexpr bool test_base()
     test_to_chars<cuda::std::uint32_t, Base>(item);
   }
 
+  // Test the limits (base 10 only)
+  if constexpr (Base == 10)
+  {
+    test_limits<cuda::std::int32_t>();
+    test_limits<cuda::std::uint32_t>();
+  }
+
   return true;
 }
 
@@ -13,6 +13,7 @@
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 #include <cuda/std/cstring>
+#include <cuda/std/limits>
 #include <cuda/std/type_traits>
 #include <cuda/utility>
 
@@ -685,6 +686,24 @@ TEST_FUNC constexpr void test_to_chars(const TestItem& item)
   }
 }
 
+template <class T>
+TEST_FUNC constexpr void test_limits()
+{
+  TestItem item{};
+
+  // 1. Test `max`
+  item.val          = static_cast<cuda::std::int8_t>(cuda::std::numeric_limits<T>::max());
+  item.str_signed   = "127";
+  item.str_unsigned = "255";
+  test_to_chars<T, 10>(item);
+
+  // 2. Test `min`
+  item.val          = static_cast<cuda::std::int8_t>(cuda::std::numeric_limits<T>::min());
+  item.str_signed   = "-128";
+  item.str_unsigned = "0";
+  test_to_chars<T, 10>(item);
+}
+
 template <int Base>
 TEST_FUNC constexpr bool test_base()
 {
@@ -697,6 +716,14 @@ TEST_FUNC constexpr bool test_base()
     test_to_chars<cuda::std::uint8_t, Base>(item);
   }
 
+  // Test the limits (base 10 only)
+  if constexpr (Base == 10)
+  {
+    test_limits<char>();
+    test_limits<cuda::std::int8_t>();
+    test_limits<cuda::std::uint8_t>();
+  }
+
   return true;
 }
 
@@ -0,0 +1,171 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: enable-tile
+// error: bit field read/write is unsupported in tile code
+
+// <cuda/std/format>
+
+// [format.formatter.spec]:
+// Each header that declares the template `formatter` provides the following
+// enabled specializations:
+// For each `charT`, for each cv-unqualified arithmetic type `ArithmeticT`
+// other than char, wchar_t, char8_t, char16_t, or char32_t, a specialization
+//    template<> struct formatter<ArithmeticT, charT>
+//
+// This file tests with `ArithmeticT = floating-point`, for each valid `charT`.
+// Where `floating-point` is one of:
+// - float
+// - double
+// - long double
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/limits>
+#include <cuda/std/memory>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "literal.h"
+
+template <class CharT, class T>
+TEST_FUNC void test_floating_point_formatter(
+  cuda::std::basic_string_view<CharT> fmt,
+  T value,
+  cuda::std::size_t offset,
+  cuda::std::basic_string_view<CharT> expected)
+{
+  using Container     = cuda::std::inplace_vector<CharT, 200>;
+  using OutIt         = cuda::std::__back_insert_iterator<Container>;
+  using ParseContext  = cuda::std::basic_format_parse_context<CharT>;
+  using FormatContext = cuda::std::basic_format_context<OutIt, CharT>;
+
+  Container container{};
+
+  auto store   = cuda::std::make_format_args<FormatContext>(value);
+  auto args    = cuda::std::basic_format_args{store};
+  auto context = cuda::std::__fmt_make_format_context(OutIt{container}, args);
+
+  cuda::std::formatter<T, CharT> formatter{};
+  static_assert(cuda::std::semiregular<decltype(formatter)>);
+
+  ParseContext parse_ctx{fmt};
+  auto it = formatter.parse(parse_ctx);
+  static_assert(cuda::std::is_same_v<decltype(it), typename cuda::std::basic_string_view<CharT>::const_iterator>);
+
+  // std::to_address works around LWG3989 and MSVC STL's iterator debugging mechanism.
+  assert(cuda::std::to_address(it) == cuda::std::to_address(fmt.end()) - offset);
+
+  formatter.format(value, context);
+  assert((cuda::std::basic_string_view{container.data(), container.size()} == expected));
+}
+
+template <class CharT, class T>
+TEST_FUNC void test_termination_condition(
+  cuda::std::basic_string_view<CharT> fmt, T value, cuda::std::basic_string_view<CharT> expected)
+{
+  // The format-spec is valid if completely consumed or terminates at a '}'.
+  // The valid inputs all end with a '}'. The test is executed twice:
+  // - first with the terminating '}',
+  // - second consuming the entire input.
+  assert(fmt.back() == TEST_CHARLIT(CharT, '}'));
+
+  test_floating_point_formatter(fmt, value, 1, expected);
+  fmt.remove_suffix(1);
+  test_floating_point_formatter(fmt, value, 0, expected);
+}
+
+template <class CharT, class T>
+TEST_FUNC void test_type()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(1.5), TEST_STRLIT(CharT, "1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(-2.25), TEST_STRLIT(CharT, "-2.25"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(0.0), TEST_STRLIT(CharT, "0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(-0.0), TEST_STRLIT(CharT, "-0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(1024.0), TEST_STRLIT(CharT, "1024"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(0.125), TEST_STRLIT(CharT, "0.125"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "+}"), T(1.5), TEST_STRLIT(CharT, "+1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, " }"), T(1.5), TEST_STRLIT(CharT, " 1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "-}"), T(-1.5), TEST_STRLIT(CharT, "-1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "e}"), T(1.5), TEST_STRLIT(CharT, "1.500000e+00"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "E}"), T(1.5), TEST_STRLIT(CharT, "1.500000E+00"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".2e}"), T(1024.0), TEST_STRLIT(CharT, "1.02e+03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "f}"), T(1.5), TEST_STRLIT(CharT, "1.500000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "F}"), T(-1.5), TEST_STRLIT(CharT, "-1.500000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0f}"), T(2.5), TEST_STRLIT(CharT, "2"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".1f}"), T(0.125), TEST_STRLIT(CharT, "0.1"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "g}"), T(1024.0), TEST_STRLIT(CharT, "1024"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "g}"), T(0.00000095367431640625), TEST_STRLIT(CharT, "9.53674e-07"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "G}"), T(0.00000095367431640625), TEST_STRLIT(CharT, "9.53674E-07"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "a}"), T(1.5), TEST_STRLIT(CharT, "1.8p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "A}"), T(-255.0), TEST_STRLIT(CharT, "-1.FEP+7"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3a}"), T(1.5), TEST_STRLIT(CharT, "1.800p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3}"), T(1024.0), TEST_STRLIT(CharT, "1.02e+03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0}"), T(1.5), TEST_STRLIT(CharT, "2"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#}"), T(1024.0), TEST_STRLIT(CharT, "1024."));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#g}"), T(1.5), TEST_STRLIT(CharT, "1.50000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3g}"), T(0.0), TEST_STRLIT(CharT, "0.00"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.0f}"), T(1.5), TEST_STRLIT(CharT, "2."));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.0e}"), T(1.5), TEST_STRLIT(CharT, "2.e+00"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#a}"), T(1.0), TEST_STRLIT(CharT, "1.p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "10}"), T(1.5), TEST_STRLIT(CharT, "       1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "<10}"), T(1.5), TEST_STRLIT(CharT, "1.5       "));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "^10}"), T(1.5), TEST_STRLIT(CharT, "   1.5    "));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "*^10}"), T(1.5), TEST_STRLIT(CharT, "***1.5****"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "010}"), T(-1.5), TEST_STRLIT(CharT, "-0000001.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "+010.2f}"), T(1.5), TEST_STRLIT(CharT, "+000001.50"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "}"), cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "inf"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "F}"), -cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "-INF"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "010}"), cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "       inf"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "+}"), cuda::std::numeric_limits<T>::quiet_NaN(), TEST_STRLIT(CharT, "+nan"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "E}"), cuda::std::numeric_limits<T>::quiet_NaN(), TEST_STRLIT(CharT, "NAN"));
+
+  // The digits past the exact decimal expansion are written as trailing zeros
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, ".160e}"),
+    T(1.0),
+    TEST_STRLIT(CharT,
+                "1.0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                "000000000000000000000000000000000000000000000000000000000000000000000000e+00"));
+}
+
+template <class CharT>
+TEST_FUNC void test_type()
+{
+  test_type<CharT, float>();
+  test_type<CharT, double>();
+#if _CCCL_HAS_LONG_DOUBLE()
+  test_type<CharT, long double>();
+#endif // _CCCL_HAS_LONG_DOUBLE()
+}
+
+TEST_FUNC bool test()
+{
+  test_type<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test_type<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
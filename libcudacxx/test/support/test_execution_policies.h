@@ -30,6 +30,11 @@
   template <class... Args>                                                                                              \
   inline constexpr bool sfinae_test_##FUNCTION = sfinae_test_##FUNCTION##_impl<void, Args...>::value;
 
+// Sizes of the ranges passed to the parallel algorithms. The larger ones are split between several threads by the host
+// backend, and not evenly.
+inline constexpr int pstl_test_max_size = 100003;
+inline constexpr int pstl_test_sizes[]  = {0, 1, 2, 100, 4097, pstl_test_max_size};
+
 _CCCL_EXEC_CHECK_DISABLE
 template <class Functor>
 TEST_FUNC bool test_execution_policies(Functor func)
@@ -405,6 +405,53 @@ void TestCopyIfStencil(const size_t n)
 }
 DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestCopyIfStencil);
 
+template <bool Selected>
+struct select_all
+{
+  _CCCL_HOST_DEVICE bool operator()(int) const
+  {
+    return Selected;
+  }
+};
+
+// The parallel host backends select the elements of every chunk independently and offset the output of a chunk by the
+// number of elements selected in the chunks in front of it. The sizes span several chunks, and the predicates select
+// every element, none, or every other one, so that the selected elements straddle the chunk boundaries.
+template <typename Predicate>
+void TestCopyIfChunksHelper(Predicate pred)
+{
+  for (int n : {1023, 1025, 3000, 100003})
+  {
+    thrust::host_vector<int> h_data(n);
+    thrust::sequence(h_data.begin(), h_data.end());
+    thrust::device_vector<int> d_data = h_data;
+
+    thrust::host_vector<int> h_ref(n);
+    h_ref.erase(std::copy_if(h_data.begin(), h_data.end(), h_ref.begin(), pred), h_ref.end());
+
+    {
+      thrust::device_vector<int> d_result(n, -1);
+      d_result.erase(thrust::copy_if(d_data.begin(), d_data.end(), d_result.begin(), pred), d_result.end());
+      ASSERT_EQUAL(d_result, h_ref);
+    }
+
+    {
+      thrust::device_vector<int> d_result(n, -1);
+      d_result.erase(thrust::copy_if(d_data.begin(), d_data.end(), d_data.begin(), d_result.begin(), pred),
+                     d_result.end());
+      ASSERT_EQUAL(d_result, h_ref);
+    }
+  }
+}
+
+void TestCopyIfChunks()
+{
+  TestCopyIfChunksHelper(select_all<true>{});
+  TestCopyIfChunksHelper(select_all<false>{});
+  TestCopyIfChunksHelper(is_even<int>{});
+}
+DECLARE_UNITTEST(TestCopyIfChunks);
+
 namespace
 {
 struct object_with_non_trivial_ctor
@@ -5,6 +5,9 @@
 
 #include <cuda/std/cstdint>
 
+#include <algorithm>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <class Vector>
@@ -240,6 +243,39 @@ struct TestFindIfNot
 };
 VariableUnitTest<TestFindIfNot, SignedIntegralTypes> TestFindIfNotInstance;
 
+// The parallel host backends search several chunks of a few thousand elements at once, and must still return the
+// lowest match, whichever chunk is searched first
+void TestFindMatchPositions()
+{
+  const int n = 10 * 4096 + 123;
+
+  const std::vector<std::vector<int>> matches = {
+    {5},                                           // in the first chunk
+    {n - 3},                                       // in the last chunk
+    {},                                            // none
+    {9 * 4096 + 3, 2 * 4096 + 5, n - 1, 5 * 4096}, // several, the lowest wins
+    {0, n - 1},                                    // at both ends
+  };
+
+  for (const auto& positions : matches)
+  {
+    thrust::host_vector<int> h_data(n, 0);
+    for (int position : positions)
+    {
+      h_data[position] = 1;
+    }
+    thrust::device_vector<int> d_data = h_data;
+
+    const int expected = positions.empty() ? n : *std::min_element(positions.begin(), positions.end());
+
+    using thrust::placeholders::_1;
+    ASSERT_EQUAL(thrust::find(d_data.begin(), d_data.end(), 1) - d_data.begin(), expected);
+    ASSERT_EQUAL(thrust::find_if(d_data.begin(), d_data.end(), _1 == 1) - d_data.begin(), expected);
+    ASSERT_EQUAL(thrust::find_if_not(d_data.begin(), d_data.end(), _1 == 0) - d_data.begin(), expected);
+  }
+}
+DECLARE_UNITTEST(TestFindMatchPositions);
+
 void TestFindWithBigIndexesHelper(int magnitude)
 {
   thrust::counting_iterator<long long> begin(1);
@@ -505,3 +505,226 @@ void TestDisjointSynchronizedPoolSqueeze()
   TestDisjointPoolSqueeze<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolSqueeze);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolStatistics()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+
+  const std::size_t small_block     = opts.min_bytes_per_chunk / 8u - 3u;
+  const std::size_t oversized_block = opts.largest_block_size + 1u;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1u;
+  alloc_id a1             = pool.do_allocate(small_block);
+  upstream.id_to_allocate = 2u;
+  alloc_id a2             = pool.do_allocate(oversized_block);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 2u);
+  ASSERT_EQUAL(stats.upstream_deallocations, 0u);
+  ASSERT_EQUAL(stats.upstream_bytes, upstream.used_bytes);
+  ASSERT_EQUAL(stats.peak_upstream_bytes, upstream.used_bytes);
+  ASSERT_EQUAL(stats.bytes_in_use, small_block + oversized_block);
+  ASSERT_EQUAL(stats.block_bytes_in_use, opts.min_bytes_per_chunk / 8u + oversized_block);
+  ASSERT_EQUAL(stats.oversized_allocations, 1u);
+  ASSERT_EQUAL(stats.oversized_hits, 0u);
+
+  std::size_t chunks = 0;
+  for (const thrust::mr::pool_size_class_statistics& size_class : stats.size_classes)
+  {
+    chunks += size_class.chunks;
+    if (size_class.block_size == opts.min_bytes_per_chunk / 8u)
+    {
+      ASSERT_EQUAL(size_class.allocations, 1u);
+      ASSERT_EQUAL(size_class.chunks, 1u);
+      ASSERT_GEQUAL(size_class.blocks, opts.min_blocks_per_chunk);
+      ASSERT_GEQUAL(size_class.blocks * size_class.block_size, opts.min_bytes_per_chunk);
+    }
+  }
+  ASSERT_EQUAL(chunks, 1u);
+
+  pool.do_deallocate(a2, oversized_block);
+  alloc_id a3 = pool.do_allocate(oversized_block);
+  ASSERT_EQUAL(a3.id, 2u);
+  pool.do_deallocate(a3, oversized_block);
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.bytes_in_use, small_block);
+  ASSERT_EQUAL(stats.oversized_allocations, 2u);
+  ASSERT_EQUAL(stats.oversized_hits, 1u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, oversized_block);
+
+  // release returns the chunk and the cached block, and counts the block still in use as deallocated
+  const std::size_t peak = stats.peak_upstream_bytes;
+  pool.release();
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.peak_upstream_bytes, peak);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+  for (const thrust::mr::pool_size_class_statistics& size_class : stats.size_classes)
+  {
+    ASSERT_EQUAL(size_class.deallocations, size_class.allocations);
+  }
+  (void) a1;
+}
+
+void TestDisjointUnsynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolStatistics);
+
+void TestDisjointSynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolStatistics);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolTrim()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  void* a1 = pool.do_allocate(64);
+  void* a2 = pool.do_allocate(512);
+  void* a3 = pool.do_allocate(4096);
+  void* a4 = pool.do_allocate(8192);
+  pool.do_deallocate(a2, 512);
+  pool.do_deallocate(a3, 4096);
+  pool.do_deallocate(a4, 8192);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 4u);
+  ASSERT_EQUAL(pool.trim(stats.upstream_bytes), 0u);
+
+  // keeping all but a byte of the idle memory only returns the largest cached block
+  const std::size_t idle = stats.upstream_bytes - stats.block_bytes_in_use;
+  ASSERT_EQUAL(pool.trim(idle - 1), 8192u);
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_deallocations, 1u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 4096u);
+
+  // the chunk of the block still in use is kept
+  ASSERT_GEQUAL(pool.trim(), 4096u + 512u);
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_deallocations, 3u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+  ASSERT_EQUAL(stats.block_bytes_in_use, 64u);
+
+  void* a5 = pool.do_allocate(64);
+  stats    = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 4u);
+
+  pool.do_deallocate(a1, 64);
+  pool.do_deallocate(a5, 64);
+  pool.trim();
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolTrim()
+{
+  TestDisjointPoolTrim<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolTrim);
+
+void TestDisjointSynchronizedPoolTrim()
+{
+  TestDisjointPoolTrim<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolTrim);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolReleasePolicy()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  {
+    // any idle memory above the threshold is returned on deallocation
+    opts.release_threshold = 0;
+    Pool pool(&upstream, &bookkeeper, opts);
+
+    void* a1 = pool.do_allocate(64);
+    void* a2 = pool.do_allocate(4096);
+    pool.do_deallocate(a2, 4096);
+
+    thrust::mr::pool_statistics stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_deallocations, 1u);
+    ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+
+    pool.do_deallocate(a1, 64);
+    pool.trim();
+  }
+
+  {
+    // memory that stays idle for a whole interval is returned
+    opts.release_threshold     = thrust::mr::pool_options().release_threshold;
+    opts.idle_release_interval = 4;
+    Pool pool(&upstream, &bookkeeper, opts);
+
+    pool.do_deallocate(pool.do_allocate(4096), 4096);
+
+    // the first check finds the cached block, which is released by the second one
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      pool.do_deallocate(pool.do_allocate(64), 64);
+    }
+    thrust::mr::pool_statistics stats = pool.statistics();
+    ASSERT_EQUAL(stats.cached_oversized_bytes, 4096u);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      pool.do_deallocate(pool.do_allocate(64), 64);
+    }
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+    ASSERT_EQUAL(stats.upstream_allocations - stats.upstream_deallocations, 1u);
+
+    // the chunk of 64 byte blocks is released once that size class stays unused for a whole interval
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      pool.do_deallocate(pool.do_allocate(512), 512);
+    }
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_allocations - stats.upstream_deallocations, 1u);
+    ASSERT_EQUAL(stats.upstream_allocations, 3u);
+  }
+}
+
+void TestDisjointUnsynchronizedPoolReleasePolicy()
+{
+  TestDisjointPoolReleasePolicy<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolReleasePolicy);
+
+void TestDisjointSynchronizedPoolReleasePolicy()
+{
+  TestDisjointPoolReleasePolicy<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolReleasePolicy);
@@ -0,0 +1,203 @@
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/page.h>
+#include <thrust/sequence.h>
+
+#include <cstdint>
+
+#include <unittest/unittest.h>
+
+struct counting_first_touch
+{
+  std::size_t* pages;
+
+  void operator()(char* p, std::size_t bytes, std::size_t page_size) const
+  {
+    thrust::mr::serial_first_touch{}(p, bytes, page_size);
+    *pages += (bytes + page_size - 1) / page_size;
+  }
+};
+
+template <typename MemoryResource>
+void TestPageAllocation(MemoryResource& memres, std::size_t size, std::size_t alignment)
+{
+  void* ptr = memres.do_allocate(size, alignment);
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+
+  char* char_ptr = static_cast<char*>(ptr);
+  thrust::fill(char_ptr, char_ptr + size, char{1});
+  ASSERT_EQUAL(char_ptr[size - 1], char{1});
+
+  memres.do_deallocate(ptr, size, alignment);
+}
+
+void TestPageResourceAllocation()
+{
+  thrust::mr::page_resource_options options;
+  options.min_bytes = 64 * 1024;
+
+  thrust::mr::page_resource<> memres(options);
+
+  for (std::size_t size : {1u, 1000u, 64u * 1024u, 64u * 1024u + 1u, 3u * 1024u * 1024u + 5u})
+  {
+    for (std::size_t alignment : {16u, 4096u, 1024u * 1024u})
+    {
+      TestPageAllocation(memres, size, alignment);
+    }
+  }
+}
+DECLARE_UNITTEST(TestPageResourceAllocation);
+
+void TestPageResourceHugePages()
+{
+  thrust::mr::page_resource_options options;
+  options.min_bytes = 64 * 1024;
+
+  for (thrust::mr::huge_page_policy policy :
+       {thrust::mr::huge_page_policy::transparent, thrust::mr::huge_page_policy::reserved})
+  {
+    options.huge_pages = policy;
+    thrust::mr::page_resource<> memres(options);
+
+    // mapped allocations are aligned to huge pages, whether the system has them or not
+    void* ptr = memres.do_allocate(3 * 1024 * 1024);
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(ptr) % options.huge_page_size, 0u);
+    memres.do_deallocate(ptr, 3 * 1024 * 1024);
+
+    TestPageAllocation(memres, 100 * 1024, 64);
+    TestPageAllocation(memres, 5 * 1024 * 1024, 8 * 1024 * 1024);
+  }
+}
+DECLARE_UNITTEST(TestPageResourceHugePages);
+
+void TestPageResourceNumaPlacement()
+{
+  thrust::mr::page_resource_options options;
+  options.min_bytes = 64 * 1024;
+
+  // placement is a hint, which must not make allocations fail on machines with a single node
+  for (thrust::mr::numa_policy policy : {thrust::mr::numa_policy::interleave, thrust::mr::numa_policy::bind})
+  {
+    options.numa = policy;
+    thrust::mr::page_resource<> memres(options);
+    TestPageAllocation(memres, 1024 * 1024, 64);
+
+    options.numa_nodes = 1;
+    thrust::mr::page_resource<> node_memres(options);
+    TestPageAllocation(node_memres, 1024 * 1024, 64);
+  }
+}
+DECLARE_UNITTEST(TestPageResourceNumaPlacement);
+
+void TestPageResourceFirstTouch()
+{
+  std::size_t pages = 0;
+
+  thrust::mr::page_resource_options options;
+  options.min_bytes = 64 * 1024;
+
+  thrust::mr::page_resource<counting_first_touch> memres(options, counting_first_touch{&pages});
+
+  // small allocations are not touched
+  void* ptr = memres.do_allocate(1024);
+  memres.do_deallocate(ptr, 1024);
+  ASSERT_EQUAL(pages, 0u);
+
+  ptr = memres.do_allocate(1024 * 1024);
+  ASSERT_GEQUAL(pages, 1u);
+  memres.do_deallocate(ptr, 1024 * 1024);
+
+  options.first_touch = false;
+  pages               = 0;
+  thrust::mr::page_resource<counting_first_touch> untouched(options, counting_first_touch{&pages});
+  ptr = untouched.do_allocate(1024 * 1024);
+  untouched.do_deallocate(ptr, 1024 * 1024);
+  ASSERT_EQUAL(pages, 0u);
+}
+DECLARE_UNITTEST(TestPageResourceFirstTouch);
+
+void TestPageResourceExpand()
+{
+  std::size_t pages = 0;
+
+  thrust::mr::page_resource_options options;
+  options.min_bytes = 64 * 1024;
+
+  thrust::mr::page_resource<counting_first_touch> memres(options, counting_first_touch{&pages});
+
+  // allocations served by operator new are not grown
+  void* ptr = memres.do_allocate(1024);
+  ASSERT_EQUAL(memres.expand(ptr, 1024, 2 * 1024 * 1024), false);
+  memres.do_deallocate(ptr, 1024);
+
+  const std::size_t size = 1024 * 1024;
+  ptr                    = memres.do_allocate(size);
+  thrust::fill(static_cast<char*>(ptr), static_cast<char*>(ptr) + size, char{7});
+
+  pages = 0;
+#if defined(MREMAP_MAYMOVE)
+  ASSERT_EQUAL(memres.expand(ptr, size, 8 * size), true);
+
+  // the contents are kept, and only the new pages are touched
+  char* char_ptr = static_cast<char*>(ptr);
+  ASSERT_EQUAL(char_ptr[0], char{7});
+  ASSERT_EQUAL(char_ptr[size - 1], char{7});
+  ASSERT_EQUAL(pages, 7 * size / thrust::mr::detail::system_page_size());
+  thrust::fill(char_ptr + size, char_ptr + 8 * size, char{8});
+  ASSERT_EQUAL(char_ptr[8 * size - 1], char{8});
+
+  memres.do_deallocate(ptr, 8 * size);
+#else
+  ASSERT_EQUAL(memres.expand(ptr, size, 8 * size), false);
+  memres.do_deallocate(ptr, size);
+#endif
+}
+DECLARE_UNITTEST(TestPageResourceExpand);
+
+void TestPageResourceVectorGrowth()
+{
+  thrust::mr::page_resource_options options;
+  options.min_bytes = 64 * 1024;
+
+  thrust::mr::page_resource<> memres(options);
+
+  using allocator = thrust::mr::allocator<int, thrust::mr::page_resource<>>;
+  thrust::host_vector<int, allocator> v{allocator(&memres)};
+
+  // grows from storage served by operator new to mapped storage, and then from mapped storage without copying
+  for (int i = 0; i < 1000000; ++i)
+  {
+    v.push_back(i);
+  }
+  ASSERT_EQUAL(v.size(), 1000000u);
+  ASSERT_EQUAL(v[0], 0);
+  ASSERT_EQUAL(v[999999], 999999);
+
+  v.reserve(3000000);
+  ASSERT_GEQUAL(v.capacity(), 3000000u);
+  ASSERT_EQUAL(v[999999], 999999);
+
+  v.resize(4000000, 5);
+  ASSERT_EQUAL(v[999999], 999999);
+  ASSERT_EQUAL(v[3999999], 5);
+
+  thrust::host_vector<int> inserted(5000000);
+  thrust::sequence(inserted.begin(), inserted.end());
+  v.insert(v.begin() + 1, inserted.begin(), inserted.end());
+  ASSERT_EQUAL(v.size(), 9000000u);
+  ASSERT_EQUAL(v[0], 0);
+  ASSERT_EQUAL(v[1], 0);
+  ASSERT_EQUAL(v[5000000], 4999999);
+  ASSERT_EQUAL(v[5000001], 1);
+  ASSERT_EQUAL(v[8999999], 5);
+
+  // the inserted value refers to an element, which must survive the storage moving
+  v.insert(v.begin(), 10000000, v[5000000]);
+  ASSERT_EQUAL(v.size(), 19000000u);
+  ASSERT_EQUAL(v[0], 4999999);
+  ASSERT_EQUAL(v[9999999], 4999999);
+  ASSERT_EQUAL(v[10000000], 0);
+  ASSERT_EQUAL(v[18999999], 5);
+}
+DECLARE_UNITTEST(TestPageResourceVectorGrowth);
@@ -1,9 +1,18 @@
 #include <thrust/detail/config.h>
 
+#include <thrust/mr/concurrent_pool.h>
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -237,6 +246,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestConcurrentPool()
+{
+  TestPool<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -346,6 +361,477 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestConcurrentPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPoolCachingOversized);
+
+template <template <typename> class PoolTemplate>
+void TestPoolSizeClasses()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts  = Pool::get_default_options();
+  opts.smallest_block_size       = 64;
+  opts.size_classes_per_doubling = 4;
+  ASSERT_EQUAL(opts.validate(), true);
+
+  Pool pool(&upstream, opts);
+
+  // 72 and 80 bytes share the class of 80 byte blocks
+  tracked_pointer<void> a1 = pool.do_allocate(72, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a1, 72, THRUST_MR_DEFAULT_ALIGNMENT);
+  tracked_pointer<void> a2 = pool.do_allocate(80, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(a2.ptr, a1.ptr);
+  pool.do_deallocate(a2, 80, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  // 100 bytes are served from 112 byte blocks, not from the 128 byte blocks of the next power of two
+  tracked_pointer<void> a3 = pool.do_allocate(100, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_NOT_EQUAL(a3.ptr, a1.ptr);
+  pool.do_deallocate(a3, 100, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  // blocks of every class are large enough for their requests and aligned
+  std::vector<tracked_pointer<void>> blocks;
+  for (std::size_t size = 1; size <= opts.largest_block_size; size = size * 9 / 8 + 1)
+  {
+    tracked_pointer<void> block = pool.do_allocate(size, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(block.ptr) % THRUST_MR_DEFAULT_ALIGNMENT, 0u);
+    std::memset(block.ptr, static_cast<int>(blocks.size()), size);
+    blocks.push_back(block);
+  }
+
+  std::size_t i = 0;
+  for (std::size_t size = 1; size <= opts.largest_block_size; size = size * 9 / 8 + 1, ++i)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(blocks[i].ptr);
+    ASSERT_EQUAL(std::count(bytes, bytes + size, static_cast<unsigned char>(i)), static_cast<std::ptrdiff_t>(size));
+    pool.do_deallocate(blocks[i], size, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolSizeClasses()
+{
+  TestPoolSizeClasses<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolSizeClasses);
+
+void TestSynchronizedPoolSizeClasses()
+{
+  TestPoolSizeClasses<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolSizeClasses);
+
+void TestConcurrentPoolSizeClasses()
+{
+  TestPoolSizeClasses<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPoolSizeClasses);
+
+template <template <typename> class PoolTemplate>
+void TestPoolSplittingOversized()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.split_cached_oversized   = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  upstream.id_to_allocate  = 1;
+  tracked_pointer<void> a1 = pool.do_allocate(64 * 1024, 32);
+  ASSERT_EQUAL(a1.id, 1u);
+  pool.do_deallocate(a1, 64 * 1024, 32);
+
+  // the cached block is too big to be used for either request as a whole, so it is split between them; any new
+  // allocation from upstream would fail
+  tracked_pointer<void> a2 = pool.do_allocate(2048, 32);
+  ASSERT_EQUAL(a2.id, 1u);
+  ASSERT_EQUAL(a2.ptr, a1.ptr);
+
+  tracked_pointer<void> a3 = pool.do_allocate(4000, 32);
+  ASSERT_EQUAL(a3.id, 1u);
+  ASSERT_GEQUAL(static_cast<char*>(a3.ptr), static_cast<char*>(a2.ptr) + 2048);
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(a3.ptr) % 32, 0u);
+  std::memset(a2.ptr, 0x12, 2048);
+  std::memset(a3.ptr, 0x34, 4000);
+
+  // the pieces are merged again when they are deallocated, regardless of the order
+  pool.do_deallocate(a2, 2048, 32);
+  pool.do_deallocate(a3, 4000, 32);
+
+  tracked_pointer<void> a4 = pool.do_allocate(64 * 1024, 32);
+  ASSERT_EQUAL(a4.id, 1u);
+  ASSERT_EQUAL(a4.ptr, a1.ptr);
+  pool.do_deallocate(a4, 64 * 1024, 32);
+
+  // releasing returns the whole upstream allocation, even while a piece of it is still allocated
+  tracked_pointer<void> a5 = pool.do_allocate(3000, 32);
+  ASSERT_EQUAL(a5.id, 1u);
+
+  upstream.id_to_deallocate = 1;
+  pool.release();
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+}
+
+void TestUnsynchronizedPoolSplittingOversized()
+{
+  TestPoolSplittingOversized<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolSplittingOversized);
+
+void TestSynchronizedPoolSplittingOversized()
+{
+  TestPoolSplittingOversized<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolSplittingOversized);
+
+template <template <typename> class PoolTemplate>
+void TestPoolSplittingOversizedMixed()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.split_cached_oversized   = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  // a cached block whose size is not a multiple of its alignment is reused as a whole for a request of the same size
+  tracked_pointer<void> a1 = pool.do_allocate(100001, 32);
+  pool.do_deallocate(a1, 100001, 32);
+  tracked_pointer<void> a2 = pool.do_allocate(100001, 32);
+  ASSERT_EQUAL(a2.ptr, a1.ptr);
+  std::memset(a2.ptr, 0x56, 100001);
+  pool.do_deallocate(a2, 100001, 32);
+
+  struct allocation
+  {
+    tracked_pointer<void> ptr;
+    std::size_t size;
+    std::size_t alignment;
+    unsigned char pattern;
+  };
+
+  // splits and merges blocks of mixed sizes and alignments, and checks that live allocations never overlap
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> size_dist(opts.largest_block_size + 1, 200000);
+  std::uniform_int_distribution<std::size_t> alignment_dist(3, 8);
+  std::vector<allocation> live;
+  for (int i = 0; i < 4000; ++i)
+  {
+    if (live.size() < 16 && (live.empty() || rng() % 3 != 0))
+    {
+      allocation a;
+      a.size      = size_dist(rng);
+      a.alignment = std::size_t{1} << alignment_dist(rng);
+      a.pattern   = static_cast<unsigned char>(i);
+      a.ptr       = pool.do_allocate(a.size, a.alignment);
+      ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(a.ptr.ptr) % a.alignment, 0u);
+      std::memset(a.ptr.ptr, a.pattern, a.size);
+      live.push_back(a);
+    }
+    else
+    {
+      const std::size_t j = rng() % live.size();
+      const allocation a  = live[j];
+      const unsigned char* bytes = static_cast<const unsigned char*>(a.ptr.ptr);
+      ASSERT_EQUAL(std::count(bytes, bytes + a.size, a.pattern), static_cast<std::ptrdiff_t>(a.size));
+      pool.do_deallocate(a.ptr, a.size, a.alignment);
+      live.erase(live.begin() + j);
+    }
+  }
+
+  for (const allocation& a : live)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(a.ptr.ptr);
+    ASSERT_EQUAL(std::count(bytes, bytes + a.size, a.pattern), static_cast<std::ptrdiff_t>(a.size));
+    pool.do_deallocate(a.ptr, a.size, a.alignment);
+  }
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolSplittingOversizedMixed()
+{
+  TestPoolSplittingOversizedMixed<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolSplittingOversizedMixed);
+
+void TestSynchronizedPoolSplittingOversizedMixed()
+{
+  TestPoolSplittingOversizedMixed<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolSplittingOversizedMixed);
+
+template <template <typename> class PoolTemplate>
+void TestPoolStatistics()
+{
+  tracked_resource upstream;
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  tracked_pointer<void> a1 = pool.do_allocate(100, THRUST_MR_DEFAULT_ALIGNMENT);
+  tracked_pointer<void> a2 = pool.do_allocate(120, THRUST_MR_DEFAULT_ALIGNMENT);
+  tracked_pointer<void> a3 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.bytes_in_use, 100u + 120u + 4096u);
+  ASSERT_EQUAL(stats.block_bytes_in_use, 128u + 128u + 4096u);
+  ASSERT_EQUAL(stats.oversized_allocations, 1u);
+  ASSERT_EQUAL(stats.oversized_hits, 0u);
+  ASSERT_GEQUAL(stats.upstream_allocations, 2u);
+  ASSERT_GEQUAL(stats.upstream_bytes, stats.block_bytes_in_use);
+  ASSERT_EQUAL(stats.peak_upstream_bytes, stats.upstream_bytes);
+
+  std::size_t allocations = 0;
+  for (const thrust::mr::pool_size_class_statistics& size_class : stats.size_classes)
+  {
+    allocations += size_class.allocations;
+    if (size_class.block_size == 128)
+    {
+      ASSERT_EQUAL(size_class.allocations, 2u);
+      ASSERT_EQUAL(size_class.deallocations, 0u);
+      ASSERT_EQUAL(size_class.chunks, 1u);
+      ASSERT_GEQUAL(size_class.blocks, 2u);
+    }
+  }
+  ASSERT_EQUAL(allocations, 2u);
+
+  pool.do_deallocate(a1, 100, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  a3 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.bytes_in_use, 120u + 4096u);
+  ASSERT_EQUAL(stats.block_bytes_in_use, 128u + 4096u);
+  ASSERT_EQUAL(stats.oversized_allocations, 2u);
+  ASSERT_EQUAL(stats.oversized_hits, 1u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 4096u);
+
+  // release counts the block that is still allocated as deallocated
+  const std::size_t peak = stats.peak_upstream_bytes;
+  pool.release();
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.upstream_deallocations, stats.upstream_allocations);
+  ASSERT_EQUAL(stats.peak_upstream_bytes, peak);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.block_bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+  for (const thrust::mr::pool_size_class_statistics& size_class : stats.size_classes)
+  {
+    ASSERT_EQUAL(size_class.deallocations, size_class.allocations);
+  }
+  (void) a2;
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolStatistics);
+
+void TestSynchronizedPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolStatistics);
+
+void TestConcurrentPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPoolStatistics);
+
+template <template <typename> class PoolTemplate>
+void TestPoolTrim()
+{
+  tracked_resource upstream;
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  tracked_pointer<void> a1 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+  tracked_pointer<void> a2 = pool.do_allocate(512, THRUST_MR_DEFAULT_ALIGNMENT);
+  tracked_pointer<void> a3 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  tracked_pointer<void> a4 = pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a2, 512, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a4, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 4u);
+  ASSERT_EQUAL(pool.trim(stats.upstream_bytes), 0u);
+
+  // keeping all but a byte of the idle memory only returns the largest cached block
+  const std::size_t idle = stats.upstream_bytes - stats.block_bytes_in_use;
+  ASSERT_GEQUAL(pool.trim(idle - 1), 8192u);
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_deallocations, 1u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 4096u);
+
+  // the chunk of the block still in use is kept
+  ASSERT_GEQUAL(pool.trim(), 4096u + 512u);
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_deallocations, 3u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+  ASSERT_EQUAL(stats.block_bytes_in_use, 64u);
+
+  std::memset(a1.ptr, 0x12, 64);
+  tracked_pointer<void> a5 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+  a2                       = pool.do_allocate(512, THRUST_MR_DEFAULT_ALIGNMENT);
+  stats                    = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 5u);
+  std::memset(a5.ptr, 0x34, 64);
+  std::memset(a2.ptr, 0x56, 512);
+
+  pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a2, 512, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a5, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.trim();
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolTrim()
+{
+  TestPoolTrim<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolTrim);
+
+void TestSynchronizedPoolTrim()
+{
+  TestPoolTrim<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolTrim);
+
+template <template <typename> class PoolTemplate>
+void TestPoolReleasePolicy()
+{
+  tracked_resource upstream;
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  {
+    // any idle memory above the threshold is returned on deallocation
+    opts.release_threshold = 0;
+    Pool pool(&upstream, opts);
+
+    tracked_pointer<void> a1 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+    tracked_pointer<void> a2 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a2, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    thrust::mr::pool_statistics stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_deallocations, 1u);
+    ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+
+    // the chunk that was partially in use did not grow the idle memory by half when it became free
+    pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_deallocations, 1u);
+
+    a1 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+    a2 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a2, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  }
+
+  {
+    // memory that stays idle for a whole interval is returned
+    opts.release_threshold     = thrust::mr::pool_options().release_threshold;
+    opts.idle_release_interval = 4;
+    Pool pool(&upstream, opts);
+
+    tracked_pointer<void> oversized = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(oversized, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // the first check finds the cached block, which is released by the second one
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      pool.do_deallocate(pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT), 64, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+    thrust::mr::pool_statistics stats = pool.statistics();
+    ASSERT_EQUAL(stats.cached_oversized_bytes, 4096u);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      pool.do_deallocate(pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT), 64, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+    ASSERT_EQUAL(stats.upstream_allocations - stats.upstream_deallocations, 1u);
+
+    // the chunk of 64 byte blocks is released once that size class stays unused for a whole interval
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      pool.do_deallocate(pool.do_allocate(512, THRUST_MR_DEFAULT_ALIGNMENT), 512, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_allocations - stats.upstream_deallocations, 1u);
+    ASSERT_EQUAL(stats.upstream_allocations, 3u);
+  }
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolReleasePolicy()
+{
+  TestPoolReleasePolicy<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolReleasePolicy);
+
+void TestSynchronizedPoolReleasePolicy()
+{
+  TestPoolReleasePolicy<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolReleasePolicy);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -365,3 +851,138 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestConcurrentGlobalPool()
+{
+  TestGlobalPool<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentGlobalPool);
+
+void TestConcurrentPoolCrossThreadDeallocation()
+{
+  using Pool = thrust::mr::concurrent_pool_resource<thrust::mr::new_delete_resource>;
+  Pool pool;
+
+  constexpr int num_threads     = 4;
+  constexpr int num_allocations = 10000;
+
+  // every thread allocates blocks of several sizes and hands them to the next thread to deallocate
+  std::vector<std::vector<void*>> allocated(num_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < num_allocations; ++i)
+      {
+        const std::size_t size = std::size_t{8} << (i % 12);
+        void* p                = pool.allocate(size);
+        std::memset(p, t, size);
+        allocated[t].push_back(p);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  threads.clear();
+
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      const auto& blocks = allocated[(t + 1) % num_threads];
+      for (int i = 0; i < num_allocations; ++i)
+      {
+        const std::size_t size = std::size_t{8} << (i % 12);
+        ASSERT_EQUAL(static_cast<unsigned char*>(blocks[i])[size - 1], (t + 1) % num_threads);
+        pool.deallocate(blocks[i], size);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  // the blocks given back by the exited threads are reused instead of allocating new memory
+  std::vector<void*> reused;
+  for (int i = 0; i < num_allocations; ++i)
+  {
+    const std::size_t size = std::size_t{8} << (i % 12);
+    void* p                = pool.allocate(size);
+    bool found             = false;
+    for (const auto& blocks : allocated)
+    {
+      found = found || std::find(blocks.begin(), blocks.end(), p) != blocks.end();
+    }
+    ASSERT_EQUAL(found, true);
+    reused.push_back(p);
+  }
+  for (int i = 0; i < num_allocations; ++i)
+  {
+    pool.deallocate(reused[i], std::size_t{8} << (i % 12));
+  }
+}
+DECLARE_UNITTEST(TestConcurrentPoolCrossThreadDeallocation);
+
+class failing_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  void* do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (fail)
+    {
+      throw std::bad_alloc();
+    }
+    return upstream.do_allocate(n, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    upstream.do_deallocate(p, n, alignment);
+  }
+
+  bool fail = false;
+
+private:
+  thrust::mr::new_delete_resource upstream;
+};
+
+// A chunk that the upstream resource fails to allocate is not counted, and does not grow the next chunk
+void TestConcurrentPoolUpstreamFailure()
+{
+  failing_resource upstream;
+  thrust::mr::concurrent_pool_resource<failing_resource> pool(&upstream);
+
+  upstream.fail = true;
+  ASSERT_THROWS((void) pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT), std::bad_alloc);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 0u);
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  for (const thrust::mr::pool_size_class_statistics& size_class : stats.size_classes)
+  {
+    ASSERT_EQUAL(size_class.allocations, 0u);
+    ASSERT_EQUAL(size_class.chunks, 0u);
+    ASSERT_EQUAL(size_class.blocks, 0u);
+  }
+
+  upstream.fail = false;
+  void* p       = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 1u);
+  for (const thrust::mr::pool_size_class_statistics& size_class : stats.size_classes)
+  {
+    if (size_class.block_size == 64)
+    {
+      ASSERT_EQUAL(size_class.allocations, 1u);
+      ASSERT_EQUAL(size_class.chunks, 1u);
+      ASSERT_EQUAL(size_class.blocks * 64, stats.upstream_bytes);
+    }
+  }
+
+  pool.do_deallocate(p, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+}
+DECLARE_UNITTEST(TestConcurrentPoolUpstreamFailure);
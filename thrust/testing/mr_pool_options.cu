@@ -62,3 +62,32 @@ void TestPoolOptionsComplexValidity()
   ASSERT_EQUAL(options.validate(), true);
 }
 DECLARE_UNITTEST(TestPoolOptionsComplexValidity);
+
+void TestPoolOptionsSizeClassesValidity()
+{
+  thrust::mr::pool_options options = thrust::mr::pool_options();
+  ASSERT_EQUAL(options.size_classes_per_doubling, 1u);
+
+  options.max_blocks_per_chunk = 1024;
+  options.max_bytes_per_chunk  = 1024 * 1024;
+  options.smallest_block_size  = 64;
+  options.largest_block_size   = 1024;
+  options.alignment            = 16;
+  ASSERT_EQUAL(options.validate(), true);
+
+  options.size_classes_per_doubling = 4;
+  ASSERT_EQUAL(options.validate(), true);
+
+  // the number of classes must be a power of two
+  options.size_classes_per_doubling = 0;
+  ASSERT_EQUAL(options.validate(), false);
+  options.size_classes_per_doubling = 3;
+  ASSERT_EQUAL(options.validate(), false);
+
+  // the classes right above the smallest block size would not be multiples of the alignment
+  options.size_classes_per_doubling = 8;
+  ASSERT_EQUAL(options.validate(), false);
+  options.smallest_block_size = 128;
+  ASSERT_EQUAL(options.validate(), true);
+}
+DECLARE_UNITTEST(TestPoolOptionsSizeClassesValidity);
@@ -0,0 +1,144 @@
+#include <thrust/mr/new.h>
+#include <thrust/mr/statistics_adaptor.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+void TestStatisticsAdaptorCounters()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_resource_adaptor<thrust::mr::new_delete_resource> adaptor(&upstream);
+
+  void* a1 = adaptor.do_allocate(100);
+  void* a2 = adaptor.do_allocate(1);
+  void* a3 = adaptor.do_allocate(4096);
+  adaptor.do_deallocate(a3, 4096);
+  void* a4 = adaptor.do_allocate(128);
+
+  thrust::mr::allocation_statistics stats = adaptor.statistics();
+  ASSERT_EQUAL(stats.allocations, 4u);
+  ASSERT_EQUAL(stats.deallocations, 1u);
+  ASSERT_EQUAL(stats.bytes_allocated, 100u + 1u + 4096u + 128u);
+  ASSERT_EQUAL(stats.bytes_deallocated, 4096u);
+  ASSERT_EQUAL(stats.bytes_in_use, 100u + 1u + 128u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 100u + 1u + 4096u);
+  ASSERT_EQUAL(stats.largest_allocation, 4096u);
+  ASSERT_EQUAL(stats.threads, 1u);
+
+  // 100 and 128 bytes both fall into the bin of at most 128 bytes
+  ASSERT_EQUAL(stats.size_histogram[0], 1u);
+  ASSERT_EQUAL(stats.size_histogram[7], 2u);
+  ASSERT_EQUAL(stats.size_histogram[12], 1u);
+
+  adaptor.do_deallocate(a1, 100);
+  adaptor.do_deallocate(a2, 1);
+  adaptor.do_deallocate(a4, 128);
+
+  stats = adaptor.statistics();
+  ASSERT_EQUAL(stats.deallocations, 4u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 100u + 1u + 4096u);
+
+  // without a capacity, nothing is traced
+  ASSERT_EQUAL(adaptor.trace().size(), 0u);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorCounters);
+
+void TestStatisticsAdaptorThreads()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_resource_adaptor<thrust::mr::new_delete_resource> adaptor(&upstream);
+
+  const std::size_t threads_count = 4;
+  const std::size_t iterations    = 1000;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < threads_count; ++t)
+  {
+    threads.emplace_back([&adaptor, t] {
+      for (std::size_t i = 0; i < iterations; ++i)
+      {
+        void* p = adaptor.do_allocate(16 << t);
+        adaptor.do_deallocate(p, 16 << t);
+      }
+    });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  thrust::mr::allocation_statistics stats = adaptor.statistics();
+  ASSERT_EQUAL(stats.threads, threads_count);
+  ASSERT_EQUAL(stats.allocations, threads_count * iterations);
+  ASSERT_EQUAL(stats.deallocations, threads_count * iterations);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_LEQUAL(stats.peak_bytes_in_use, 16u + 32u + 64u + 128u);
+  ASSERT_EQUAL(stats.largest_allocation, 128u);
+  for (std::size_t t = 0; t < threads_count; ++t)
+  {
+    ASSERT_EQUAL(stats.size_histogram[4 + t], iterations);
+  }
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorThreads);
+
+void TestStatisticsAdaptorTrace()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_resource_adaptor<thrust::mr::new_delete_resource> adaptor(&upstream, 4);
+
+  void* a1                    = adaptor.do_allocate(8);
+  void* a2                    = adaptor.do_allocate(16, 64);
+  const std::uintptr_t a1_raw = reinterpret_cast<std::uintptr_t>(a1);
+  const std::uintptr_t a2_raw = reinterpret_cast<std::uintptr_t>(a2);
+  adaptor.do_deallocate(a1, 8);
+
+  std::vector<thrust::mr::allocation_event> trace = adaptor.trace();
+  ASSERT_EQUAL(trace.size(), 3u);
+  ASSERT_EQUAL(trace[0].sequence, 0u);
+  ASSERT_EQUAL(trace[0].allocation, true);
+  ASSERT_EQUAL(trace[0].address, a1_raw);
+  ASSERT_EQUAL(trace[0].bytes, 8u);
+  ASSERT_EQUAL(trace[1].alignment, 64u);
+  ASSERT_EQUAL(trace[2].allocation, false);
+  ASSERT_EQUAL(trace[2].thread, 0u);
+
+  // the oldest events are overwritten once the ring buffer is full
+  void* a3 = adaptor.do_allocate(32);
+  adaptor.do_deallocate(a3, 32);
+  adaptor.do_deallocate(a2, 16, 64);
+
+  trace = adaptor.trace();
+  ASSERT_EQUAL(trace.size(), 4u);
+  ASSERT_EQUAL(trace[0].sequence, 2u);
+  ASSERT_EQUAL(trace[3].sequence, 5u);
+  ASSERT_EQUAL(trace[3].address, a2_raw);
+  ASSERT_EQUAL(trace[3].bytes, 16u);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorTrace);
+
+void TestStatisticsAdaptorJson()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_resource_adaptor<thrust::mr::new_delete_resource> adaptor(&upstream, 1);
+
+  void* a1                    = adaptor.do_allocate(100);
+  const std::uintptr_t a1_raw = reinterpret_cast<std::uintptr_t>(a1);
+  adaptor.do_deallocate(a1, 100);
+
+  std::ostringstream os;
+  adaptor.write_json(os);
+
+  std::ostringstream expected;
+  expected << "{\"allocations\":1,\"deallocations\":1,\"bytes_allocated\":100,\"bytes_deallocated\":100,"
+           << "\"bytes_in_use\":0,\"peak_bytes_in_use\":100,\"largest_allocation\":100,\"threads\":1,"
+           << "\"size_histogram\":[{\"max_bytes\":128,\"count\":1}],"
+           << "\"trace\":[{\"sequence\":1,\"event\":\"deallocate\",\"address\":" << a1_raw
+           << ",\"bytes\":100,\"alignment\":" << THRUST_MR_DEFAULT_ALIGNMENT << ",\"thread\":0}]}";
+  ASSERT_EQUAL(os.str(), expected.str());
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorJson);
@@ -0,0 +1,139 @@
+#include <thrust/merge.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// Compares only the tens, so that the last digit of an output element tells which input it was taken from
+struct tens_less
+{
+  bool operator()(int a, int b) const
+  {
+    return a / 10 < b / 10;
+  }
+};
+
+// A sorted input of runs of run_length equivalent elements, which all end in tag
+std::vector<int> make_runs(int n, int run_length, int tag)
+{
+  std::vector<int> v(n);
+  for (int i = 0; i < n; ++i)
+  {
+    v[i] = (i / run_length) * 10 + tag;
+  }
+  return v;
+}
+
+// The partitions are only split between more than one thread
+class omp_num_threads_guard
+{
+  int m_max_threads;
+
+public:
+  explicit omp_num_threads_guard(int num_threads)
+      : m_max_threads(omp_get_max_threads())
+  {
+    omp_set_num_threads(num_threads);
+  }
+
+  ~omp_num_threads_guard()
+  {
+    omp_set_num_threads(m_max_threads);
+  }
+};
+
+// The inputs are large enough for one partition per thread, and their runs of equivalent elements have different
+// lengths in both inputs, so that the split points between the partitions fall inside runs, down to a single run that
+// spans both inputs entirely. Within a run, the elements of the first input must come first.
+const int run_lengths[][2] = {{7, 3}, {1, 5}, {60000, 45000}};
+
+void TestOmpMergeStability()
+{
+  for (int num_threads : {2, 3, 4, 7, 8})
+  {
+    omp_num_threads_guard guard(num_threads);
+
+    for (const auto& run_length : run_lengths)
+    {
+      const std::vector<int> lhs = make_runs(60000, run_length[0], 1);
+      const std::vector<int> rhs = make_runs(45000, run_length[1], 2);
+
+      std::vector<int> ref(lhs.size() + rhs.size());
+      std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ref.begin(), tens_less{});
+
+      std::vector<int> result(lhs.size() + rhs.size());
+      const auto result_end =
+        thrust::merge(thrust::omp::par, lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin(), tens_less{});
+
+      ASSERT_EQUAL(result_end - result.begin(), static_cast<std::ptrdiff_t>(ref.size()));
+      ASSERT_EQUAL(result, ref);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpMergeStability);
+
+void TestOmpMergeByKeyStability()
+{
+  for (int num_threads : {2, 3, 4, 7, 8})
+  {
+    omp_num_threads_guard guard(num_threads);
+
+    for (const auto& run_length : run_lengths)
+    {
+      const std::vector<int> lhs_keys = make_runs(60000, run_length[0], 1);
+      const std::vector<int> rhs_keys = make_runs(45000, run_length[1], 2);
+
+      // the values record the input and the position that every key comes from
+      std::vector<int> lhs_values(lhs_keys.size());
+      std::vector<int> rhs_values(rhs_keys.size());
+      std::vector<std::pair<int, int>> lhs(lhs_keys.size());
+      std::vector<std::pair<int, int>> rhs(rhs_keys.size());
+      for (size_t i = 0; i < lhs.size(); ++i)
+      {
+        lhs_values[i] = static_cast<int>(i);
+        lhs[i]        = {lhs_keys[i], lhs_values[i]};
+      }
+      for (size_t i = 0; i < rhs.size(); ++i)
+      {
+        rhs_values[i] = -1 - static_cast<int>(i);
+        rhs[i]        = {rhs_keys[i], rhs_values[i]};
+      }
+
+      std::vector<std::pair<int, int>> ref(lhs.size() + rhs.size());
+      std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ref.begin(), [](const auto& a, const auto& b) {
+        return tens_less{}(a.first, b.first);
+      });
+      std::vector<int> ref_keys(ref.size());
+      std::vector<int> ref_values(ref.size());
+      for (size_t i = 0; i < ref.size(); ++i)
+      {
+        ref_keys[i]   = ref[i].first;
+        ref_values[i] = ref[i].second;
+      }
+
+      std::vector<int> keys_result(ref.size());
+      std::vector<int> values_result(ref.size());
+      const auto ends = thrust::merge_by_key(
+        thrust::omp::par,
+        lhs_keys.begin(),
+        lhs_keys.end(),
+        rhs_keys.begin(),
+        rhs_keys.end(),
+        lhs_values.begin(),
+        rhs_values.begin(),
+        keys_result.begin(),
+        values_result.begin(),
+        tens_less{});
+
+      ASSERT_EQUAL(ends.first - keys_result.begin(), static_cast<std::ptrdiff_t>(ref.size()));
+      ASSERT_EQUAL(ends.second - values_result.begin(), static_cast<std::ptrdiff_t>(ref.size()));
+      ASSERT_EQUAL(keys_result, ref_keys);
+      ASSERT_EQUAL(values_result, ref_values);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpMergeByKeyStability);
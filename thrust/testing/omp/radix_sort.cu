@@ -0,0 +1,56 @@
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <algorithm>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// The radix sort asks for as many threads as the runtime allows, but a nested parallel region only provides one
+template <typename SortFunction>
+void TestOmpRadixSortNested(SortFunction sort)
+{
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  const size_t n = 200000;
+
+  bool ok[2] = {false, false};
+
+  THRUST_PRAGMA_OMP(parallel num_threads(2))
+  {
+    thrust::host_vector<int> keys = unittest::random_integers<int>(n);
+    thrust::host_vector<int> ref  = keys;
+    std::stable_sort(ref.begin(), ref.end());
+
+    sort(keys);
+
+    ok[omp_get_thread_num()] = keys == ref;
+  }
+
+  omp_set_num_threads(max_threads);
+
+  ASSERT_EQUAL(ok[0], true);
+  ASSERT_EQUAL(ok[1], true);
+}
+
+void TestOmpRadixSortNestedStableSort()
+{
+  TestOmpRadixSortNested([](thrust::host_vector<int>& keys) {
+    thrust::stable_sort(thrust::omp::par, keys.begin(), keys.end());
+  });
+}
+DECLARE_UNITTEST(TestOmpRadixSortNestedStableSort);
+
+void TestOmpRadixSortNestedStableSortByKey()
+{
+  TestOmpRadixSortNested([](thrust::host_vector<int>& keys) {
+    // the values equal the keys, so they end up sorted as well
+    thrust::host_vector<int> values = keys;
+    thrust::stable_sort_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin());
+    keys = values;
+  });
+}
+DECLARE_UNITTEST(TestOmpRadixSortNestedStableSortByKey);
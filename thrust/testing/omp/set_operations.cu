@@ -0,0 +1,121 @@
+#include <thrust/set_operations.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// Compares only the tens, so that the last digit of an output element tells which input it was taken from
+struct tens_less
+{
+  bool operator()(int a, int b) const
+  {
+    return a / 10 < b / 10;
+  }
+};
+
+// A sorted input of runs of run_length equivalent elements, which all end in tag
+std::vector<int> make_runs(int n, int run_length, int tag)
+{
+  std::vector<int> v(n);
+  for (int i = 0; i < n; ++i)
+  {
+    v[i] = (i / run_length) * 10 + tag;
+  }
+  return v;
+}
+
+// The partitions are only split between more than one thread
+class omp_num_threads_guard
+{
+  int m_max_threads;
+
+public:
+  explicit omp_num_threads_guard(int num_threads)
+      : m_max_threads(omp_get_max_threads())
+  {
+    omp_set_num_threads(num_threads);
+  }
+
+  ~omp_num_threads_guard()
+  {
+    omp_set_num_threads(m_max_threads);
+  }
+};
+
+// The set operations split their inputs into one partition per thread. The inputs are large enough for several
+// partitions, and their runs of equivalent elements have different lengths in both inputs, so that the splits between
+// the partitions fall inside runs, down to a single run that spans both inputs entirely
+template <typename SetOperation, typename ReferenceOperation>
+void TestOmpSetOperationPartitions(SetOperation set_op, ReferenceOperation ref_op)
+{
+  const int run_lengths[][2] = {{7, 3}, {1, 5}, {60000, 45000}};
+
+  for (int num_threads : {2, 3, 4, 7, 8})
+  {
+    for (const auto& run_length : run_lengths)
+    {
+      const std::vector<int> lhs = make_runs(60000, run_length[0], 1);
+      const std::vector<int> rhs = make_runs(45000, run_length[1], 2);
+
+      std::vector<int> ref(lhs.size() + rhs.size());
+      ref.erase(ref_op(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), ref.begin(), tens_less{}), ref.end());
+
+      omp_num_threads_guard guard(num_threads);
+      std::vector<int> result(lhs.size() + rhs.size());
+      result.erase(set_op(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin(), tens_less{}), result.end());
+
+      ASSERT_EQUAL(result, ref);
+    }
+  }
+}
+
+void TestOmpSetDifferencePartitions()
+{
+  TestOmpSetOperationPartitions(
+    [](auto... args) {
+      return thrust::set_difference(thrust::omp::par, args...);
+    },
+    [](auto... args) {
+      return std::set_difference(args...);
+    });
+}
+DECLARE_UNITTEST(TestOmpSetDifferencePartitions);
+
+void TestOmpSetIntersectionPartitions()
+{
+  TestOmpSetOperationPartitions(
+    [](auto... args) {
+      return thrust::set_intersection(thrust::omp::par, args...);
+    },
+    [](auto... args) {
+      return std::set_intersection(args...);
+    });
+}
+DECLARE_UNITTEST(TestOmpSetIntersectionPartitions);
+
+void TestOmpSetSymmetricDifferencePartitions()
+{
+  TestOmpSetOperationPartitions(
+    [](auto... args) {
+      return thrust::set_symmetric_difference(thrust::omp::par, args...);
+    },
+    [](auto... args) {
+      return std::set_symmetric_difference(args...);
+    });
+}
+DECLARE_UNITTEST(TestOmpSetSymmetricDifferencePartitions);
+
+void TestOmpSetUnionPartitions()
+{
+  TestOmpSetOperationPartitions(
+    [](auto... args) {
+      return thrust::set_union(thrust::omp::par, args...);
+    },
+    [](auto... args) {
+      return std::set_union(args...);
+    });
+}
+DECLARE_UNITTEST(TestOmpSetUnionPartitions);
@@ -0,0 +1,170 @@
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// Not default constructible, and not a primitive key, so it is sorted by the merge levels
+struct labeled_key
+{
+  int value;
+  std::string label;
+
+  explicit labeled_key(int value)
+      : value(value)
+      , label(std::to_string(value))
+  {}
+
+  bool operator==(const labeled_key& other) const
+  {
+    return value == other.value && label == other.label;
+  }
+};
+
+struct labeled_key_less
+{
+  bool operator()(const labeled_key& a, const labeled_key& b) const
+  {
+    return a.value < b.value;
+  }
+};
+
+// Compares only the tens, so that many keys are equivalent and the order of equivalent keys shows stability
+struct tens_less
+{
+  bool operator()(int a, int b) const
+  {
+    return a / 10 < b / 10;
+  }
+};
+
+// The merge levels only run with more than one thread
+class omp_num_threads_guard
+{
+  int m_max_threads;
+
+public:
+  explicit omp_num_threads_guard(int num_threads)
+      : m_max_threads(omp_get_max_threads())
+  {
+    omp_set_num_threads(num_threads);
+  }
+
+  ~omp_num_threads_guard()
+  {
+    omp_set_num_threads(m_max_threads);
+  }
+};
+
+void TestOmpStableSortNotDefaultConstructible()
+{
+  omp_num_threads_guard guard(4);
+
+  std::vector<labeled_key> keys;
+  for (int i = 0; i < 10000; ++i)
+  {
+    keys.emplace_back((i * 7919) % 1000);
+  }
+  std::vector<labeled_key> ref = keys;
+  std::stable_sort(ref.begin(), ref.end(), labeled_key_less{});
+
+  thrust::stable_sort(thrust::omp::par, keys.begin(), keys.end(), labeled_key_less{});
+
+  ASSERT_EQUAL(keys == ref, true);
+}
+DECLARE_UNITTEST(TestOmpStableSortNotDefaultConstructible);
+
+void TestOmpStableSortByKeyNotDefaultConstructible()
+{
+  omp_num_threads_guard guard(4);
+
+  std::vector<labeled_key> keys;
+  std::vector<labeled_key> values;
+  std::vector<std::pair<labeled_key, labeled_key>> ref;
+  for (int i = 0; i < 10000; ++i)
+  {
+    keys.emplace_back((i * 7919) % 1000);
+    values.emplace_back(i);
+    ref.emplace_back(keys.back(), values.back());
+  }
+  std::stable_sort(ref.begin(), ref.end(), [](const auto& a, const auto& b) {
+    return a.first.value < b.first.value;
+  });
+
+  thrust::stable_sort_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(), labeled_key_less{});
+
+  bool equal = true;
+  for (std::size_t i = 0; i < ref.size(); ++i)
+  {
+    equal = equal && keys[i] == ref[i].first && values[i] == ref[i].second;
+  }
+  ASSERT_EQUAL(equal, true);
+}
+DECLARE_UNITTEST(TestOmpStableSortByKeyNotDefaultConstructible);
+
+// Thread counts that do and do not divide the sizes evenly, so that the tiles and the shares of every merge level
+// split runs of equivalent keys at arbitrary positions, and sizes that take an odd number of merge levels
+void TestOmpStableSortMergeLevels()
+{
+  for (int num_threads : {2, 3, 4, 7, 8})
+  {
+    omp_num_threads_guard guard(num_threads);
+
+    for (int n : {1, 2, 7, 1000, 12345})
+    {
+      std::vector<int> keys(n);
+      for (int i = 0; i < n; ++i)
+      {
+        keys[i] = (i * 7919) % 500;
+      }
+      std::vector<int> ref = keys;
+      std::stable_sort(ref.begin(), ref.end(), tens_less{});
+
+      thrust::stable_sort(thrust::omp::par, keys.begin(), keys.end(), tens_less{});
+
+      ASSERT_EQUAL(keys, ref);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpStableSortMergeLevels);
+
+void TestOmpStableSortByKeyMergeLevels()
+{
+  for (int num_threads : {2, 3, 4, 7, 8})
+  {
+    omp_num_threads_guard guard(num_threads);
+
+    for (int n : {1, 2, 7, 1000, 12345})
+    {
+      std::vector<int> keys(n);
+      std::vector<int> values(n);
+      for (int i = 0; i < n; ++i)
+      {
+        keys[i]   = (i * 7919) % 500;
+        values[i] = i;
+      }
+
+      // the values record the input positions, so equivalent keys must keep their values in increasing order
+      std::vector<int> ref_values = values;
+      std::stable_sort(ref_values.begin(), ref_values.end(), [&](int a, int b) {
+        return tens_less{}(keys[a], keys[b]);
+      });
+      std::vector<int> ref_keys(n);
+      for (int i = 0; i < n; ++i)
+      {
+        ref_keys[i] = keys[ref_values[i]];
+      }
+
+      thrust::stable_sort_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(), tens_less{});
+
+      ASSERT_EQUAL(keys, ref_keys);
+      ASSERT_EQUAL(values, ref_values);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpStableSortByKeyMergeLevels);
@@ -3,8 +3,11 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/partition.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 #include <unittest/unittest.h>
 
 #if _CCCL_COMPILER(GCC, >=, 11) && _CCCL_COMPILER(GCC, <, 12)
@@ -653,6 +656,84 @@ struct TestStablePartitionCopy
 };
 VariableUnitTest<TestStablePartitionCopy, PartitionTypes> TestStablePartitionCopyInstance;
 
+template <bool Selected>
+struct select_all
+{
+  _CCCL_HOST_DEVICE bool operator()(int) const
+  {
+    return Selected;
+  }
+};
+
+// The parallel host backends partition every chunk independently and offset the output of a chunk by the number of
+// elements selected in the chunks in front of it. The sizes span several chunks, and the predicates select every
+// element, none, or every other one, so that both outputs straddle the chunk boundaries.
+template <typename Predicate>
+void TestStablePartitionCopyChunksHelper(Predicate pred)
+{
+  for (int n : {1023, 1025, 3000, 100003})
+  {
+    thrust::host_vector<int> h_data(n);
+    thrust::sequence(h_data.begin(), h_data.end());
+    thrust::device_vector<int> d_data = h_data;
+
+    thrust::host_vector<int> h_true_ref(n);
+    thrust::host_vector<int> h_false_ref(n);
+    const auto h_ends =
+      std::partition_copy(h_data.begin(), h_data.end(), h_true_ref.begin(), h_false_ref.begin(), pred);
+    h_true_ref.erase(h_ends.first, h_true_ref.end());
+    h_false_ref.erase(h_ends.second, h_false_ref.end());
+
+    thrust::device_vector<int> d_true_results(n, -1);
+    thrust::device_vector<int> d_false_results(n, -1);
+    const auto d_ends = thrust::stable_partition_copy(
+      d_data.begin(), d_data.end(), d_true_results.begin(), d_false_results.begin(), pred);
+    d_true_results.erase(d_ends.first, d_true_results.end());
+    d_false_results.erase(d_ends.second, d_false_results.end());
+
+    ASSERT_EQUAL(d_true_results, h_true_ref);
+    ASSERT_EQUAL(d_false_results, h_false_ref);
+  }
+}
+
+void TestStablePartitionCopyChunks()
+{
+  TestStablePartitionCopyChunksHelper(select_all<true>{});
+  TestStablePartitionCopyChunksHelper(select_all<false>{});
+  TestStablePartitionCopyChunksHelper(is_even<int>{});
+}
+DECLARE_UNITTEST(TestStablePartitionCopyChunks);
+
+// GCC 11 miscompiles and segfaults in this tests.
+#ifndef WAIVE_GCC11_FAILURES
+
+template <typename Predicate>
+void TestStablePartitionChunksHelper(Predicate pred)
+{
+  for (int n : {1023, 1025, 3000, 100003})
+  {
+    thrust::host_vector<int> h_data(n);
+    thrust::sequence(h_data.begin(), h_data.end());
+    thrust::device_vector<int> d_data = h_data;
+
+    const auto h_middle = std::stable_partition(h_data.begin(), h_data.end(), pred);
+    const auto d_middle = thrust::stable_partition(d_data.begin(), d_data.end(), pred);
+
+    ASSERT_EQUAL(d_data, h_data);
+    ASSERT_EQUAL(d_middle - d_data.begin(), h_middle - h_data.begin());
+  }
+}
+
+void TestStablePartitionChunks()
+{
+  TestStablePartitionChunksHelper(select_all<true>{});
+  TestStablePartitionChunksHelper(select_all<false>{});
+  TestStablePartitionChunksHelper(is_even<int>{});
+}
+DECLARE_UNITTEST(TestStablePartitionChunks);
+
+#endif // WAIVE_GCC11_FAILURES
+
 template <typename T>
 struct TestStablePartitionCopyToDiscardIterator
 {
@@ -1,6 +1,7 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/reduce.h>
+#include <thrust/sequence.h>
 #include <thrust/unique.h>
 
 #include <unittest/unittest.h>
@@ -240,3 +241,81 @@ void TestReduceByKeyDispatchImplicit()
   ASSERT_EQUAL(13, vec.front());
 }
 DECLARE_UNITTEST(TestReduceByKeyDispatchImplicit);
+
+// Keeps the first value, which is associative but not commutative, so that the parts of a run that the parallel
+// backends reduce in different chunks must be combined in input order
+struct take_first
+{
+  _CCCL_HOST_DEVICE long long operator()(long long a, long long) const
+  {
+    return a;
+  }
+};
+
+template <typename BinaryFunction>
+void TestReduceByKeyRunsHelper(const thrust::host_vector<int>& h_keys, BinaryFunction binary_op)
+{
+  const int n = static_cast<int>(h_keys.size());
+
+  thrust::host_vector<int> h_keys_ref;
+  thrust::host_vector<long long> h_values_ref;
+  for (int i = 0; i < n; ++i)
+  {
+    if (i == 0 || h_keys[i] != h_keys[i - 1])
+    {
+      h_keys_ref.push_back(h_keys[i]);
+      h_values_ref.push_back(i);
+    }
+    else
+    {
+      h_values_ref.back() = binary_op(h_values_ref.back(), static_cast<long long>(i));
+    }
+  }
+
+  thrust::device_vector<int> d_keys = h_keys;
+  thrust::device_vector<long long> d_values(n);
+  thrust::sequence(d_values.begin(), d_values.end());
+
+  thrust::device_vector<int> d_keys_output(n);
+  thrust::device_vector<long long> d_values_output(n);
+  const auto ends = thrust::reduce_by_key(
+    d_keys.begin(),
+    d_keys.end(),
+    d_values.begin(),
+    d_keys_output.begin(),
+    d_values_output.begin(),
+    ::cuda::std::equal_to<int>{},
+    binary_op);
+  d_keys_output.erase(ends.first, d_keys_output.end());
+  d_values_output.erase(ends.second, d_values_output.end());
+
+  ASSERT_EQUAL(d_keys_output, h_keys_ref);
+  ASSERT_EQUAL(d_values_output, h_values_ref);
+}
+
+// The parallel backends reduce one chunk of a few thousand elements per thread, and combine the parts of the runs of
+// equal keys that straddle the chunk boundaries
+void TestReduceByKeyRunsAcrossChunks()
+{
+  const int n = 100003;
+
+  thrust::host_vector<int> h_keys(n);
+  for (int run_length : {1, 4095, 4097, 5000, 33333, n})
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      h_keys[i] = i / run_length;
+    }
+    TestReduceByKeyRunsHelper(h_keys, ::cuda::std::plus<long long>{});
+    TestReduceByKeyRunsHelper(h_keys, take_first{});
+  }
+
+  // a run that covers every chunk but the first and the last elements
+  for (int i = 0; i < n; ++i)
+  {
+    h_keys[i] = i < 10 ? 0 : i < n - 10 ? 1 : 2;
+  }
+  TestReduceByKeyRunsHelper(h_keys, ::cuda::std::plus<long long>{});
+  TestReduceByKeyRunsHelper(h_keys, take_first{});
+}
+DECLARE_UNITTEST(TestReduceByKeyRunsAcrossChunks);
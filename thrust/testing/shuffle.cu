@@ -7,10 +7,13 @@
 #include <thrust/sequence.h>
 #include <thrust/shuffle.h>
 #include <thrust/sort.h>
+#include <thrust/system/cpp/detail/shuffle.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
+#include <vector>
 
 #include <unittest/unittest.h>
 
@@ -123,9 +126,12 @@ void TestHostDeviceIdenticalBase(size_t m)
   ASSERT_EQUAL(device_result, host_result);
 }
 template <typename T>
-void TestHostDeviceIdentical(size_t m)
+void TestHostDeviceIdentical([[maybe_unused]] size_t m)
 {
+  // The host systems shuffle with their own algorithm, so CUDA gives a different permutation for the same seed
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
   TestHostDeviceIdenticalBase<thrust_shuffle, T>(m);
+#endif // THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
 }
 template <typename T>
 void TestHostDeviceIdenticalIterator(size_t m)
@@ -135,6 +141,116 @@ void TestHostDeviceIdenticalIterator(size_t m)
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdentical);
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdenticalIterator);
 
+// Sizes that are split into several chunks and buckets on the host
+template <typename Vector>
+void TestShuffleDeterministic()
+{
+  using T = typename Vector::value_type;
+  for (size_t m : {size_t{100000}, size_t{1} << 20})
+  {
+    Vector first(m);
+    thrust::sequence(first.begin(), first.end(), T{});
+    Vector second = first;
+
+    thrust::default_random_engine g(183);
+    thrust::shuffle(first.begin(), first.end(), g);
+    g.seed(183);
+    thrust::shuffle(second.begin(), second.end(), g);
+    ASSERT_EQUAL(first, second);
+
+    // Narrow types wrap around, so compare the sorted sequences
+    Vector sequence(m);
+    thrust::sequence(sequence.begin(), sequence.end(), T{});
+    thrust::sort(sequence.begin(), sequence.end());
+    thrust::sort(first.begin(), first.end());
+    ASSERT_EQUAL(first, sequence);
+  }
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestShuffleDeterministic);
+
+// Pearson's chi-squared statistic of the number of elements that move from every region of the input to every region
+// of the output. For a uniformly random permutation of a sequence, the regions of both are independent.
+double RegionChiSquared(const thrust::host_vector<uint32_t>& shuffled, size_t regions)
+{
+  const size_t n = shuffled.size();
+  std::vector<double> counts(regions * regions);
+  for (size_t i = 0; i < n; ++i)
+  {
+    counts[shuffled[i] * regions / n * regions + i * regions / n] += 1.0;
+  }
+  std::vector<double> input_counts(regions);
+  std::vector<double> output_counts(regions);
+  for (size_t i = 0; i < regions; ++i)
+  {
+    for (size_t j = 0; j < regions; ++j)
+    {
+      input_counts[i] += counts[i * regions + j];
+      output_counts[j] += counts[i * regions + j];
+    }
+  }
+  double chi_squared = 0.0;
+  for (size_t i = 0; i < regions; ++i)
+  {
+    for (size_t j = 0; j < regions; ++j)
+    {
+      const double expected = input_counts[i] * output_counts[j] / n;
+      chi_squared += std::pow(counts[i * regions + j] - expected, 2) / expected;
+    }
+  }
+  return chi_squared;
+}
+
+// Critical value of the chi-squared distribution with 99.9% confidence, in the normal approximation for many degrees of
+// freedom
+double RegionChiSquaredCriticalValue(size_t regions)
+{
+  const double dof = static_cast<double>((regions - 1) * (regions - 1));
+  return dof + 3.09 * std::sqrt(2.0 * dof);
+}
+
+// Sizes with several buckets on the host, whose elements have to move between buckets and within them
+void TestShuffleMultipleBucketsUniform()
+{
+  const size_t regions = 32;
+  for (size_t m : {size_t{1} << 18, size_t{300001}})
+  {
+    thrust::host_vector<uint32_t> shuffled(m);
+    thrust::sequence(shuffled.begin(), shuffled.end(), uint32_t{0});
+    thrust::default_random_engine g(0xD5);
+    thrust::shuffle(shuffled.begin(), shuffled.end(), g);
+
+    ASSERT_LESS(RegionChiSquared(shuffled, regions), RegionChiSquaredCriticalValue(regions));
+
+    thrust::sort(shuffled.begin(), shuffled.end());
+    thrust::host_vector<uint32_t> sequence(m);
+    thrust::sequence(sequence.begin(), sequence.end(), uint32_t{0});
+    ASSERT_EQUAL(shuffled, sequence);
+  }
+}
+DECLARE_UNITTEST(TestShuffleMultipleBucketsUniform);
+
+// Buckets get too large to be shuffled in cache beyond 2^29 elements, then they are scattered again. Test that level
+// on its own, since the inputs that reach it are too large for a unit test.
+void TestShuffleLargeBucketUniform()
+{
+  namespace detail     = thrust::system::cpp::detail::shuffle_detail;
+  const size_t regions = 32;
+  const size_t m       = detail::max_bucket_size + 7;
+
+  thrust::host_vector<uint32_t> shuffled(m);
+  thrust::sequence(shuffled.begin(), shuffled.end(), uint32_t{0});
+  detail::random_source source(detail::key_sequence{{0xD5, 0x183}}, 0);
+  detail::shuffle_bucket<uint32_t*, uint32_t>(source, thrust::raw_pointer_cast(shuffled.data()), m);
+
+  ASSERT_LESS(RegionChiSquared(shuffled, regions), RegionChiSquaredCriticalValue(regions));
+
+  thrust::sort(shuffled.begin(), shuffled.end());
+  thrust::host_vector<uint32_t> sequence(m);
+  thrust::sequence(sequence.begin(), sequence.end(), uint32_t{0});
+  ASSERT_EQUAL(shuffled, sequence);
+}
+DECLARE_UNITTEST(TestShuffleLargeBucketUniform);
+
 template <typename BijectionFunc, typename T>
 void TestFunctionIsBijectionBase(size_t m)
 {
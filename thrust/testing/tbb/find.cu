@@ -0,0 +1,36 @@
+#include <thrust/find.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <vector>
+
+#include <tbb/task_arena.h>
+#include <unittest/unittest.h>
+
+// The search launches one worker per thread of the arena of the caller, and every worker claims chunks of a few
+// thousand elements, so that the matches below are found by different workers
+void TestTbbFindArena()
+{
+  const int n = 10 * 4096 + 123;
+
+  std::vector<int> data(n, 0);
+  data[9 * 4096 + 3] = 1;
+  data[2 * 4096 + 5] = 1;
+  data[n - 1]        = 1;
+
+  for (int num_threads : {1, 2, 3, 4, 7, 8})
+  {
+    ::tbb::task_arena arena(num_threads);
+
+    std::vector<int>::iterator result;
+    arena.execute([&] {
+      result = thrust::find(thrust::tbb::par, data.begin(), data.end(), 1);
+    });
+    ASSERT_EQUAL(result - data.begin(), 2 * 4096 + 5);
+
+    arena.execute([&] {
+      result = thrust::find(thrust::tbb::par, data.begin(), data.end(), 2);
+    });
+    ASSERT_EQUAL(result - data.begin(), n);
+  }
+}
+DECLARE_UNITTEST(TestTbbFindArena);
@@ -20,6 +20,8 @@
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__memory/allocator_traits.h>
 #include <cuda/std/__type_traits/is_swappable.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
 #include <cuda/std/__utility/move.h>
 #include <cuda/std/__utility/swap.h>
 
@@ -37,6 +39,16 @@ struct allocator_mismatch_on_swap : std::runtime_error
   {}
 };
 
+template <class Alloc, class = void>
+inline constexpr bool has_member_expand = false;
+template <class Alloc>
+inline constexpr bool has_member_expand<
+  Alloc,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<Alloc&>().expand(
+    ::cuda::std::declval<typename ::cuda::std::allocator_traits<Alloc>::pointer&>(),
+    ::cuda::std::declval<typename ::cuda::std::allocator_traits<Alloc>::size_type>(),
+    ::cuda::std::declval<typename ::cuda::std::allocator_traits<Alloc>::size_type>()))>> = true;
+
 // XXX parameter T is redundant with parameter Alloc
 template <typename T, typename Alloc>
 class contiguous_storage
@@ -101,6 +113,10 @@ public:
 
   _CCCL_HOST_DEVICE void deallocate() noexcept;
 
+  // grows the storage to n elements without copying them, when the allocator has an expand member and the elements
+  // may be moved bitwise; returns false when it cannot, and the storage is unchanged
+  _CCCL_HOST bool try_expand(size_type n);
+
 private:
   static constexpr bool is_swap_noexcept()
   {
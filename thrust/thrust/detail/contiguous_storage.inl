@@ -18,6 +18,7 @@
 #include <thrust/detail/allocator/fill_construct_range.h>
 #include <thrust/detail/allocator/value_initialize_range.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #include <cuda/std/__host_stdlib/stdexcept>
 #include <cuda/std/__utility/move.h>
@@ -168,6 +169,22 @@ _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::deallocate() noexcept
   } // end if
 } // end contiguous_storage::deallocate()
 
+template <typename T, typename Alloc>
+_CCCL_HOST bool contiguous_storage<T, Alloc>::try_expand([[maybe_unused]] size_type n)
+{
+  if constexpr (has_member_expand<Alloc> && thrust::is_trivially_relocatable_v<T>)
+  {
+    pointer p = m_begin.base();
+    if (size() > 0 && m_allocator.expand(p, size(), n))
+    {
+      m_begin = iterator(p);
+      m_size  = n;
+      return true;
+    }
+  }
+  return false;
+} // end contiguous_storage::try_expand()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::value_initialize_n(iterator first, size_type n)
 {
@@ -21,6 +21,7 @@
 #include <thrust/equal.h>
 #include <thrust/fill.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #include <cuda/std/__algorithm/clamp.h>
 #include <cuda/std/__algorithm/max.h>
@@ -388,6 +389,12 @@ void vector_base<T, Alloc>::reserve(size_type n)
     // do not exceed maximum storage
     new_capacity = ::cuda::std::min<size_type>(new_capacity, max_size());
 
+    // grow the storage without copying the elements, when the allocator can
+    if (m_storage.try_expand(new_capacity))
+    {
+      return;
+    }
+
     // create new storage
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -768,6 +775,14 @@ void vector_base<T, Alloc>::copy_insert(iterator position, ForwardIterator first
         throw std::length_error("insert(): insertion exceeds max_size().");
       } // end if
 
+      // grow the storage without copying the elements, when the allocator can, and insert into it
+      const size_type offset = position - begin();
+      if (m_storage.try_expand(new_capacity))
+      {
+        copy_insert(begin() + offset, first, last);
+        return;
+      }
+
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
       // record how many constructors we invoke in the try block below
@@ -838,6 +853,13 @@ void vector_base<T, Alloc>::append(size_type n)
       // do not exceed maximum storage
       new_capacity = ::cuda::std::min<size_type>(new_capacity, max_size());
 
+      // grow the storage without copying the elements, when the allocator can, and append to it
+      if (m_storage.try_expand(new_capacity))
+      {
+        append<SkipInit>(n);
+        return;
+      }
+
       // create new storage
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -933,6 +955,19 @@ void vector_base<T, Alloc>::fill_insert(iterator position, size_type n, const T&
     const size_type new_capacity =
       ::cuda::std::clamp<size_type>(old_size + n, static_cast<size_type>(2 * capacity()), max_size());
 
+    // grow the storage without copying the elements, when the allocator can, and insert into it
+    if constexpr (thrust::is_trivially_relocatable_v<T>)
+    {
+      // x may refer to an element, which moves with the storage
+      const size_type offset = position - begin();
+      const T value          = x;
+      if (m_storage.try_expand(new_capacity))
+      {
+        fill_insert(begin() + offset, n, value);
+        return;
+      }
+    }
+
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
     iterator new_end = new_storage.begin();
@@ -21,6 +21,7 @@
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/device_memory_resource.h>
 
+#include <cuda/std/__memory/pointer_traits.h>
 #include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
@@ -78,6 +79,17 @@ public:
     m_upstream->do_deallocate(upstream_ptr(p.get()), bytes, alignment);
   }
 
+  _CCCL_HOST bool do_expand(pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment) override
+  {
+    upstream_ptr upstream_p(p.get());
+    if (!m_upstream->do_expand(upstream_p, bytes, new_bytes, alignment))
+    {
+      return false;
+    }
+    p = pointer(::cuda::std::to_address(upstream_p));
+    return true;
+  }
+
 private:
   Upstream* m_upstream;
 };
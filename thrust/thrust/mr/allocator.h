@@ -129,6 +129,25 @@ public:
     return mem_res->do_deallocate(p, n * sizeof(T), alignof(T));
   }
 
+  /*! Tries to grow storage for objects of type \p T without copying them, which may move them bitwise to a new
+   *      address. Only meant for types that are trivially relocatable.
+   *
+   *  \param p pointer returned by a previous call to \p allocate, updated to the new address of the storage on success
+   *  \param n number of elements, passed as an argument to the \p allocate call that produced \p p
+   *  \param new_n number of elements to grow the storage to, which must be passed to \p deallocate afterwards
+   *  \return whether the storage was grown.
+   */
+  _CCCL_HOST bool expand(pointer& p, size_type n, size_type new_n)
+  {
+    void_pointer vp = p;
+    if (!mem_res->do_expand(vp, n * sizeof(T), new_n * sizeof(T), alignof(T)))
+    {
+      return false;
+    }
+    p = static_cast<pointer>(vp);
+    return true;
+  }
+
   /*! Extracts the memory resource used by this allocator.
    *
    *  \return the memory resource used by this allocator.
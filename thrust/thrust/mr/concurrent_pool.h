@@ -0,0 +1,543 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A pooling memory resource adaptor which can be used concurrently from many threads, with per-thread caches
+ *  of free blocks that exchange memory with a central store in batches.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/detail/thread_registry.h>
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_statistics.h>
+#include <thrust/mr/validator.h>
+
+#include <cuda/__memory/is_valid_alignment.h>
+#include <cuda/std/__host_stdlib/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor allowing for pooling and caching allocations from \p Upstream, which can be used from
+ *      many threads at the same time without serializing them.
+ *
+ *  Requests are rounded up to a size class, like in \p unsynchronized_pool_resource. Every thread keeps a private
+ *      cache of free blocks for each block size, which serves allocations and deallocations without any locking.
+ *      When the cache of a thread runs empty, it takes a whole batch of free blocks from a central store for that block
+ *      size; when it grows too large, it hands a batch back. Only these batch transfers, which happen once for a number
+ *      of allocations, and the allocation of new chunks from upstream take a lock. Blocks can be deallocated by any
+ *      thread, not only the one that allocated them. When a thread exits, its cached blocks return to the central
+ *      store.
+ *
+ *  Oversized and overaligned requests are rare and large, so they are forwarded to an internal
+ *      \p disjoint_unsynchronized_pool_resource under a mutex, which caches them according to
+ *      \p pool_options::cache_oversized.
+ *
+ *  All bookkeeping lives in host memory outside of the pooled memory, so memory allocated from \p Upstream is never
+ *      accessed by the pool and does not need to be accessible from the host. \p Upstream itself does not need to be
+ *      thread safe, because every call to it is serialized.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template <typename Upstream>
+class concurrent_pool_resource final
+    : public memory_resource<typename Upstream::pointer>
+    , private validator<Upstream>
+{
+  using void_ptr        = typename Upstream::pointer;
+  using void_ptr_traits = ::cuda::std::pointer_traits<void_ptr>;
+  using char_ptr        = typename void_ptr_traits::template rebind<char>;
+  using oversized_pool  = disjoint_unsynchronized_pool_resource<Upstream, new_delete_resource>;
+  using lock_t          = std::lock_guard<std::mutex>; // NOLINT(modernize-use-scoped-lock)
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return oversized_pool::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  concurrent_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : m_upstream(upstream)
+      , m_options(options)
+      , m_size_classes(m_options)
+      , m_id(detail::next_resource_id())
+      , m_central(std::make_shared<central_store>(m_size_classes.count()))
+      , m_oversized(upstream, get_global_resource<new_delete_resource>(), options)
+  {
+    assert(m_options.validate());
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  concurrent_pool_resource(pool_options options = get_default_options())
+      : concurrent_pool_resource(get_global_resource<Upstream>(), options)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~concurrent_pool_resource() override
+  {
+    release();
+  }
+
+  /*! Returns statistics about the use of the pool and of its upstream resource. The counters of every thread are read
+   *      without stopping the threads that use the pool, so the statistics are only consistent while no thread does.
+   */
+  pool_statistics statistics()
+  {
+    pool_statistics ret;
+    {
+      lock_t lock(m_upstream_mutex); // NOLINT(modernize-use-scoped-lock)
+      ret = m_oversized.statistics();
+      ret.upstream_allocations += m_upstream_allocations;
+      ret.upstream_deallocations += m_upstream_deallocations;
+      ret.upstream_bytes += m_chunk_bytes;
+      ret.peak_upstream_bytes = m_peak_upstream_bytes;
+    }
+
+    ret.size_classes.assign(m_central->num_classes, pool_size_class_statistics());
+    for (std::size_t i = 0; i < m_central->num_classes; ++i)
+    {
+      size_class& cls = m_central->classes[i];
+      lock_t lock(cls.mutex); // NOLINT(modernize-use-scoped-lock)
+      ret.size_classes[i].block_size    = m_size_classes.block_size(i);
+      ret.size_classes[i].deallocations = cls.released_blocks;
+      ret.size_classes[i].chunks        = cls.chunks;
+      ret.size_classes[i].blocks        = cls.blocks;
+    }
+
+    lock_t lock(m_central->counters_mutex); // NOLINT(modernize-use-scoped-lock)
+    std::size_t bytes_allocated   = m_central->retired.bytes_allocated.load();
+    std::size_t bytes_deallocated = m_central->retired.bytes_deallocated.load() + m_central->released_bytes;
+    for (std::size_t i = 0; i < m_central->num_classes; ++i)
+    {
+      ret.size_classes[i].allocations += m_central->retired.allocations[i].load();
+      ret.size_classes[i].deallocations += m_central->retired.deallocations[i].load();
+    }
+    for (const auto& counters : m_central->counters)
+    {
+      bytes_allocated += counters->bytes_allocated.load();
+      bytes_deallocated += counters->bytes_deallocated.load();
+      for (std::size_t i = 0; i < m_central->num_classes; ++i)
+      {
+        ret.size_classes[i].allocations += counters->allocations[i].load();
+        ret.size_classes[i].deallocations += counters->deallocations[i].load();
+      }
+    }
+
+    ret.bytes_in_use += bytes_allocated - bytes_deallocated;
+    for (const pool_size_class_statistics& cls : ret.size_classes)
+    {
+      ret.block_bytes_in_use += (cls.allocations - cls.deallocations) * cls.block_size;
+    }
+
+    return ret;
+  }
+
+  /*! Releases all held memory to upstream. Must not be called concurrently with any other use of the pool, and every
+   *      block allocated from the pool becomes invalid.
+   */
+  void release()
+  {
+    // blocks that are still allocated are gone, so count them as deallocated
+    const pool_statistics stats = statistics();
+
+    // the caches of all threads compare their epoch with this one and drop their blocks when they differ, so bump it
+    // before the central store is emptied
+    m_central->epoch.fetch_add(1, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < m_central->num_classes; ++i)
+    {
+      size_class& cls = m_central->classes[i];
+      lock_t class_lock(cls.mutex); // NOLINT(modernize-use-scoped-lock)
+      cls.batches.clear();
+      cls.previous_allocated_count = 0;
+      cls.released_blocks += stats.size_classes[i].allocations - stats.size_classes[i].deallocations;
+    }
+
+    {
+      lock_t lock(m_central->counters_mutex); // NOLINT(modernize-use-scoped-lock)
+      m_central->released_bytes += stats.bytes_in_use - m_oversized.statistics().bytes_in_use;
+    }
+
+    // refill takes the lock of a size class before the upstream lock, so take them in the same order here
+    lock_t lock(m_upstream_mutex); // NOLINT(modernize-use-scoped-lock)
+    for (const chunk& c : m_chunks)
+    {
+      m_upstream->do_deallocate(c.ptr, c.size, m_options.alignment);
+    }
+    m_upstream_deallocations += m_chunks.size();
+    m_chunk_bytes = 0;
+    m_chunks.clear();
+
+    m_oversized.release();
+  }
+
+  [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    assert(::cuda::__is_valid_alignment(alignment));
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_upstream_mutex); // NOLINT(modernize-use-scoped-lock)
+      void_ptr ret = m_oversized.do_allocate(bytes, alignment);
+      update_peak_upstream_bytes();
+      return ret;
+    }
+
+    const std::size_t class_idx   = m_size_classes.index((std::max) (bytes, m_options.smallest_block_size));
+    thread_cache& cache           = get_thread_cache();
+    std::vector<void_ptr>& blocks = cache.classes[class_idx];
+
+    if (blocks.empty())
+    {
+      refill(blocks, class_idx);
+    }
+
+    cache.counters->allocations[class_idx].add(1);
+    cache.counters->bytes_allocated.add(bytes);
+
+    void_ptr ret = blocks.back();
+    blocks.pop_back();
+    return ret;
+  }
+
+  void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    assert(::cuda::__is_valid_alignment(alignment));
+
+    // verify that the pointer is at least as aligned as claimed
+    assert(reinterpret_cast<::cuda::std::intmax_t>(::cuda::std::to_address(p)) % alignment == 0);
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_upstream_mutex); // NOLINT(modernize-use-scoped-lock)
+      m_oversized.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t class_idx   = m_size_classes.index((std::max) (n, m_options.smallest_block_size));
+    thread_cache& cache           = get_thread_cache();
+    std::vector<void_ptr>& blocks = cache.classes[class_idx];
+
+    cache.counters->deallocations[class_idx].add(1);
+    cache.counters->bytes_deallocated.add(n);
+
+    blocks.push_back(p);
+
+    // keep one batch in the cache so that alternating allocations and deallocations do not bounce batches
+    const std::size_t batch_size = blocks_per_batch(m_size_classes.block_size(class_idx));
+    if (blocks.size() >= 2 * batch_size)
+    {
+      std::vector<void_ptr> batch(blocks.end() - batch_size, blocks.end());
+      blocks.resize(blocks.size() - batch_size);
+
+      size_class& cls = m_central->classes[class_idx];
+      lock_t lock(cls.mutex); // NOLINT(modernize-use-scoped-lock)
+      cls.batches.push_back(std::move(batch));
+    }
+  }
+
+private:
+  // the number of blocks moved between a thread cache and the central store at once, about 64 KiB worth of blocks
+  static std::size_t blocks_per_batch(std::size_t block_size)
+  {
+    constexpr std::size_t batch_bytes    = static_cast<std::size_t>(1) << 16;
+    constexpr std::size_t max_batch_size = 64;
+    return (std::clamp) (batch_bytes / block_size, static_cast<std::size_t>(1), max_batch_size);
+  }
+
+  struct chunk
+  {
+    void_ptr ptr;
+    std::size_t size;
+  };
+
+  struct size_class
+  {
+    std::mutex mutex;
+    std::vector<std::vector<void_ptr>> batches;
+    std::size_t previous_allocated_count = 0;
+    std::size_t chunks                   = 0;
+    std::size_t blocks                   = 0;
+    std::size_t released_blocks          = 0;
+  };
+
+  // The allocations and deallocations of one thread, which only that thread counts
+  struct thread_counters
+  {
+    explicit thread_counters(std::size_t num_classes)
+        : allocations(new detail::single_writer_counter[num_classes])
+        , deallocations(new detail::single_writer_counter[num_classes])
+    {}
+
+    detail::single_writer_counter bytes_allocated;
+    detail::single_writer_counter bytes_deallocated;
+    std::unique_ptr<detail::single_writer_counter[]> allocations;
+    std::unique_ptr<detail::single_writer_counter[]> deallocations;
+  };
+
+  // Owned jointly by the pool and by the threads that use it, so that an exiting thread can give its cached blocks
+  // back even while the pool is being destroyed
+  struct central_store
+  {
+    explicit central_store(std::size_t num_classes)
+        : num_classes(num_classes)
+        , classes(new size_class[num_classes])
+        , retired(num_classes)
+    {}
+
+    std::size_t num_classes;
+    std::unique_ptr<size_class[]> classes;
+    std::atomic<std::uint64_t> epoch{0};
+
+    // the counters of the threads that use the pool, and the sum of those of the threads that exited, which are only
+    // changed while holding counters_mutex
+    std::mutex counters_mutex;
+    std::vector<std::unique_ptr<thread_counters>> counters;
+    thread_counters retired;
+    std::size_t released_bytes = 0;
+  };
+
+  struct thread_cache
+  {
+    std::uint64_t epoch;
+    std::weak_ptr<central_store> central;
+    std::vector<std::vector<void_ptr>> classes;
+    thread_counters* counters;
+
+    ~thread_cache()
+    {
+      flush();
+    }
+
+    bool expired() const
+    {
+      return central.expired();
+    }
+
+    // returns the cached blocks to the central store, unless the pool released its memory since they were cached, and
+    // adds the counters of the thread to those of the exited threads
+    void flush()
+    {
+      std::shared_ptr<central_store> store = central.lock();
+      if (!store)
+      {
+        return;
+      }
+
+      {
+        lock_t lock(store->counters_mutex); // NOLINT(modernize-use-scoped-lock)
+        store->retired.bytes_allocated.add(counters->bytes_allocated.load());
+        store->retired.bytes_deallocated.add(counters->bytes_deallocated.load());
+        for (std::size_t i = 0; i < store->num_classes; ++i)
+        {
+          store->retired.allocations[i].add(counters->allocations[i].load());
+          store->retired.deallocations[i].add(counters->deallocations[i].load());
+        }
+        store->counters.erase(std::find_if(store->counters.begin(),
+                                           store->counters.end(),
+                                           [this](const std::unique_ptr<thread_counters>& c) {
+                                             return c.get() == counters;
+                                           }));
+      }
+
+      for (std::size_t i = 0; i < classes.size(); ++i)
+      {
+        if (classes[i].empty())
+        {
+          continue;
+        }
+
+        size_class& cls = store->classes[i];
+        lock_t lock(cls.mutex); // NOLINT(modernize-use-scoped-lock)
+        if (store->epoch.load(std::memory_order_relaxed) == epoch)
+        {
+          cls.batches.push_back(std::move(classes[i]));
+        }
+      }
+      classes.clear();
+    }
+  };
+
+  thread_cache& get_thread_cache()
+  {
+    // the caches of this thread for all pools with this upstream type
+    static thread_local detail::thread_registry<thread_cache> registry;
+
+    thread_cache& cache = registry.get(m_id, [this] {
+      return make_thread_cache();
+    });
+
+    // the pool released its memory since this thread last used it
+    const std::uint64_t epoch = m_central->epoch.load(std::memory_order_relaxed);
+    if (cache.epoch != epoch)
+    {
+      for (auto& blocks : cache.classes)
+      {
+        blocks.clear();
+      }
+      cache.epoch = epoch;
+    }
+
+    return cache;
+  }
+
+  std::unique_ptr<thread_cache> make_thread_cache()
+  {
+    auto cache     = std::make_unique<thread_cache>();
+    cache->epoch   = m_central->epoch.load(std::memory_order_relaxed);
+    cache->central = m_central;
+    cache->classes.resize(m_central->num_classes);
+    {
+      lock_t lock(m_central->counters_mutex); // NOLINT(modernize-use-scoped-lock)
+      m_central->counters.push_back(std::make_unique<thread_counters>(m_central->num_classes));
+      cache->counters = m_central->counters.back().get();
+    }
+    return cache;
+  }
+
+  // fills an empty thread cache with a batch from the central store, or with a new chunk from upstream
+  void refill(std::vector<void_ptr>& blocks, std::size_t class_idx)
+  {
+    size_class& cls = m_central->classes[class_idx];
+    lock_t lock(cls.mutex); // NOLINT(modernize-use-scoped-lock)
+
+    if (!cls.batches.empty())
+    {
+      blocks.swap(cls.batches.back());
+      cls.batches.pop_back();
+      return;
+    }
+
+    const std::size_t block_size = m_size_classes.block_size(class_idx);
+
+    std::size_t n = cls.previous_allocated_count;
+    if (n == 0)
+    {
+      n = m_options.min_blocks_per_chunk;
+      if (n < m_options.min_bytes_per_chunk / block_size)
+      {
+        n = m_options.min_bytes_per_chunk / block_size;
+      }
+    }
+    else
+    {
+      n = n * 3 / 2;
+      if (n > m_options.max_bytes_per_chunk / block_size)
+      {
+        n = m_options.max_bytes_per_chunk / block_size;
+      }
+      if (n > m_options.max_blocks_per_chunk)
+      {
+        n = m_options.max_blocks_per_chunk;
+      }
+    }
+    n = (std::max) (n, static_cast<std::size_t>(1));
+
+    // block sizes are multiples of the alignment, so the blocks are all aligned within the chunk
+    const std::size_t chunk_size = block_size * n;
+
+    void_ptr allocated;
+    {
+      lock_t upstream_lock(m_upstream_mutex); // NOLINT(modernize-use-scoped-lock)
+      allocated = m_upstream->do_allocate(chunk_size, m_options.alignment);
+      m_chunks.push_back(chunk{allocated, chunk_size});
+      ++m_upstream_allocations;
+      m_chunk_bytes += chunk_size;
+      update_peak_upstream_bytes();
+    }
+
+    // only counted once the upstream allocation succeeded
+    cls.previous_allocated_count = n;
+    ++cls.chunks;
+    cls.blocks += n;
+
+    // the calling thread keeps one batch, the rest goes to the central store
+    const std::size_t batch_size = blocks_per_batch(block_size);
+    for (std::size_t first = 0; first < n; first += batch_size)
+    {
+      const std::size_t last = (std::min) (first + batch_size, n);
+
+      std::vector<void_ptr> batch;
+      batch.reserve(2 * batch_size);
+      for (std::size_t i = last; i-- > first;)
+      {
+        batch.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + block_size * i));
+      }
+
+      if (first == 0)
+      {
+        blocks.swap(batch);
+      }
+      else
+      {
+        cls.batches.push_back(std::move(batch));
+      }
+    }
+  }
+
+  Upstream* m_upstream;
+
+  pool_options m_options;
+  detail::pool_size_classes m_size_classes;
+  std::uint64_t m_id;
+
+  std::shared_ptr<central_store> m_central;
+
+  // serializes the calls to m_upstream, including those of m_oversized
+  std::mutex m_upstream_mutex;
+  std::vector<chunk> m_chunks;
+  oversized_pool m_oversized;
+  std::size_t m_upstream_allocations   = 0;
+  std::size_t m_upstream_deallocations = 0;
+  std::size_t m_chunk_bytes            = 0;
+  std::size_t m_peak_upstream_bytes    = 0;
+
+  // must be called while holding m_upstream_mutex
+  void update_peak_upstream_bytes()
+  {
+    m_peak_upstream_bytes = (std::max) (m_peak_upstream_bytes, m_chunk_bytes + m_oversized.statistics().upstream_bytes);
+  }
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief The state that every thread keeps for the memory resources it has used.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__host_stdlib/algorithm>
+#include <cuda/std/cstdint>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+namespace detail
+{
+// Resources are identified by a number that is never reused, so a thread cannot mistake a new resource for a destroyed
+// one that lived at the same address
+inline std::uint64_t next_resource_id()
+{
+  static std::atomic<std::uint64_t> id{0};
+  return id.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// The states of one thread for all resources of one type that the thread has used, to be kept in a thread_local
+// variable. The states are destroyed with the thread, or once their resource no longer exists, which State::expired()
+// tells.
+template <typename State>
+class thread_registry
+{
+  struct entry
+  {
+    std::uint64_t resource_id;
+    std::unique_ptr<State> state;
+  };
+
+  std::vector<entry> m_entries;
+  std::uint64_t m_last_id = 0;
+  State* m_last           = nullptr;
+
+public:
+  // Returns the state of the resource with the given id, which create() makes on the first use of the resource on this
+  // thread
+  template <typename Create>
+  State& get(std::uint64_t resource_id, Create&& create)
+  {
+    if (m_last_id == resource_id)
+    {
+      return *m_last;
+    }
+
+    auto it = std::find_if(m_entries.begin(), m_entries.end(), [resource_id](const entry& e) {
+      return e.resource_id == resource_id;
+    });
+    if (it == m_entries.end())
+    {
+      // first use of this resource on this thread; forget the states of resources that no longer exist
+      m_entries.erase(std::remove_if(m_entries.begin(),
+                                     m_entries.end(),
+                                     [](const entry& e) {
+                                       return e.state->expired();
+                                     }),
+                      m_entries.end());
+      m_entries.push_back({resource_id, create()});
+      it = m_entries.end() - 1;
+    }
+
+    m_last_id = resource_id;
+    m_last    = it->state.get();
+    return *m_last;
+  }
+};
+} // namespace detail
+} // namespace mr
+THRUST_NAMESPACE_END
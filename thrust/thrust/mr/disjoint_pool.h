@@ -20,15 +20,13 @@
 
 #include <thrust/detail/config.h>
 
-#include <thrust/binary_search.h>
-#include <thrust/detail/seq.h>
-#include <thrust/find.h>
 #include <thrust/host_vector.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_statistics.h>
 
-#include <cuda/__cmath/ilog.h>
+#include <cuda/__cmath/ceil_div.h>
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__algorithm/min.h>
@@ -36,6 +34,11 @@
 #include <cuda/std/cassert>
 #include <cuda/std/cstdint>
 
+#include <functional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
 THRUST_NAMESPACE_BEGIN
 namespace mr
 {
@@ -111,17 +114,21 @@ public:
       : m_upstream(upstream)
       , m_bookkeeper(bookkeeper)
       , m_options(options)
-      , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
+      , m_size_classes(m_options)
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
-      , m_cached_oversized(m_bookkeeper)
-      , m_oversized(m_bookkeeper)
+      , m_cached_oversized(cached_oversized_allocator(m_bookkeeper))
+      , m_oversized(0, pointer_hash(), std::equal_to<void_ptr>(), oversized_allocator(m_bookkeeper))
+      , m_statistics()
+      , m_release_trigger(m_options.release_threshold)
+      , m_deallocation_count(0)
+      , m_last_idle_check(0)
   {
     assert(m_options.validate());
 
     pointer_vector free(m_bookkeeper);
     pool p(free);
-    m_pools.resize(::cuda::ceil_ilog2(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+    m_pools.resize(m_size_classes.count(), p);
   }
 
   // TODO: C++11: use delegating constructors
@@ -134,17 +141,21 @@ public:
       : m_upstream(get_global_resource<Upstream>())
       , m_bookkeeper(get_global_resource<Bookkeeper>())
       , m_options(options)
-      , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
+      , m_size_classes(m_options)
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
-      , m_cached_oversized(m_bookkeeper)
-      , m_oversized(m_bookkeeper)
+      , m_cached_oversized(cached_oversized_allocator(m_bookkeeper))
+      , m_oversized(0, pointer_hash(), std::equal_to<void_ptr>(), oversized_allocator(m_bookkeeper))
+      , m_statistics()
+      , m_release_trigger(m_options.release_threshold)
+      , m_deallocation_count(0)
+      , m_last_idle_check(0)
   {
     assert(m_options.validate());
 
     pointer_vector free(m_bookkeeper);
     pool p(free);
-    m_pools.resize(::cuda::ceil_ilog2(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+    m_pools.resize(m_size_classes.count(), p);
   }
 
   /*! Destructor. Releases all held memory to upstream.
@@ -172,52 +183,39 @@ private:
     std::size_t size;
     std::size_t alignment;
     void_ptr pointer;
+    std::size_t cached_at;
 
-    _CCCL_HOST_DEVICE bool operator==(const oversized_block_descriptor& other) const
-    {
-      return size == other.size && alignment == other.alignment && pointer == other.pointer;
-    }
-
+    // best fit order: by size, then by alignment
     _CCCL_HOST_DEVICE bool operator<(const oversized_block_descriptor& other) const
     {
       return size < other.size || (size == other.size && alignment < other.alignment);
     }
   };
 
-  struct equal_pointers
+  // hashes pointers by their address, while they are still compared with their own operator==
+  struct pointer_hash
   {
-  public:
-    _CCCL_HOST_DEVICE equal_pointers(void_ptr p)
-        : p(p)
-    {}
-
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
+    std::size_t operator()(const void_ptr& p) const
     {
-      return desc.pointer == p;
+      return std::hash<const void*>()(::cuda::std::to_address(p));
     }
-
-  private:
-    void_ptr p;
   };
 
-  struct matching_alignment
-  {
-  public:
-    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested)
-        : requested(requested)
-    {}
+  // cached oversized/overaligned blocks ordered for best fit lookups
+  using cached_oversized_allocator = allocator<oversized_block_descriptor, Bookkeeper>;
+  using cached_oversized_set =
+    std::multiset<oversized_block_descriptor, std::less<oversized_block_descriptor>, cached_oversized_allocator>;
 
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
-    {
-      return desc.alignment >= requested;
-    }
-
-  private:
-    std::size_t requested;
-  };
+  // all oversized/overaligned allocations from upstream, by pointer
+  using oversized_allocator = allocator<std::pair<const void_ptr, oversized_block_descriptor>, Bookkeeper>;
+  using oversized_map       = std::unordered_map<void_ptr,
+                                                 oversized_block_descriptor,
+                                                 pointer_hash,
+                                                 std::equal_to<void_ptr>,
+                                                 oversized_allocator>;
 
-  using oversized_block_vector =
-    thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>;
+  using pointer_allocator = allocator<void_ptr, Bookkeeper>;
+  using pointer_set       = std::unordered_set<void_ptr, pointer_hash, std::equal_to<void_ptr>, pointer_allocator>;
 
   using pointer_vector = thrust::host_vector<void_ptr, allocator<void_ptr, Bookkeeper>>;
 
@@ -230,6 +228,11 @@ private:
     _CCCL_HOST pool(const pool& other)
         : free_blocks(other.free_blocks)
         , previous_allocated_count(other.previous_allocated_count)
+        , allocations(other.allocations)
+        , deallocations(other.deallocations)
+        , chunks(other.chunks)
+        , blocks(other.blocks)
+        , checked_allocations(other.checked_allocations)
     {}
 
     _CCCL_EXEC_CHECK_DISABLE
@@ -243,6 +246,12 @@ private:
 
     pointer_vector free_blocks{};
     std::size_t previous_allocated_count{};
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    std::size_t chunks{};
+    std::size_t blocks{};
+    // the number of allocations at the previous check for idle memory
+    std::size_t checked_allocations{};
   };
 
   using pool_vector = thrust::host_vector<pool, allocator<pool, Bookkeeper>>;
@@ -251,96 +260,239 @@ private:
   Bookkeeper* m_bookkeeper;
 
   pool_options m_options;
-  std::size_t m_smallest_block_log2;
+  detail::pool_size_classes m_size_classes;
 
   // buckets containing free lists for each pooled size
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
-  // list of all oversized/overaligned allocations from upstream
-  oversized_block_vector m_oversized;
+  // all cached oversized/overaligned blocks that have been returned to the pool to cache, ordered by size
+  cached_oversized_set m_cached_oversized;
+  // all oversized/overaligned allocations from upstream, by pointer
+  oversized_map m_oversized;
+  // everything but the size classes, which are counted in m_pools
+  pool_statistics m_statistics;
+
+  // the number of idle bytes above which a deallocation trims the pool
+  std::size_t m_release_trigger;
+  // the clock of the checks for idle memory
+  std::size_t m_deallocation_count;
+  std::size_t m_last_idle_check;
+
+  void_ptr allocate_upstream(std::size_t bytes, std::size_t alignment)
+  {
+    void_ptr p = m_upstream->do_allocate(bytes, alignment);
+
+    ++m_statistics.upstream_allocations;
+    m_statistics.upstream_bytes += bytes;
+    m_statistics.peak_upstream_bytes = (std::max) (m_statistics.peak_upstream_bytes, m_statistics.upstream_bytes);
+
+    return p;
+  }
+
+  void deallocate_upstream(void_ptr p, std::size_t bytes, std::size_t alignment)
+  {
+    m_upstream->do_deallocate(p, bytes, alignment);
+
+    ++m_statistics.upstream_deallocations;
+    m_statistics.upstream_bytes -= bytes;
+  }
+
+  // the number of bytes held from upstream that are not handed out
+  std::size_t idle_bytes() const
+  {
+    return m_statistics.upstream_bytes - m_statistics.block_bytes_in_use;
+  }
+
+  // returns cached oversized blocks and chunks with no blocks in use to upstream, until at most bytes_to_keep bytes
+  // are idle; if cold_only is true, only those blocks that were cached, and the chunks of those buckets that had no
+  // allocations, since the previous check for idle memory
+  std::size_t trim_impl(std::size_t bytes_to_keep, bool cold_only)
+  {
+    const std::size_t upstream_bytes = m_statistics.upstream_bytes;
+
+    // the largest cached blocks first
+    for (auto it = m_cached_oversized.end(); it != m_cached_oversized.begin() && idle_bytes() > bytes_to_keep;)
+    {
+      --it;
+      if (cold_only && (*it).cached_at >= m_last_idle_check)
+      {
+        continue;
+      }
+
+      const oversized_block_descriptor cached = *it;
+      it                                      = m_cached_oversized.erase(it);
+      m_oversized.erase(cached.pointer);
+      m_statistics.cached_oversized_bytes -= cached.size;
+      deallocate_upstream(cached.pointer, cached.size, cached.alignment);
+    }
+
+    if (idle_bytes() > bytes_to_keep)
+    {
+      trim_chunks(bytes_to_keep, cold_only);
+    }
+
+    return upstream_bytes - m_statistics.upstream_bytes;
+  }
+
+  void trim_chunks(std::size_t bytes_to_keep, bool cold_only)
+  {
+    // Index the free blocks, so that every block of a chunk is looked up in constant time
+    pointer_set free_blocks(0, pointer_hash(), std::equal_to<void_ptr>(), pointer_allocator(m_bookkeeper));
+    pointer_set released(0, pointer_hash(), std::equal_to<void_ptr>(), pointer_allocator(m_bookkeeper));
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      free_blocks.insert(m_pools[i].free_blocks.begin(), m_pools[i].free_blocks.end());
+    }
+
+    // Find unused chunks and deallocate them
+    std::size_t kept = 0;
+    for (std::size_t c = 0; c < m_allocated.size(); ++c)
+    {
+      const chunk_descriptor chunk = m_allocated[c];
+
+      const std::size_t bucket_size = m_size_classes.block_size(chunk.pool_idx);
+      const std::size_t n           = chunk.size / bucket_size;
+      assert(chunk.size % bucket_size == 0);
+
+      bool in_use = idle_bytes() <= bytes_to_keep
+                 || (cold_only && m_pools[chunk.pool_idx].allocations != m_pools[chunk.pool_idx].checked_allocations);
+      for (std::size_t i = 0; i < n && !in_use; ++i)
+      {
+        in_use = free_blocks.count(static_cast<void_ptr>(static_cast<char_ptr>(chunk.pointer) + i * bucket_size)) == 0;
+      }
+
+      if (in_use)
+      {
+        m_allocated[kept++] = chunk;
+        continue;
+      }
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        released.insert(static_cast<void_ptr>(static_cast<char_ptr>(chunk.pointer) + i * bucket_size));
+      }
+      deallocate_upstream(chunk.pointer, chunk.size, m_options.alignment);
+    }
+    m_allocated.resize(kept);
+
+    // Remove all free blocks cut from the deallocated chunks
+    if (!released.empty())
+    {
+      for (std::size_t i = 0; i < m_pools.size(); ++i)
+      {
+        pointer_vector& pool_blocks = m_pools[i].free_blocks;
+        pool_blocks.erase(std::remove_if(pool_blocks.begin(),
+                                         pool_blocks.end(),
+                                         [&](const void_ptr& block) {
+                                           return released.count(block) != 0;
+                                         }),
+                          pool_blocks.end());
+      }
+    }
+  }
+
+  // applies the release policy of the options after a deallocation
+  void release_idle_memory()
+  {
+    ++m_deallocation_count;
+
+    if (m_options.idle_release_interval != 0
+        && m_deallocation_count - m_last_idle_check >= m_options.idle_release_interval)
+    {
+      trim_impl(0, true);
+
+      for (std::size_t i = 0; i < m_pools.size(); ++i)
+      {
+        m_pools[i].checked_allocations = m_pools[i].allocations;
+      }
+      m_last_idle_check = m_deallocation_count;
+    }
+
+    if (idle_bytes() <= m_options.release_threshold)
+    {
+      m_release_trigger = m_options.release_threshold;
+    }
+    else if (idle_bytes() > m_release_trigger)
+    {
+      trim_impl(m_options.release_threshold, false);
+
+      // if memory in use keeps the pool above the threshold, wait for the idle memory to grow before trying again
+      const std::size_t idle = idle_bytes();
+      m_release_trigger      = (std::max) (m_options.release_threshold, idle + idle / 2);
+    }
+  }
 
 public:
+  /*! Returns statistics about the use of the pool and of its upstream resource. Memory allocated from the bookkeeping
+   *      resource is not included.
+   */
+  pool_statistics statistics() const
+  {
+    pool_statistics ret = m_statistics;
+
+    ret.size_classes.resize(m_pools.size());
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      ret.size_classes[i].block_size    = m_size_classes.block_size(i);
+      ret.size_classes[i].allocations   = m_pools[i].allocations;
+      ret.size_classes[i].deallocations = m_pools[i].deallocations;
+      ret.size_classes[i].chunks        = m_pools[i].chunks;
+      ret.size_classes[i].blocks        = m_pools[i].blocks;
+    }
+
+    return ret;
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
   {
-    // reset the buckets
+    // reset the buckets; blocks that are still allocated are gone, so count them as deallocated
     for (std::size_t i = 0; i < m_pools.size(); ++i)
     {
       m_pools[i].free_blocks.clear();
       m_pools[i].previous_allocated_count = 0;
+      m_pools[i].deallocations            = m_pools[i].allocations;
     }
+    m_statistics.bytes_in_use           = 0;
+    m_statistics.block_bytes_in_use     = 0;
+    m_statistics.cached_oversized_bytes = 0;
 
     // deallocate memory allocated for the buckets
     for (std::size_t i = 0; i < m_allocated.size(); ++i)
     {
-      m_upstream->do_deallocate(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
+      deallocate_upstream(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
     }
 
     // deallocate cached oversized/overaligned memory
-    for (std::size_t i = 0; i < m_oversized.size(); ++i)
+    for (const auto& entry : m_oversized)
     {
-      m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      deallocate_upstream(entry.second.pointer, entry.second.size, entry.second.alignment);
     }
 
     m_allocated.clear();
     m_oversized.clear();
     m_cached_oversized.clear();
+    m_release_trigger = m_options.release_threshold;
   }
 
-  void squeeze()
+  /*! Returns memory that is held but not handed out to upstream, without releasing the memory in use: cached
+   *      oversized blocks first, from the largest one, then chunks with no blocks in use, until at most
+   *      \p bytes_to_keep bytes held from upstream are not handed out, or nothing more can be returned.
+   *
+   *  \param bytes_to_keep the number of bytes held but not handed out that the pool may keep
+   *  \returns the number of bytes returned to upstream
+   */
+  std::size_t trim(std::size_t bytes_to_keep = 0)
   {
-    // Find all unused chunks and deallocate them
-    for (auto it = m_allocated.begin(); it != m_allocated.end();)
-    {
-      const auto pool_idx = (*it).pool_idx;
-      auto& pool          = m_pools[pool_idx];
-
-      const std::size_t bytes_log2  = pool_idx + m_smallest_block_log2;
-      const std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
-      const std::size_t n           = (*it).size / bucket_size;
-      assert((*it).size % bucket_size == 0);
-
-      bool in_use = false;
-      for (std::size_t i = 0; i < n; ++i)
-      {
-        const auto ptr = static_cast<void_ptr>(static_cast<char_ptr>((*it).pointer) + i * bucket_size);
-        if (find(pool.free_blocks.begin(), pool.free_blocks.end(), ptr) == pool.free_blocks.end())
-        {
-          in_use = true;
-          break;
-        }
-      }
-
-      if (!in_use)
-      {
-        // Remove all free blocks cut from this chunk:
-        for (std::size_t i = 0; i < n; ++i)
-        {
-          const auto ptr = static_cast<void_ptr>(static_cast<char_ptr>((*it).pointer) + i * bucket_size);
-          pool.free_blocks.erase(find(pool.free_blocks.begin(), pool.free_blocks.end(), ptr));
-        }
-
-        // Deallocate and remove this chunk from the list of allocated chunks
-        m_upstream->do_deallocate((*it).pointer, (*it).size, m_options.alignment);
-        it = m_allocated.erase(it);
-      }
-      else
-      {
-        ++it;
-      }
-    }
+    m_release_trigger = m_options.release_threshold;
+    return trim_impl(bytes_to_keep, false);
+  }
 
-    // Remove all cached oversized allocations
-    for (auto it = m_cached_oversized.begin(); it != m_cached_oversized.end();)
-    {
-      m_upstream->do_deallocate((*it).pointer, (*it).size, (*it).alignment);
-      m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), *it));
-      it = m_cached_oversized.erase(it);
-    }
+  void squeeze()
+  {
+    trim(0);
   }
 
   [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -359,91 +511,79 @@ public:
 
   [[nodiscard]] void_ptr do_allocate_impl(std::size_t bytes, std::size_t alignment)
   {
+    const std::size_t requested = bytes;
+
     bytes = (std::max) (bytes, m_options.smallest_block_size);
     assert(::cuda::__is_valid_alignment(alignment));
 
     // an oversized and/or overaligned allocation requested; needs to be allocated separately
     if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
     {
+      ++m_statistics.oversized_allocations;
+
       oversized_block_descriptor oversized;
       oversized.size      = bytes;
       oversized.alignment = alignment;
+      oversized.cached_at = 0;
 
-      if (m_options.cache_oversized && !m_cached_oversized.empty())
+      if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        // best fit: the smallest cached block that is large enough and aligned enough, unless it is bigger or more
+        // aligned than the request by a factor bigger than or equal to the specified cutoffs
+        for (auto it = m_cached_oversized.lower_bound(oversized); it != m_cached_oversized.end(); ++it)
         {
-          std::size_t size_factor = (*it).size / bytes;
-          if (size_factor >= m_options.cached_size_cutoff_factor)
+          if ((*it).size / bytes >= m_options.cached_size_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            break;
           }
-        }
 
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-        {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-        }
-
-        // if the alignment is bigger than the requested one by a factor
-        // bigger than or equal to the specified cutoff for alignment,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
-        {
-          std::size_t alignment_factor = (*it).alignment / alignment;
-          if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+          if ((*it).alignment >= alignment && (*it).alignment / alignment < m_options.cached_alignment_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            oversized.pointer = (*it).pointer;
+            ++m_statistics.oversized_hits;
+            m_statistics.bytes_in_use += requested;
+            m_statistics.block_bytes_in_use += (*it).size;
+            m_statistics.cached_oversized_bytes -= (*it).size;
+            m_cached_oversized.erase(it);
+            return oversized.pointer;
           }
         }
-
-        if (it != m_cached_oversized.end())
-        {
-          oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
-          return oversized.pointer;
-        }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
-      oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-      m_oversized.push_back(oversized);
+      oversized.pointer = allocate_upstream(bytes, alignment);
+      m_oversized.emplace(oversized.pointer, oversized);
 
+      m_statistics.bytes_in_use += requested;
+      m_statistics.block_bytes_in_use += bytes;
       return oversized.pointer;
     }
 
     // the request is NOT for oversized and/or overaligned memory
     // allocate a block from an appropriate bucket
-    std::size_t bytes_log2 = ::cuda::ceil_ilog2(bytes);
-    std::size_t pool_idx   = bytes_log2 - m_smallest_block_log2;
-    pool& bucket           = m_pools[pool_idx];
+    std::size_t pool_idx = m_size_classes.index(bytes);
+    pool& bucket         = m_pools[pool_idx];
+
+    std::size_t bucket_size = m_size_classes.block_size(pool_idx);
 
     // if the free list of the bucket has no elements, allocate a new chunk
     // and split it into blocks pushed to the free list
     if (bucket.free_blocks.empty())
     {
-      std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
-
       std::size_t n = bucket.previous_allocated_count;
       if (n == 0)
       {
         n = ::cuda::std::max(m_options.min_blocks_per_chunk, //
-                             m_options.min_bytes_per_chunk >> bytes_log2);
+                             ::cuda::ceil_div(m_options.min_bytes_per_chunk, bucket_size));
       }
       else
       {
         n = ::cuda::std::min({n * 3 / 2, //
-                              m_options.max_bytes_per_chunk >> bytes_log2,
+                              m_options.max_bytes_per_chunk / bucket_size,
                               m_options.max_blocks_per_chunk});
       }
 
-      bytes = n << bytes_log2;
+      bytes = n * bucket_size;
 
       assert(n >= m_options.min_blocks_per_chunk);
       assert(n <= m_options.max_blocks_per_chunk);
@@ -452,10 +592,12 @@ public:
 
       chunk_descriptor allocated;
       allocated.size     = bytes;
-      allocated.pointer  = m_upstream->do_allocate(bytes, m_options.alignment);
+      allocated.pointer  = allocate_upstream(bytes, m_options.alignment);
       allocated.pool_idx = pool_idx;
       m_allocated.push_back(allocated);
       bucket.previous_allocated_count = n;
+      ++bucket.chunks;
+      bucket.blocks += n;
 
       for (std::size_t i = 0; i < n; ++i)
       {
@@ -466,11 +608,24 @@ public:
     // allocate a block from the front of the bucket's free list
     void_ptr ret = bucket.free_blocks.back();
     bucket.free_blocks.pop_back();
+
+    ++bucket.allocations;
+    m_statistics.bytes_in_use += requested;
+    m_statistics.block_bytes_in_use += bucket_size;
     return ret;
   }
 
   void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    do_deallocate_impl(p, n, alignment);
+    release_idle_memory();
+  }
+
+private:
+  void do_deallocate_impl(void_ptr p, std::size_t n, std::size_t alignment)
+  {
+    m_statistics.bytes_in_use -= n;
+
     n = (std::max) (n, m_options.smallest_block_size);
     assert(::cuda::__is_valid_alignment(alignment));
 
@@ -480,32 +635,35 @@ public:
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
+      typename oversized_map::iterator it = m_oversized.find(p);
       assert(it != m_oversized.end());
 
-      oversized_block_descriptor oversized = *it;
+      oversized_block_descriptor oversized = it->second;
+      m_statistics.block_bytes_in_use -= oversized.size;
 
       if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+        oversized.cached_at = m_deallocation_count;
+        m_cached_oversized.insert(oversized);
+        m_statistics.cached_oversized_bytes += oversized.size;
         return;
       }
 
       m_oversized.erase(it);
 
-      m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+      deallocate_upstream(p, oversized.size, oversized.alignment);
 
       return;
     }
 
     // push the block to the front of the appropriate bucket's free list
-    std::size_t n_log2   = ::cuda::ceil_ilog2(n);
-    std::size_t pool_idx = n_log2 - m_smallest_block_log2;
+    std::size_t pool_idx = m_size_classes.index(n);
     pool& bucket         = m_pools[pool_idx];
 
     bucket.free_blocks.push_back(p);
+
+    ++bucket.deallocations;
+    m_statistics.block_bytes_in_use -= m_size_classes.block_size(pool_idx);
   }
 };
 
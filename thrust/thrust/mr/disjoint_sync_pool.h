@@ -71,6 +71,26 @@ public:
       : upstream_pool(get_global_resource<Upstream>(), get_global_resource<Bookkeeper>(), options)
   {}
 
+  /*! Returns statistics about the use of the pool and of its upstream resource.
+   */
+  pool_statistics statistics()
+  {
+    lock_t lock(mtx); // NOLINT(modernize-use-scoped-lock)
+    return upstream_pool.statistics();
+  }
+
+  /*! Returns memory that is held but not handed out to upstream, until at most \p bytes_to_keep bytes held from
+   *      upstream are not handed out, or nothing more can be returned.
+   *
+   *  \param bytes_to_keep the number of bytes held but not handed out that the pool may keep
+   *  \returns the number of bytes returned to upstream
+   */
+  std::size_t trim(std::size_t bytes_to_keep = 0)
+  {
+    lock_t lock(mtx); // NOLINT(modernize-use-scoped-lock)
+    return upstream_pool.trim(bytes_to_keep);
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -46,6 +46,17 @@ public:
       static_cast<typename Upstream::pointer>(::cuda::std::to_address(p)), bytes, alignment);
   }
 
+  bool do_expand(Pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment) override
+  {
+    auto upstream_p = static_cast<typename Upstream::pointer>(::cuda::std::to_address(p));
+    if (!m_upstream->do_expand(upstream_p, bytes, new_bytes, alignment))
+    {
+      return false;
+    }
+    p = static_cast<Pointer>(upstream_p);
+    return true;
+  }
+
 private:
   Upstream* m_upstream;
 };
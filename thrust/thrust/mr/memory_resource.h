@@ -77,6 +77,24 @@ public:
     do_deallocate(p, bytes, alignment);
   }
 
+  /*! Tries to grow the allocation pointed to by \p p to at least \p new_bytes, without copying its contents. On
+   *      success, the contents may have been moved bitwise to a new address, e.g. by remapping their pages, so this
+   *      must only be used for objects that are trivially relocatable.
+   *
+   *  \param p pointer to the allocation to grow, which is updated to its new address on success
+   *  \param bytes the size of the allocation. This must be equivalent to the value of \p bytes that
+   *      was passed to the allocation function that returned \p p.
+   *  \param new_bytes the size the allocation is grown to, which must be passed to \p deallocate afterwards
+   *  \param alignment the alignment of the allocation. This must be equivalent to the value of \p alignment
+   *      that was passed to the allocation function that returned \p p.
+   *  \return whether the allocation was grown; if not, \p p is unchanged and the allocation still has \p bytes.
+   */
+  bool
+  expand(pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT)
+  {
+    return do_expand(p, bytes, new_bytes, alignment);
+  }
+
   /*! Compares this resource to the other one. The default implementation uses identity comparison,
    *      which is often the right thing to do and doesn't require RTTI involvement.
    *
@@ -107,6 +125,24 @@ public:
    */
   virtual void do_deallocate(pointer p, std::size_t bytes, std::size_t alignment) = 0;
 
+  /*! Tries to grow the allocation pointed to by \p p to at least \p new_bytes, without copying its contents. The
+   *      default implementation never does, so that callers fall back to allocating new memory and copying.
+   *
+   *  \param p pointer to the allocation to grow, which is updated to its new address on success
+   *  \param bytes the size of the allocation
+   *  \param new_bytes the size the allocation is grown to
+   *  \param alignment the alignment of the allocation
+   *  \return whether the allocation was grown.
+   */
+  virtual bool do_expand(pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment)
+  {
+    (void) p;
+    (void) bytes;
+    (void) new_bytes;
+    (void) alignment;
+    return false;
+  }
+
   /*! Compares this resource to the other one. The default implementation uses identity comparison,
    *      which is often the right thing to do and doesn't require RTTI involvement.
    *
@@ -140,6 +176,12 @@ public:
     do_deallocate(p, bytes, alignment);
   }
 
+  bool
+  expand(pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT)
+  {
+    return do_expand(p, bytes, new_bytes, alignment);
+  }
+
   _CCCL_HOST_DEVICE bool is_equal(const memory_resource& other) const noexcept
   {
     return do_is_equal(other);
@@ -147,6 +189,14 @@ public:
 
   virtual pointer do_allocate(std::size_t bytes, std::size_t alignment)           = 0;
   virtual void do_deallocate(pointer p, std::size_t bytes, std::size_t alignment) = 0;
+  virtual bool do_expand(pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment)
+  {
+    (void) p;
+    (void) bytes;
+    (void) new_bytes;
+    (void) alignment;
+    return false;
+  }
   _CCCL_HOST_DEVICE virtual bool do_is_equal(const memory_resource& other) const noexcept
   {
     return this == &other;
@@ -0,0 +1,388 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A host memory resource that maps pages from the operating system,
+ *  with control over huge pages, NUMA placement, and first touch.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cuda/__cmath/round_up.h>
+#include <cuda/std/cstdint>
+
+#if !_CCCL_OS(WINDOWS)
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+
+#  include <cstdio>
+#endif // !_CCCL_OS(WINDOWS)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! How \p page_resource backs its allocations with huge pages.
+ */
+enum class huge_page_policy
+{
+  /*! Regular pages only.
+   */
+  none,
+  /*! Allocations are aligned to huge pages and the kernel is advised to back them with transparent huge pages.
+   */
+  transparent,
+  /*! Allocations are mapped from the huge pages reserved by the administrator. When none are left, they fall back to
+   *      transparent huge pages.
+   */
+  reserved
+};
+
+/*! Where \p page_resource places the pages of its allocations among the NUMA nodes of the machine.
+ */
+enum class numa_policy
+{
+  /*! Every page is placed on the node of the thread that touches it first.
+   */
+  first_touch,
+  /*! The pages are spread over the nodes round robin.
+   */
+  interleave,
+  /*! The pages are placed on the nodes only, starting with the first one.
+   */
+  bind
+};
+
+/*! A type used for configuring \p page_resource.
+ */
+struct page_resource_options
+{
+  /*! Allocations smaller than this are served by the global operator new, like by \p new_delete_resource, because
+   *      mapping pages for them would waste memory and time.
+   */
+  std::size_t min_bytes = static_cast<std::size_t>(1) << 20;
+
+  /*! Whether allocations are backed by huge pages.
+   */
+  huge_page_policy huge_pages = huge_page_policy::none;
+  /*! The size of a huge page. Allocations backed by huge pages are rounded up to a multiple of it.
+   */
+  std::size_t huge_page_size = static_cast<std::size_t>(2) << 20;
+
+  /*! Where pages are placed among the NUMA nodes.
+   */
+  numa_policy numa = numa_policy::first_touch;
+  /*! The mask of the NUMA nodes that \p numa_policy::interleave and \p numa_policy::bind use, with bit \c i set for
+   *      node \c i. 0 selects all nodes that are online.
+   */
+  std::uint64_t numa_nodes = 0;
+
+  /*! Decides whether every page is touched when it is allocated, so that it is placed on a NUMA node before the memory
+   *      is handed out, by the threads of the first touch function of the resource.
+   */
+  bool first_touch = true;
+};
+
+/*! Touches pages on the calling thread.
+ */
+struct serial_first_touch
+{
+  void operator()(char* p, std::size_t bytes, std::size_t page_size) const
+  {
+    for (std::size_t offset = 0; offset < bytes; offset += page_size)
+    {
+      p[offset] = 0;
+    }
+  }
+};
+
+//! \cond
+namespace detail
+{
+#if !_CCCL_OS(WINDOWS)
+inline std::size_t system_page_size()
+{
+  static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+// the nodes listed in sysfs, e.g. "0-1,4"; 0 when they cannot be read
+inline std::uint64_t online_numa_nodes()
+{
+  static const std::uint64_t nodes = [] {
+    std::uint64_t mask = 0;
+    std::FILE* file    = std::fopen("/sys/devices/system/node/online", "r");
+    if (file == nullptr)
+    {
+      return mask;
+    }
+
+    unsigned first = 0;
+    while (std::fscanf(file, "%u", &first) == 1)
+    {
+      unsigned last = first;
+      const int sep = std::fgetc(file);
+      if (sep == '-' && std::fscanf(file, "%u", &last) == 1)
+      {
+        std::fgetc(file);
+      }
+      for (unsigned node = first; node <= last && node < 64; ++node)
+      {
+        mask |= static_cast<std::uint64_t>(1) << node;
+      }
+    }
+
+    std::fclose(file);
+    return mask;
+  }();
+  return nodes;
+}
+
+// maps size bytes aligned to alignment; size must be a multiple of granularity, the alignment of every mapping
+inline void* map_pages(std::size_t size, std::size_t alignment, std::size_t granularity, int flags)
+{
+  // map enough to cut an aligned range out of the mapping, and unmap the rest
+  const std::size_t padding = alignment > granularity ? alignment - granularity : 0;
+
+  void* p = ::mmap(nullptr, size + padding, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+  if (p == MAP_FAILED)
+  {
+    return nullptr;
+  }
+
+  const std::uintptr_t begin   = reinterpret_cast<std::uintptr_t>(p);
+  const std::uintptr_t aligned = ::cuda::round_up(begin, static_cast<std::uintptr_t>(alignment));
+  if (aligned != begin)
+  {
+    ::munmap(p, aligned - begin);
+  }
+  if (padding != aligned - begin)
+  {
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    ::munmap(reinterpret_cast<void*>(aligned + size), padding - (aligned - begin));
+  }
+
+  return reinterpret_cast<void*>(aligned); // NOLINT(performance-no-int-to-ptr)
+}
+
+// placement is a hint; when the kernel refuses it, pages are placed on first touch
+inline void bind_pages(void* p, std::size_t size, numa_policy policy, std::uint64_t nodes)
+{
+#  if defined(__linux__) && defined(SYS_mbind)
+  // the values of MPOL_BIND and MPOL_INTERLEAVE in linux/mempolicy.h
+  const long mode = policy == numa_policy::bind ? 2 : 3;
+  nodes           = nodes != 0 ? nodes : online_numa_nodes();
+  if (nodes != 0)
+  {
+    // the kernel reads one bit less than the number it is given
+    ::syscall(SYS_mbind, p, size, mode, &nodes, 65ul, 0u);
+  }
+#  else // ^^^ SYS_mbind ^^^ / vvv !SYS_mbind vvv
+  (void) p;
+  (void) size;
+  (void) policy;
+  (void) nodes;
+#  endif // !SYS_mbind
+}
+#endif // !_CCCL_OS(WINDOWS)
+} // namespace detail
+//! \endcond
+
+/*! A memory resource that maps large allocations directly from the operating system, which lets it back them with huge
+ *      pages, and decide on which NUMA nodes their pages are placed.
+ *
+ *  A page is placed on a NUMA node when it is first touched, and by default, on the node of the thread that touches
+ *      it. Memory that is filled by a single thread thus ends up on a single node, and parallel algorithms that later
+ *      run on the threads of all nodes are limited by the bandwidth between the nodes. \p page_resource touches every
+ *      page of an allocation before handing it out, with \p FirstTouch, which can spread this work over the threads
+ *      that will use the memory; the memory resources of the OpenMP and TBB systems touch pages with the threads of
+ *      those systems, split statically between them like the ranges of their algorithms. Alternatively, the pages can
+ *      be interleaved over, or bound to, a set of nodes.
+ *
+ *  Only allocations of at least \p page_resource_options::min_bytes are mapped; smaller ones are served by the global
+ *      operator new. On Windows, all allocations are served by operator new, and only touched. On Linux, mapped
+ *      allocations can be grown with \p expand, which lets vectors of trivially relocatable types grow without copying.
+ *
+ *  \tparam FirstTouch the type of the function object called with the beginning and the size of every mapped
+ *      allocation, and the size of its pages, to touch them
+ */
+template <typename FirstTouch = serial_first_touch>
+class page_resource final : public memory_resource<>
+{
+public:
+  /*! Constructor.
+   *
+   *  \param options the options to use
+   *  \param first_touch the function to touch new allocations with
+   */
+  page_resource(page_resource_options options = page_resource_options(), FirstTouch first_touch = FirstTouch())
+      : m_options(options)
+      , m_first_touch(first_touch)
+  {}
+
+  /*! Returns the options of the resource.
+   */
+  const page_resource_options& options() const
+  {
+    return m_options;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    if (bytes < m_options.min_bytes)
+    {
+      return m_small.do_allocate(bytes, alignment);
+    }
+
+#if _CCCL_OS(WINDOWS)
+    void* p = m_small.do_allocate(bytes, alignment);
+    if (m_options.first_touch)
+    {
+      m_first_touch(static_cast<char*>(p), bytes, 4096);
+    }
+    return p;
+#else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+    const std::size_t page_size = mapped_page_size();
+    const std::size_t size      = ::cuda::round_up(bytes, page_size);
+    alignment                   = alignment > page_size ? alignment : page_size;
+
+    void* p = nullptr;
+#  if defined(MAP_HUGETLB)
+    if (m_options.huge_pages == huge_page_policy::reserved)
+    {
+      p = detail::map_pages(size, alignment, page_size, MAP_HUGETLB);
+    }
+#  endif // MAP_HUGETLB
+    if (p == nullptr)
+    {
+      p = detail::map_pages(size, alignment, detail::system_page_size(), 0);
+      if (p == nullptr)
+      {
+        throw thrust::system::detail::bad_alloc("page_resource: failed to map pages");
+      }
+
+#  if defined(MADV_HUGEPAGE)
+      if (m_options.huge_pages != huge_page_policy::none)
+      {
+        ::madvise(p, size, MADV_HUGEPAGE);
+      }
+#  endif // MADV_HUGEPAGE
+    }
+
+    if (m_options.numa != numa_policy::first_touch)
+    {
+      detail::bind_pages(p, size, m_options.numa, m_options.numa_nodes);
+    }
+
+    if (m_options.first_touch)
+    {
+      m_first_touch(static_cast<char*>(p), size, page_size);
+    }
+
+    return p;
+#endif // !_CCCL_OS(WINDOWS)
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if _CCCL_OS(WINDOWS)
+    m_small.do_deallocate(p, bytes, alignment);
+#else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+    if (bytes < m_options.min_bytes)
+    {
+      m_small.do_deallocate(p, bytes, alignment);
+      return;
+    }
+
+    ::munmap(p, ::cuda::round_up(bytes, mapped_page_size()));
+#endif // !_CCCL_OS(WINDOWS)
+  }
+
+  /*! Grows mapped allocations by remapping their pages, which never copies their contents. With regular pages and
+   *      an alignment no larger than a page, the kernel may move the pages to another address when the addresses that
+   *      follow the allocation are taken; otherwise, the allocation only grows in place. Allocations served by operator
+   *      new are never grown.
+   */
+  bool do_expand(void*& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment) override
+  {
+#if defined(MREMAP_MAYMOVE)
+    if (bytes < m_options.min_bytes || new_bytes < bytes)
+    {
+      return false;
+    }
+
+    const std::size_t page_size = mapped_page_size();
+    const std::size_t size      = ::cuda::round_up(bytes, page_size);
+    const std::size_t new_size  = ::cuda::round_up(new_bytes, page_size);
+    if (new_size == size)
+    {
+      return true;
+    }
+
+    // a moved mapping is only aligned to a regular page
+    const bool may_move = m_options.huge_pages == huge_page_policy::none && alignment <= detail::system_page_size();
+
+    void* new_p = ::mremap(p, size, new_size, may_move ? MREMAP_MAYMOVE : 0);
+    if (new_p == MAP_FAILED)
+    {
+      return false;
+    }
+
+    char* tail = static_cast<char*>(new_p) + size;
+    if (m_options.numa != numa_policy::first_touch)
+    {
+      detail::bind_pages(tail, new_size - size, m_options.numa, m_options.numa_nodes);
+    }
+    if (m_options.first_touch)
+    {
+      m_first_touch(tail, new_size - size, page_size);
+    }
+
+    p = new_p;
+    return true;
+#else // ^^^ MREMAP_MAYMOVE ^^^ / vvv !MREMAP_MAYMOVE vvv
+    (void) p;
+    (void) bytes;
+    (void) new_bytes;
+    (void) alignment;
+    return false;
+#endif // !MREMAP_MAYMOVE
+  }
+
+private:
+#if !_CCCL_OS(WINDOWS)
+  // the granularity of mapped allocations
+  std::size_t mapped_page_size() const
+  {
+    return m_options.huge_pages == huge_page_policy::none ? detail::system_page_size() : m_options.huge_page_size;
+  }
+#endif // !_CCCL_OS(WINDOWS)
+
+  page_resource_options m_options;
+  FirstTouch m_first_touch;
+  new_delete_resource_base m_small;
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
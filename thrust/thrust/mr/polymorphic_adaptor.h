@@ -36,6 +36,11 @@ public:
     return upstream_resource->deallocate(p, bytes, alignment);
   }
 
+  bool do_expand(Pointer& p, std::size_t bytes, std::size_t new_bytes, std::size_t alignment) override
+  {
+    return upstream_resource->expand(p, bytes, new_bytes, alignment);
+  }
+
   _CCCL_HOST_DEVICE bool do_is_equal(const memory_resource<Pointer>& other) const noexcept override
   {
     return upstream_resource->is_equal(other);
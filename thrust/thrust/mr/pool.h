@@ -23,12 +23,15 @@
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_statistics.h>
 
 #include <cuda/__cmath/ilog.h>
+#include <cuda/__cmath/round_up.h>
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/__host_stdlib/algorithm>
 #include <cuda/std/cassert>
 #include <cuda/std/cstdint>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -100,16 +103,20 @@ public:
   unsynchronized_pool_resource(Upstream* upstream, pool_options options = get_default_options())
       : m_upstream(upstream)
       , m_options(options)
-      , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
+      , m_size_classes(m_options)
       , m_pools(upstream)
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_statistics()
+      , m_release_trigger(m_options.release_threshold)
+      , m_deallocation_count(0)
+      , m_last_idle_check(0)
   {
     assert(m_options.validate());
 
-    pool p = {block_descriptor_ptr(), 0};
-    m_pools.resize(::cuda::ceil_ilog2(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+    pool p = {block_descriptor_ptr(), 0, 0, 0, 0, 0, 0};
+    m_pools.resize(m_size_classes.count(), p);
   }
 
   // TODO: C++11: use delegating constructors
@@ -121,16 +128,20 @@ public:
   unsynchronized_pool_resource(pool_options options = get_default_options())
       : m_upstream(get_global_resource<Upstream>())
       , m_options(options)
-      , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
+      , m_size_classes(m_options)
       , m_pools(get_global_resource<Upstream>())
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_statistics()
+      , m_release_trigger(m_options.release_threshold)
+      , m_deallocation_count(0)
+      , m_last_idle_check(0)
   {
     assert(m_options.validate());
 
-    pool p = {block_descriptor_ptr(), 0};
-    m_pools.resize(::cuda::ceil_ilog2(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+    pool p = {block_descriptor_ptr(), 0, 0, 0, 0, 0, 0};
+    m_pools.resize(m_size_classes.count(), p);
   }
 
   /*! Destructor. Releases all held memory to upstream.
@@ -154,68 +165,511 @@ private:
   using oversized_block_descriptor_ptr = typename void_ptr_traits::template rebind<oversized_block_descriptor>;
   using oversized_block_ptr_traits     = ::cuda::std::pointer_traits<oversized_block_descriptor_ptr>;
 
+  // the descriptor of a block follows it and is kept while the block is in use, so that it still knows its chunk
   struct block_descriptor
   {
     block_descriptor_ptr next;
+    chunk_descriptor_ptr chunk;
   };
 
   struct chunk_descriptor
   {
     std::size_t size;
     chunk_descriptor_ptr next;
+    std::size_t bucket;
+    std::size_t blocks;
+    // only valid while the pool is trimmed
+    std::size_t free_blocks;
+    bool released;
   };
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
+  // traversal of a linked list
   //
-  // TODO: investigate whether it's better to have this be a doubly-linked list
-  // with fast do_deallocate when !m_options.cache_oversized, or to have this be
-  // a forward list and require traversal in do_deallocate
+  // cached blocks are additionally kept in one list per power of two of their
+  // size, sorted by size and then by alignment, so that the first block that
+  // fits a request is also the best fitting one; those lists are doubly linked
+  // too, because coalescing removes blocks from the middle of them
   //
-  // I assume that it is better this way, but the additional pointer could
-  // potentially hurt? these are supposed to be oversized and/or overaligned,
-  // so they are kinda memory intensive already
+  // those lists are plain linked lists, so both inserting a block and looking
+  // one up walk the list, in time linear in the number of cached blocks of the
+  // same power of two of size; the descriptors live in memory of the upstream
+  // resource, right behind their blocks, and unlike the disjoint pool there is
+  // no bookkeeping resource to keep an ordered set of them in
+  //
+  // blocks split from a single upstream allocation are linked in address order
+  // through prev_split and next_split; only the first of them knows the size of
+  // the upstream allocation
   struct oversized_block_descriptor
   {
     std::size_t size;
     std::size_t alignment;
     oversized_block_descriptor_ptr prev;
     oversized_block_descriptor_ptr next;
+    oversized_block_descriptor_ptr prev_cached;
     oversized_block_descriptor_ptr next_cached;
     std::size_t current_size;
+    oversized_block_descriptor_ptr prev_split;
+    oversized_block_descriptor_ptr next_split;
+    std::size_t upstream_size;
+    bool cached;
+    std::size_t cached_at;
   };
 
   struct pool
   {
     block_descriptor_ptr free_list;
     std::size_t previous_allocated_count;
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t chunks;
+    std::size_t blocks;
+    // the number of allocations at the previous check for idle memory
+    std::size_t checked_allocations;
   };
 
   using pool_vector = thrust::host_vector<pool, allocator<pool, Upstream>>;
 
+  // one list of cached oversized blocks for every power of two
+  static constexpr std::size_t cached_list_count = ::cuda::std::numeric_limits<std::size_t>::digits;
+
   Upstream* m_upstream;
 
   pool_options m_options;
-  std::size_t m_smallest_block_log2;
+  detail::pool_size_classes m_size_classes;
 
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  oversized_block_descriptor_ptr m_cached_oversized[cached_list_count];
+
+  // everything but the size classes, which are counted in m_pools
+  pool_statistics m_statistics;
+
+  // the number of idle bytes above which a deallocation trims the pool
+  std::size_t m_release_trigger;
+  // the clock of the checks for idle memory
+  std::size_t m_deallocation_count;
+  std::size_t m_last_idle_check;
+
+  void_ptr allocate_upstream(std::size_t bytes, std::size_t alignment)
+  {
+    void_ptr p = m_upstream->do_allocate(bytes, alignment);
+
+    ++m_statistics.upstream_allocations;
+    m_statistics.upstream_bytes += bytes;
+    m_statistics.peak_upstream_bytes = (std::max) (m_statistics.peak_upstream_bytes, m_statistics.upstream_bytes);
+
+    return p;
+  }
+
+  void deallocate_upstream(void_ptr p, std::size_t bytes, std::size_t alignment)
+  {
+    m_upstream->do_deallocate(p, bytes, alignment);
+
+    ++m_statistics.upstream_deallocations;
+    m_statistics.upstream_bytes -= bytes;
+  }
+
+  // the distance between the end of a block split from a larger one and the beginning of the next block
+  static std::size_t split_stride(std::size_t alignment)
+  {
+    return ::cuda::round_up(sizeof(oversized_block_descriptor), alignment);
+  }
+
+  // whether enough of a cached block is left behind a request to keep it as a separate cached block
+  bool can_split(const oversized_block_descriptor& desc, std::size_t bytes) const
+  {
+    // the size of a cached block does not need to be a multiple of its alignment, so the rounded up request may be
+    // larger than the block
+    const std::size_t split_size = ::cuda::round_up(bytes, desc.alignment);
+    return m_options.split_cached_oversized && desc.size >= split_size
+        && desc.size - split_size >= split_stride(desc.alignment) + m_options.largest_block_size;
+  }
+
+  // finds the smallest cached block that can be used for a request, or returns a null pointer
+  oversized_block_descriptor_ptr find_cached(std::size_t bytes, std::size_t alignment) const
+  {
+    for (std::size_t list = ::cuda::ilog2(bytes); list < cached_list_count; ++list)
+    {
+      for (oversized_block_descriptor_ptr ptr = m_cached_oversized[list]; ::cuda::std::to_address(ptr);)
+      {
+        const oversized_block_descriptor desc = *ptr;
+        if (desc.size < bytes)
+        {
+          ptr = desc.next_cached;
+          continue;
+        }
+
+        // if the size is bigger than the requested size by a factor
+        // bigger than or equal to the specified cutoff for size,
+        // allocate a new block, unless the block can be split; every
+        // later block is even bigger
+        if (!can_split(desc, bytes) && desc.size / bytes >= m_options.cached_size_cutoff_factor)
+        {
+          if (!m_options.split_cached_oversized)
+          {
+            return oversized_block_descriptor_ptr();
+          }
+          ptr = desc.next_cached;
+          continue;
+        }
+
+        // if the alignment is bigger than the requested one by a factor
+        // bigger than or equal to the specified cutoff for alignment,
+        // try the next block
+        if (desc.alignment < alignment || desc.alignment / alignment >= m_options.cached_alignment_cutoff_factor)
+        {
+          ptr = desc.next_cached;
+          continue;
+        }
+
+        return ptr;
+      }
+    }
+
+    return oversized_block_descriptor_ptr();
+  }
+
+  // points the neighbours of a block at the new location of its descriptor
+  void relink_oversized(oversized_block_descriptor_ptr block, const oversized_block_descriptor& desc)
+  {
+    if (::cuda::std::to_address(desc.prev))
+    {
+      thrust::raw_reference_cast(*desc.prev).next = block;
+    }
+    else
+    {
+      m_oversized = block;
+    }
+
+    if (::cuda::std::to_address(desc.next))
+    {
+      thrust::raw_reference_cast(*desc.next).prev = block;
+    }
+
+    if (::cuda::std::to_address(desc.prev_split))
+    {
+      thrust::raw_reference_cast(*desc.prev_split).next_split = block;
+    }
+
+    if (::cuda::std::to_address(desc.next_split))
+    {
+      thrust::raw_reference_cast(*desc.next_split).prev_split = block;
+    }
+  }
+
+  void unlink_oversized(const oversized_block_descriptor& desc)
+  {
+    if (::cuda::std::to_address(desc.prev))
+    {
+      thrust::raw_reference_cast(*desc.prev).next = desc.next;
+    }
+    else
+    {
+      m_oversized = desc.next;
+    }
+
+    if (::cuda::std::to_address(desc.next))
+    {
+      thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+    }
+  }
+
+  // inserts a block into the cached list for its size, in front of the first block that is not smaller; this is a
+  // linear scan of that list, O(n) in the number of blocks cached in it
+  void insert_cached(oversized_block_descriptor_ptr block, oversized_block_descriptor& desc)
+  {
+    oversized_block_descriptor_ptr& head = m_cached_oversized[::cuda::ilog2(desc.size)];
+
+    oversized_block_descriptor_ptr prev = oversized_block_descriptor_ptr();
+    oversized_block_descriptor_ptr next = head;
+    while (::cuda::std::to_address(next))
+    {
+      oversized_block_descriptor next_desc = *next;
+      if (next_desc.size > desc.size || (next_desc.size == desc.size && next_desc.alignment >= desc.alignment))
+      {
+        break;
+      }
+      prev = next;
+      next = next_desc.next_cached;
+    }
+
+    desc.cached      = true;
+    desc.prev_cached = prev;
+    desc.next_cached = next;
+    desc.cached_at   = m_deallocation_count;
+    m_statistics.cached_oversized_bytes += desc.size;
+
+    if (::cuda::std::to_address(prev))
+    {
+      thrust::raw_reference_cast(*prev).next_cached = block;
+    }
+    else
+    {
+      head = block;
+    }
+
+    if (::cuda::std::to_address(next))
+    {
+      thrust::raw_reference_cast(*next).prev_cached = block;
+    }
+  }
+
+  void erase_cached(oversized_block_descriptor& desc)
+  {
+    if (::cuda::std::to_address(desc.prev_cached))
+    {
+      thrust::raw_reference_cast(*desc.prev_cached).next_cached = desc.next_cached;
+    }
+    else
+    {
+      m_cached_oversized[::cuda::ilog2(desc.size)] = desc.next_cached;
+    }
+
+    if (::cuda::std::to_address(desc.next_cached))
+    {
+      thrust::raw_reference_cast(*desc.next_cached).prev_cached = desc.prev_cached;
+    }
+
+    desc.cached      = false;
+    desc.prev_cached = oversized_block_descriptor_ptr();
+    desc.next_cached = oversized_block_descriptor_ptr();
+    m_statistics.cached_oversized_bytes -= desc.size;
+  }
+
+  // the number of bytes held from upstream that are not handed out
+  std::size_t idle_bytes() const
+  {
+    return m_statistics.upstream_bytes - m_statistics.block_bytes_in_use;
+  }
+
+  // returns cached oversized blocks and chunks with no blocks in use to upstream, until at most bytes_to_keep bytes
+  // are idle; if cold_only is true, only those blocks that were cached, and the chunks of those buckets that had no
+  // allocations, since the previous check for idle memory
+  std::size_t trim_impl(std::size_t bytes_to_keep, bool cold_only)
+  {
+    const std::size_t upstream_bytes = m_statistics.upstream_bytes;
+
+    // the largest cached blocks first; blocks split from an upstream allocation whose other pieces are still in use
+    // cannot be returned
+    for (std::size_t list = cached_list_count; list-- > 0 && idle_bytes() > bytes_to_keep;)
+    {
+      for (oversized_block_descriptor_ptr ptr = m_cached_oversized[list];
+           ::cuda::std::to_address(ptr) && idle_bytes() > bytes_to_keep;)
+      {
+        oversized_block_descriptor desc           = *ptr;
+        const oversized_block_descriptor_ptr next = desc.next_cached;
+
+        if (!::cuda::std::to_address(desc.prev_split) && !::cuda::std::to_address(desc.next_split)
+            && (!cold_only || desc.cached_at < m_last_idle_check))
+        {
+          erase_cached(desc);
+          unlink_oversized(desc);
+
+          void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size);
+          deallocate_upstream(p, desc.upstream_size, desc.alignment);
+        }
+
+        ptr = next;
+      }
+    }
+
+    if (idle_bytes() > bytes_to_keep)
+    {
+      trim_chunks(bytes_to_keep, cold_only);
+    }
+
+    return upstream_bytes - m_statistics.upstream_bytes;
+  }
+
+  void trim_chunks(std::size_t bytes_to_keep, bool cold_only)
+  {
+    // count the free blocks of every chunk
+    for (chunk_descriptor_ptr chunk = m_allocated; ::cuda::std::to_address(chunk);)
+    {
+      chunk_descriptor& desc = thrust::raw_reference_cast(*chunk);
+      desc.free_blocks       = 0;
+      chunk                  = desc.next;
+    }
+
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      const pool bucket = m_pools[i];
+      for (block_descriptor_ptr block = bucket.free_list; ::cuda::std::to_address(block);)
+      {
+        const block_descriptor desc = *block;
+        ++thrust::raw_reference_cast(*desc.chunk).free_blocks;
+        block = desc.next;
+      }
+    }
+
+    // pick the chunks to release
+    std::size_t idle = idle_bytes();
+    bool released    = false;
+    for (chunk_descriptor_ptr chunk = m_allocated; ::cuda::std::to_address(chunk);)
+    {
+      chunk_descriptor& desc = thrust::raw_reference_cast(*chunk);
+      const pool bucket      = m_pools[desc.bucket];
+
+      desc.released = idle > bytes_to_keep && desc.free_blocks == desc.blocks
+                   && (!cold_only || bucket.allocations == bucket.checked_allocations);
+      if (desc.released)
+      {
+        idle -= desc.size + sizeof(chunk_descriptor);
+        released = true;
+      }
+
+      chunk = desc.next;
+    }
+
+    if (!released)
+    {
+      return;
+    }
+
+    // drop the blocks of those chunks from the free lists, keeping the order of the others
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      pool& bucket = thrust::raw_reference_cast(m_pools[i]);
+
+      block_descriptor_ptr head = block_descriptor_ptr();
+      block_descriptor_ptr tail = block_descriptor_ptr();
+      for (block_descriptor_ptr block = bucket.free_list; ::cuda::std::to_address(block);)
+      {
+        const block_descriptor desc = *block;
+        if (!thrust::raw_reference_cast(*desc.chunk).released)
+        {
+          if (::cuda::std::to_address(tail))
+          {
+            thrust::raw_reference_cast(*tail).next = block;
+          }
+          else
+          {
+            head = block;
+          }
+          tail = block;
+        }
+        block = desc.next;
+      }
+
+      if (::cuda::std::to_address(tail))
+      {
+        thrust::raw_reference_cast(*tail).next = block_descriptor_ptr();
+      }
+      bucket.free_list = head;
+    }
+
+    // and deallocate them
+    chunk_descriptor_ptr prev = chunk_descriptor_ptr();
+    for (chunk_descriptor_ptr chunk = m_allocated; ::cuda::std::to_address(chunk);)
+    {
+      const chunk_descriptor desc = *chunk;
+      if (!desc.released)
+      {
+        prev  = chunk;
+        chunk = desc.next;
+        continue;
+      }
+
+      if (::cuda::std::to_address(prev))
+      {
+        thrust::raw_reference_cast(*prev).next = desc.next;
+      }
+      else
+      {
+        m_allocated = desc.next;
+      }
+
+      void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(chunk)) - desc.size);
+      deallocate_upstream(p, desc.size + sizeof(chunk_descriptor), m_options.alignment);
+
+      chunk = desc.next;
+    }
+  }
+
+  // applies the release policy of the options after a deallocation
+  void release_idle_memory()
+  {
+    ++m_deallocation_count;
+
+    if (m_options.idle_release_interval != 0
+        && m_deallocation_count - m_last_idle_check >= m_options.idle_release_interval)
+    {
+      trim_impl(0, true);
+
+      for (std::size_t i = 0; i < m_pools.size(); ++i)
+      {
+        pool& bucket               = thrust::raw_reference_cast(m_pools[i]);
+        bucket.checked_allocations = bucket.allocations;
+      }
+      m_last_idle_check = m_deallocation_count;
+    }
+
+    if (idle_bytes() <= m_options.release_threshold)
+    {
+      m_release_trigger = m_options.release_threshold;
+    }
+    else if (idle_bytes() > m_release_trigger)
+    {
+      trim_impl(m_options.release_threshold, false);
+
+      // if memory in use keeps the pool above the threshold, wait for the idle memory to grow before trying again
+      const std::size_t idle = idle_bytes();
+      m_release_trigger      = (std::max) (m_options.release_threshold, idle + idle / 2);
+    }
+  }
 
 public:
+  /*! Returns statistics about the use of the pool and of its upstream resource.
+   */
+  pool_statistics statistics() const
+  {
+    pool_statistics ret = m_statistics;
+
+    ret.size_classes.resize(m_pools.size());
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      const pool bucket = m_pools[i];
+
+      ret.size_classes[i].block_size    = m_size_classes.block_size(i);
+      ret.size_classes[i].allocations   = bucket.allocations;
+      ret.size_classes[i].deallocations = bucket.deallocations;
+      ret.size_classes[i].chunks        = bucket.chunks;
+      ret.size_classes[i].blocks        = bucket.blocks;
+    }
+
+    return ret;
+  }
+
+  /*! Returns memory that is held but not handed out to upstream, without releasing the memory in use: cached
+   *      oversized blocks first, from the largest one, then chunks with no blocks in use, until at most
+   *      \p bytes_to_keep bytes held from upstream are not handed out, or nothing more can be returned.
+   *
+   *  \param bytes_to_keep the number of bytes held but not handed out that the pool may keep
+   *  \returns the number of bytes returned to upstream
+   */
+  std::size_t trim(std::size_t bytes_to_keep = 0)
+  {
+    m_release_trigger = m_options.release_threshold;
+    return trim_impl(bytes_to_keep, false);
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
   {
-    // reset the buckets
+    // reset the buckets; blocks that are still allocated are gone, so count them as deallocated
     for (std::size_t i = 0; i < m_pools.size(); ++i)
     {
-      thrust::raw_reference_cast(m_pools[i]).free_list                = block_descriptor_ptr();
-      thrust::raw_reference_cast(m_pools[i]).previous_allocated_count = 0;
+      pool& bucket                    = thrust::raw_reference_cast(m_pools[i]);
+      bucket.free_list                = block_descriptor_ptr();
+      bucket.previous_allocated_count = 0;
+      bucket.deallocations            = bucket.allocations;
     }
+    m_statistics.bytes_in_use       = 0;
+    m_statistics.block_bytes_in_use = 0;
 
     // deallocate memory allocated for the buckets
     while (::cuda::std::to_address(m_allocated))
@@ -225,8 +679,19 @@ public:
 
       void_ptr p = static_cast<void_ptr>(
         static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
-      m_upstream->do_deallocate(
-        p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+      deallocate_upstream(p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+    }
+
+    // blocks split from a larger one live inside the upstream allocation of the first of them, so drop them from the
+    // list before any upstream memory is deallocated
+    for (oversized_block_descriptor_ptr alloc = m_oversized; ::cuda::std::to_address(alloc);)
+    {
+      oversized_block_descriptor desc = thrust::raw_reference_cast(*alloc);
+      if (::cuda::std::to_address(desc.prev_split))
+      {
+        unlink_oversized(desc);
+      }
+      alloc = desc.next;
     }
 
     // deallocate cached oversized/overaligned memory
@@ -238,113 +703,107 @@ public:
       oversized_block_descriptor desc = thrust::raw_reference_cast(*alloc);
 
       void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - desc.current_size);
-      m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      deallocate_upstream(p, desc.upstream_size, desc.alignment);
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    for (oversized_block_descriptor_ptr& head : m_cached_oversized)
+    {
+      head = oversized_block_descriptor_ptr();
+    }
+    m_statistics.cached_oversized_bytes = 0;
+    m_release_trigger                   = m_options.release_threshold;
   }
 
   [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    m_statistics.bytes_in_use += bytes;
+
     bytes = (std::max) (bytes, m_options.smallest_block_size);
     assert(::cuda::__is_valid_alignment(alignment));
 
     // an oversized and/or overaligned allocation requested; needs to be allocated separately
     if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
     {
+      ++m_statistics.oversized_allocations;
+
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (::cuda::std::to_address(ptr))
+        oversized_block_descriptor_ptr ptr = find_cached(bytes, alignment);
+        if (::cuda::std::to_address(ptr))
         {
           oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          erase_cached(desc);
+          ++m_statistics.oversized_hits;
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
-
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          if (is_good)
+          if (can_split(desc, bytes))
           {
-            if (previous != &m_cached_oversized)
-            {
-              *previous = desc.next_cached;
-            }
-            else
+            // the rest of the block keeps the descriptor at its end and stays cached
+            const std::size_t split_size    = ::cuda::round_up(bytes, desc.alignment);
+            oversized_block_descriptor rest = desc;
+            rest.size                       = desc.size - split_size - split_stride(desc.alignment);
+            rest.current_size               = rest.size;
+            rest.prev                       = oversized_block_descriptor_ptr();
+            rest.upstream_size              = 0;
+
+            desc.size       = split_size;
+            desc.next_split = ptr;
+            rest.prev_split = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            desc.current_size = bytes;
+            relink_oversized(rest.prev_split, desc);
+            *rest.prev_split = desc;
+
+            rest.next = m_oversized;
+            if (::cuda::std::to_address(rest.next))
             {
-              m_cached_oversized = desc.next_cached;
+              thrust::raw_reference_cast(*rest.next).prev = ptr;
             }
+            m_oversized = ptr;
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
+            insert_cached(ptr, rest);
+            *ptr = rest;
 
-            if (bytes != desc.size)
-            {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (::cuda::std::to_address(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (::cuda::std::to_address(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
-            }
+            m_statistics.block_bytes_in_use += desc.size;
+            return static_cast<void_ptr>(ret);
+          }
 
-            *ptr = desc;
+          if (bytes != desc.size)
+          {
+            desc.current_size = bytes;
 
-            return static_cast<void_ptr>(ret);
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+            relink_oversized(ptr, desc);
           }
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          *ptr = desc;
+
+          m_statistics.block_bytes_in_use += desc.size;
+          return static_cast<void_ptr>(ret);
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
-      void_ptr allocated = m_upstream->do_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
+      void_ptr allocated = allocate_upstream(bytes + sizeof(oversized_block_descriptor), alignment);
       oversized_block_descriptor_ptr block =
         static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + bytes));
 
       oversized_block_descriptor desc;
-      desc.size         = bytes;
-      desc.alignment    = alignment;
-      desc.prev         = oversized_block_descriptor_ptr();
-      desc.next         = m_oversized;
-      desc.next_cached  = oversized_block_descriptor_ptr();
-      desc.current_size = bytes;
-      *block            = desc;
-      m_oversized       = block;
+      desc.size          = bytes;
+      desc.alignment     = alignment;
+      desc.prev          = oversized_block_descriptor_ptr();
+      desc.next          = m_oversized;
+      desc.prev_cached   = oversized_block_descriptor_ptr();
+      desc.next_cached   = oversized_block_descriptor_ptr();
+      desc.current_size  = bytes;
+      desc.prev_split    = oversized_block_descriptor_ptr();
+      desc.next_split    = oversized_block_descriptor_ptr();
+      desc.upstream_size = bytes + sizeof(oversized_block_descriptor);
+      desc.cached        = false;
+      desc.cached_at     = 0;
+      *block             = desc;
+      m_oversized        = block;
 
       if (::cuda::std::to_address(desc.next))
       {
@@ -353,16 +812,16 @@ public:
         *desc.next                      = next;
       }
 
+      m_statistics.block_bytes_in_use += bytes;
       return allocated;
     }
 
     // the request is NOT for oversized and/or overaligned memory
     // allocate a block from an appropriate bucket
-    std::size_t bytes_log2 = ::cuda::ceil_ilog2(bytes);
-    std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
+    std::size_t bucket_idx = m_size_classes.index(bytes);
     pool& bucket           = thrust::raw_reference_cast(m_pools[bucket_idx]);
 
-    bytes = static_cast<std::size_t>(1) << bytes_log2;
+    bytes = m_size_classes.block_size(bucket_idx);
 
     // if the free list of the bucket has no elements, allocate a new chunk
     // and split it into blocks pushed to the free list
@@ -372,17 +831,17 @@ public:
       if (n == 0)
       {
         n = m_options.min_blocks_per_chunk;
-        if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+        if (n < m_options.min_bytes_per_chunk / bytes)
         {
-          n = m_options.min_bytes_per_chunk >> bytes_log2;
+          n = m_options.min_bytes_per_chunk / bytes;
         }
       }
       else
       {
         n = n * 3 / 2;
-        if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+        if (n > m_options.max_bytes_per_chunk / bytes)
         {
-          n = m_options.max_bytes_per_chunk >> bytes_log2;
+          n = m_options.max_bytes_per_chunk / bytes;
         }
         if (n > m_options.max_blocks_per_chunk)
         {
@@ -395,15 +854,21 @@ public:
       block_size += m_options.alignment - block_size % m_options.alignment;
       std::size_t chunk_size = block_size * n;
 
-      void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+      void_ptr allocated = allocate_upstream(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+      ++bucket.chunks;
+      bucket.blocks += n;
       chunk_descriptor_ptr chunk =
         static_cast<chunk_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + chunk_size));
 
       chunk_descriptor chunk_desc;
-      chunk_desc.size = chunk_size;
-      chunk_desc.next = m_allocated;
-      *chunk          = chunk_desc;
-      m_allocated     = chunk;
+      chunk_desc.size        = chunk_size;
+      chunk_desc.next        = m_allocated;
+      chunk_desc.bucket      = bucket_idx;
+      chunk_desc.blocks      = n;
+      chunk_desc.free_blocks = 0;
+      chunk_desc.released    = false;
+      *chunk                 = chunk_desc;
+      m_allocated            = chunk;
 
       for (std::size_t i = 0; i < n; ++i)
       {
@@ -412,6 +877,7 @@ public:
 
         block_descriptor block_desc;
         block_desc.next  = bucket.free_list;
+        block_desc.chunk = chunk;
         *block           = block_desc;
         bucket.free_list = block;
       }
@@ -420,11 +886,23 @@ public:
     // allocate a block from the front of the bucket's free list
     block_descriptor_ptr block = bucket.free_list;
     bucket.free_list           = thrust::raw_reference_cast(*block).next;
+
+    ++bucket.allocations;
+    m_statistics.block_bytes_in_use += bytes;
     return static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - bytes);
   }
 
   void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    do_deallocate_impl(p, n, alignment);
+    release_idle_memory();
+  }
+
+private:
+  void do_deallocate_impl(void_ptr p, std::size_t n, std::size_t alignment)
+  {
+    m_statistics.bytes_in_use -= n;
+
     n = (std::max) (n, m_options.smallest_block_size);
     assert(::cuda::__is_valid_alignment(alignment));
 
@@ -439,34 +917,62 @@ public:
 
       oversized_block_descriptor desc = *block;
       assert(desc.current_size == n);
-      assert(desc.alignment == alignment);
+      assert(desc.alignment >= alignment);
+
+      m_statistics.block_bytes_in_use -= desc.size;
 
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
-
         if (desc.size != n)
         {
           desc.current_size = desc.size;
           block =
             static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(p) + desc.size));
-          if (::cuda::std::to_address(desc.prev))
-          {
-            thrust::raw_reference_cast(*desc.prev).next = block;
-          }
-          else
+          relink_oversized(block, desc);
+        }
+
+        // merge the block with the cached blocks next to it that were split from the same upstream allocation; the
+        // merged block keeps the descriptor of the last of them
+        if (::cuda::std::to_address(desc.next_split) && thrust::raw_reference_cast(*desc.next_split).cached)
+        {
+          unlink_oversized(desc);
+
+          oversized_block_descriptor next = *desc.next_split;
+          erase_cached(next);
+
+          block              = desc.next_split;
+          next.size          = desc.size + split_stride(desc.alignment) + next.size;
+          next.current_size  = next.size;
+          next.prev_split    = desc.prev_split;
+          next.upstream_size = desc.upstream_size;
+          if (::cuda::std::to_address(next.prev_split))
           {
-            m_oversized = block;
+            thrust::raw_reference_cast(*next.prev_split).next_split = block;
           }
+          desc = next;
+        }
 
-          if (::cuda::std::to_address(desc.next))
+        if (::cuda::std::to_address(desc.prev_split) && thrust::raw_reference_cast(*desc.prev_split).cached)
+        {
+          *block = desc;
+
+          oversized_block_descriptor prev = *desc.prev_split;
+          erase_cached(prev);
+          unlink_oversized(prev);
+
+          desc               = *block;
+          desc.size          = prev.size + split_stride(desc.alignment) + desc.size;
+          desc.current_size  = desc.size;
+          desc.prev_split    = prev.prev_split;
+          desc.upstream_size = prev.upstream_size;
+          if (::cuda::std::to_address(desc.prev_split))
           {
-            thrust::raw_reference_cast(*desc.next).prev = block;
+            thrust::raw_reference_cast(*desc.prev_split).next_split = block;
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        insert_cached(block, desc);
+        *block = desc;
 
         return;
       }
@@ -485,24 +991,25 @@ public:
         thrust::raw_reference_cast(*desc.next).prev = desc.prev;
       }
 
-      m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      deallocate_upstream(p, desc.upstream_size, desc.alignment);
 
       return;
     }
 
     // push the block to the front of the appropriate bucket's free list
-    std::size_t n_log2     = ::cuda::ceil_ilog2(n);
-    std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
+    std::size_t bucket_idx = m_size_classes.index(n);
     pool& bucket           = thrust::raw_reference_cast(m_pools[bucket_idx]);
 
-    n = static_cast<std::size_t>(1) << n_log2;
+    n = m_size_classes.block_size(bucket_idx);
 
     block_descriptor_ptr block = static_cast<block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(p) + n));
 
-    block_descriptor desc;
-    desc.next        = bucket.free_list;
-    *block           = desc;
-    bucket.free_list = block;
+    // the chunk of the block is still in its descriptor
+    thrust::raw_reference_cast(*block).next = bucket.free_list;
+    bucket.free_list                        = block;
+
+    ++bucket.deallocations;
+    m_statistics.block_bytes_in_use -= n;
   }
 };
 
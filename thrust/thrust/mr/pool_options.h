@@ -20,9 +20,11 @@
 
 #include <thrust/detail/config/memory_resource.h>
 
+#include <cuda/__cmath/ilog.h>
 #include <cuda/__cmath/pow2.h>
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/cstddef>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -85,6 +87,39 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The number of size classes that every doubling of the block size is split into. With the default of 1, every
+   *      request is rounded up to a power of two, which wastes up to half of a block. With 4, the classes above a
+   *      power of two \c P are <tt>1.25 * P</tt>, <tt>1.5 * P</tt>, <tt>1.75 * P</tt> and <tt>2 * P</tt>, which wastes
+   *      at most a fifth of a block. Must be a power of two, and \p smallest_block_size divided by it must be a
+   *      multiple of \p alignment, so that every class is a multiple of the alignment.
+   */
+  std::size_t size_classes_per_doubling = 1;
+
+  /*! Decides whether a cached oversized block that is larger than needed for a request is split, handing out its front
+   *      and keeping the rest cached, and whether cached blocks that were split from the same upstream allocation are
+   *      merged again when they are deallocated. Only \p unsynchronized_pool_resource, and the resources that wrap it,
+   *      split blocks; it has no effect unless \p cache_oversized is true.
+   */
+  bool split_cached_oversized = false;
+
+  /*! The number of bytes held from upstream but not handed out above which a deallocation trims the pool, returning
+   *      cached oversized blocks and chunks with no blocks in use to upstream until at most this many bytes are held
+   *      idle. Memory still in use, and free blocks that share a chunk with it, cannot be returned; when trimming
+   *      leaves more than this many bytes idle, the pool is trimmed again only once that amount has grown by half,
+   *      or has fallen below the threshold in between. The default never trims. Only
+   *      \p unsynchronized_pool_resource, \p disjoint_unsynchronized_pool_resource, and the resources that wrap them,
+   *      trim automatically.
+   */
+  std::size_t release_threshold = ::cuda::std::numeric_limits<std::size_t>::max();
+
+  /*! If not zero, every this many deallocations the pool returns to upstream the cached oversized blocks that have not
+   *      been reused since the previous such check, and the chunks with no blocks in use of the size classes that had
+   *      no allocations since then, so that memory left behind by a spike decays after it has been idle for a while.
+   *      Only \p unsynchronized_pool_resource, \p disjoint_unsynchronized_pool_resource, and the resources that wrap
+   *      them, release idle memory.
+   */
+  std::size_t idle_release_interval = 0;
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consistent, false otherwise.
@@ -153,10 +188,79 @@ struct pool_options
       return false;
     }
 
+    if (size_classes_per_doubling == 0 || !::cuda::is_power_of_two(size_classes_per_doubling))
+    {
+      return false;
+    }
+    if (smallest_block_size % size_classes_per_doubling != 0)
+    {
+      return false;
+    }
+    if (alignment != 0 && (smallest_block_size / size_classes_per_doubling) % alignment != 0)
+    {
+      return false;
+    }
+
     return true;
   }
 };
 
+namespace detail
+{
+// Maps request sizes to the pools of a pooling resource. Pool 0 holds blocks of the smallest block size, and every
+// doubling above it is split into size_classes_per_doubling pools of evenly spaced block sizes, the last of which is
+// the next power of two.
+class pool_size_classes
+{
+public:
+  explicit pool_size_classes(const pool_options& options)
+      : m_smallest_block_log2(::cuda::ceil_ilog2(options.smallest_block_size))
+      , m_classes_per_doubling_log2(::cuda::ilog2(options.size_classes_per_doubling))
+      , m_count(
+          ((::cuda::ceil_ilog2(options.largest_block_size) - m_smallest_block_log2) << m_classes_per_doubling_log2) + 1)
+  {}
+
+  std::size_t count() const
+  {
+    return m_count;
+  }
+
+  // the pool serving requests of the given number of bytes, which must not exceed the largest block size
+  std::size_t index(std::size_t bytes) const
+  {
+    const std::size_t bytes_log2 = ::cuda::ceil_ilog2(bytes);
+    if (bytes_log2 <= m_smallest_block_log2)
+    {
+      return 0;
+    }
+
+    const std::size_t base_log2 = bytes_log2 - 1;
+    const std::size_t step_log2 = base_log2 - m_classes_per_doubling_log2;
+    const std::size_t offset    = bytes - (static_cast<std::size_t>(1) << base_log2);
+    return ((base_log2 - m_smallest_block_log2) << m_classes_per_doubling_log2) + ((offset - 1) >> step_log2) + 1;
+  }
+
+  // the size of the blocks in the given pool
+  std::size_t block_size(std::size_t index) const
+  {
+    if (index == 0)
+    {
+      return static_cast<std::size_t>(1) << m_smallest_block_log2;
+    }
+
+    const std::size_t base_log2 = m_smallest_block_log2 + ((index - 1) >> m_classes_per_doubling_log2);
+    const std::size_t mask      = (static_cast<std::size_t>(1) << m_classes_per_doubling_log2) - 1;
+    const std::size_t step      = ((index - 1) & mask) + 1;
+    return (static_cast<std::size_t>(1) << base_log2) + (step << (base_log2 - m_classes_per_doubling_log2));
+  }
+
+private:
+  std::size_t m_smallest_block_log2;
+  std::size_t m_classes_per_doubling_log2;
+  std::size_t m_count;
+};
+} // namespace detail
+
 /*! \} // memory_resources
  */
 } // namespace mr
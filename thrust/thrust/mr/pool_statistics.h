@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief Types reporting what the pooling resource adaptors are doing, to
+ *  help with tuning their options.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+
+#include <atomic>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Statistics of a single size class of a pooling resource adaptor, i.e. of the pool of blocks of a single size.
+ */
+struct pool_size_class_statistics
+{
+  /*! The size of the blocks of this size class. Requests are rounded up to this size.
+   */
+  std::size_t block_size;
+  /*! The number of blocks handed out.
+   */
+  std::size_t allocations;
+  /*! The number of blocks returned.
+   */
+  std::size_t deallocations;
+  /*! The number of chunks allocated from upstream. Every chunk was allocated for a request that found no free block,
+   *      so <tt>1 - chunks / allocations</tt> is the rate at which requests were served from free blocks.
+   */
+  std::size_t chunks;
+  /*! The number of blocks in all chunks allocated from upstream.
+   */
+  std::size_t blocks;
+};
+
+/*! Statistics of a pooling resource adaptor. The counters of allocations and deallocations accumulate over the lifetime
+ *      of the pool; \p release counts all blocks that are still allocated as deallocated.
+ *
+ *  <tt>block_bytes_in_use - bytes_in_use</tt> is the memory lost to rounding requests up to block sizes, and
+ *      <tt>upstream_bytes - block_bytes_in_use</tt> is the memory held by the pool that is not handed out, including
+ *      memory used for bookkeeping.
+ */
+struct pool_statistics
+{
+  /*! The number of allocations from the upstream resource.
+   */
+  std::size_t upstream_allocations;
+  /*! The number of deallocations to the upstream resource.
+   */
+  std::size_t upstream_deallocations;
+  /*! The number of bytes currently allocated from the upstream resource for chunks and oversized blocks.
+   */
+  std::size_t upstream_bytes;
+  /*! The largest value that \p upstream_bytes ever had.
+   */
+  std::size_t peak_upstream_bytes;
+
+  /*! The sum of the sizes of all requests that were allocated and not yet deallocated.
+   */
+  std::size_t bytes_in_use;
+  /*! The sum of the sizes of all blocks that were allocated and not yet deallocated.
+   */
+  std::size_t block_bytes_in_use;
+
+  /*! The number of oversized and overaligned requests.
+   */
+  std::size_t oversized_allocations;
+  /*! The number of oversized and overaligned requests served from cached blocks.
+   */
+  std::size_t oversized_hits;
+  /*! The number of bytes in cached oversized and overaligned blocks.
+   */
+  std::size_t cached_oversized_bytes;
+
+  /*! The statistics of every size class, from the smallest to the largest block size.
+   */
+  std::vector<pool_size_class_statistics> size_classes;
+};
+
+/*! \} // memory_resources
+ */
+
+namespace detail
+{
+// A counter that only a single thread ever changes, so that it can be incremented without a read-modify-write
+// instruction, while any thread can read it
+class single_writer_counter
+{
+public:
+  void add(std::size_t n)
+  {
+    m_value.store(m_value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  void raise(std::size_t n)
+  {
+    if (n > load())
+    {
+      m_value.store(n, std::memory_order_relaxed);
+    }
+  }
+
+  std::size_t load() const
+  {
+    return m_value.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<std::size_t> m_value{0};
+};
+} // namespace detail
+} // namespace mr
+THRUST_NAMESPACE_END
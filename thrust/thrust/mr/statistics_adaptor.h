@@ -0,0 +1,346 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A memory resource adaptor which counts the allocations and
+ *  deallocations made through it, and can record a trace of them.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/detail/thread_registry.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/pool_statistics.h>
+#include <thrust/mr/validator.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/__host_stdlib/algorithm>
+#include <cuda/std/__host_stdlib/ostream>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The number of bins of \p allocation_statistics::size_histogram.
+ */
+inline constexpr std::size_t allocation_size_histogram_bins = ::cuda::std::numeric_limits<std::size_t>::digits + 1;
+
+/*! Statistics of the allocations and deallocations made through a \p statistics_resource_adaptor.
+ */
+struct allocation_statistics
+{
+  /*! The number of allocations.
+   */
+  std::size_t allocations;
+  /*! The number of deallocations.
+   */
+  std::size_t deallocations;
+  /*! The sum of the sizes of all allocations.
+   */
+  std::size_t bytes_allocated;
+  /*! The sum of the sizes of all deallocations.
+   */
+  std::size_t bytes_deallocated;
+  /*! The sum of the sizes of all allocations that were not yet deallocated.
+   */
+  std::size_t bytes_in_use;
+  /*! The largest value that \p bytes_in_use ever had.
+   */
+  std::size_t peak_bytes_in_use;
+  /*! The size of the largest allocation.
+   */
+  std::size_t largest_allocation;
+  /*! The number of threads that used the adaptor.
+   */
+  std::size_t threads;
+  /*! The number of allocations by size: bin \c i counts the allocations of more than <tt>2^(i-1)</tt> and at most
+   *      <tt>2^i</tt> bytes, and bin 0 counts those of at most one byte.
+   */
+  std::size_t size_histogram[allocation_size_histogram_bins];
+};
+
+/*! An allocation or deallocation recorded by \p statistics_resource_adaptor.
+ */
+struct allocation_event
+{
+  /*! The position of the event among all events recorded by the adaptor.
+   */
+  std::uint64_t sequence;
+  /*! \c true for an allocation, \c false for a deallocation.
+   */
+  bool allocation;
+  /*! The address of the allocated or deallocated memory.
+   */
+  std::uintptr_t address;
+  /*! The size of the allocated or deallocated memory.
+   */
+  std::size_t bytes;
+  /*! The alignment of the allocated or deallocated memory.
+   */
+  std::size_t alignment;
+  /*! The index of the thread that made the allocation or deallocation, with threads numbered in the order in which
+   *      they first used the adaptor.
+   */
+  std::size_t thread;
+};
+
+/*! A memory resource adaptor that forwards all allocations and deallocations to \p Upstream and counts them, to find
+ *      out how a program uses memory, for instance to pick the \p pool_options of a pooling resource adaptor.
+ *
+ *  Every thread counts its own allocations and deallocations, so counting does not make threads wait for each other.
+ *      Only the number of bytes in use, and its peak, are shared by all threads, and cost one atomic operation per
+ *      allocation and deallocation.
+ *
+ *  The adaptor can also keep a trace of the most recent allocations and deallocations in a ring buffer of a fixed
+ *      capacity. Recording an event takes a lock, so the trace is disabled unless a capacity is given.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+class statistics_resource_adaptor final
+    : public memory_resource<typename Upstream::pointer>
+    , private validator<Upstream>
+{
+  using void_ptr = typename Upstream::pointer;
+  using lock_t   = std::lock_guard<std::mutex>; // NOLINT(modernize-use-scoped-lock)
+
+public:
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param trace_capacity the number of most recent events kept in the trace, 0 to disable the trace
+   */
+  statistics_resource_adaptor(Upstream* upstream, std::size_t trace_capacity = 0)
+      : m_upstream(upstream)
+      , m_id(detail::next_resource_id())
+      , m_trace(trace_capacity)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   */
+  statistics_resource_adaptor()
+      : statistics_resource_adaptor(get_global_resource<Upstream>())
+  {}
+
+  /*! Returns the statistics of all allocations and deallocations so far. The counters of every thread are read without
+   *      stopping the threads that use the adaptor, so the statistics are only consistent while no thread does.
+   */
+  allocation_statistics statistics() const
+  {
+    allocation_statistics ret = {};
+    ret.bytes_in_use          = m_bytes_in_use.load(std::memory_order_relaxed);
+    ret.peak_bytes_in_use     = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+
+    lock_t lock(m_threads_mutex); // NOLINT(modernize-use-scoped-lock)
+    ret.threads = m_threads.size();
+    for (const auto& counters : m_threads)
+    {
+      ret.allocations += counters->allocations.load();
+      ret.deallocations += counters->deallocations.load();
+      ret.bytes_allocated += counters->bytes_allocated.load();
+      ret.bytes_deallocated += counters->bytes_deallocated.load();
+      ret.largest_allocation = (std::max) (ret.largest_allocation, counters->largest_allocation.load());
+      for (std::size_t i = 0; i < allocation_size_histogram_bins; ++i)
+      {
+        ret.size_histogram[i] += counters->size_histogram[i].load();
+      }
+    }
+
+    return ret;
+  }
+
+  /*! Returns the recorded events, from the oldest to the most recent one.
+   */
+  std::vector<allocation_event> trace() const
+  {
+    lock_t lock(m_trace_mutex); // NOLINT(modernize-use-scoped-lock)
+
+    std::vector<allocation_event> ret;
+    const std::uint64_t first = m_trace_count - (std::min) (m_trace_count, static_cast<std::uint64_t>(m_trace.size()));
+    for (std::uint64_t i = first; i < m_trace_count; ++i)
+    {
+      ret.push_back(m_trace[i % m_trace.size()]);
+    }
+    return ret;
+  }
+
+  /*! Writes the statistics and the trace as a JSON object. Only the bins of the size histogram that are not empty are
+   *      written, each with the largest size it counts.
+   *
+   *  \param os the stream to write to
+   */
+  void write_json(std::ostream& os) const
+  {
+    const allocation_statistics stats = statistics();
+
+    os << "{\"allocations\":" << stats.allocations << ",\"deallocations\":" << stats.deallocations
+       << ",\"bytes_allocated\":" << stats.bytes_allocated << ",\"bytes_deallocated\":" << stats.bytes_deallocated
+       << ",\"bytes_in_use\":" << stats.bytes_in_use << ",\"peak_bytes_in_use\":" << stats.peak_bytes_in_use
+       << ",\"largest_allocation\":" << stats.largest_allocation << ",\"threads\":" << stats.threads
+       << ",\"size_histogram\":[";
+
+    bool first = true;
+    for (std::size_t i = 0; i < allocation_size_histogram_bins; ++i)
+    {
+      if (stats.size_histogram[i] == 0)
+      {
+        continue;
+      }
+
+      const std::size_t max_bytes = i < ::cuda::std::numeric_limits<std::size_t>::digits
+                                    ? static_cast<std::size_t>(1) << i
+                                    : ::cuda::std::numeric_limits<std::size_t>::max();
+      os << (first ? "" : ",") << "{\"max_bytes\":" << max_bytes << ",\"count\":" << stats.size_histogram[i] << "}";
+      first = false;
+    }
+
+    os << "],\"trace\":[";
+    first = true;
+    for (const allocation_event& event : trace())
+    {
+      os << (first ? "" : ",") << "{\"sequence\":" << event.sequence << ",\"event\":\""
+         << (event.allocation ? "allocate" : "deallocate") << "\",\"address\":" << event.address
+         << ",\"bytes\":" << event.bytes << ",\"alignment\":" << event.alignment << ",\"thread\":" << event.thread
+         << "}";
+      first = false;
+    }
+    os << "]}";
+  }
+
+  [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+
+    thread_counters& counters = get_thread_counters();
+    counters.allocations.add(1);
+    counters.bytes_allocated.add(bytes);
+    counters.largest_allocation.raise(bytes);
+    counters.size_histogram[bytes <= 1 ? 0 : ::cuda::ceil_ilog2(bytes)].add(1);
+
+    const std::size_t in_use = m_bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak         = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+    while (in_use > peak && !m_peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed))
+    {
+    }
+
+    record(true, ret, bytes, alignment, counters.index);
+    return ret;
+  }
+
+  void do_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    thread_counters& counters = get_thread_counters();
+    record(false, p, bytes, alignment, counters.index);
+
+    m_upstream->do_deallocate(p, bytes, alignment);
+
+    counters.deallocations.add(1);
+    counters.bytes_deallocated.add(bytes);
+    m_bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+private:
+  struct thread_counters
+  {
+    std::size_t index = 0;
+    detail::single_writer_counter allocations;
+    detail::single_writer_counter deallocations;
+    detail::single_writer_counter bytes_allocated;
+    detail::single_writer_counter bytes_deallocated;
+    detail::single_writer_counter largest_allocation;
+    detail::single_writer_counter size_histogram[allocation_size_histogram_bins];
+  };
+
+  // The adaptors own the counters of the threads, so that they outlive the threads
+  struct thread_counters_ref
+  {
+    std::weak_ptr<thread_counters> counters;
+    thread_counters* raw;
+
+    bool expired() const
+    {
+      return counters.expired();
+    }
+  };
+
+  thread_counters& get_thread_counters()
+  {
+    // the counters of this thread for all adaptors with this upstream type
+    static thread_local detail::thread_registry<thread_counters_ref> registry;
+
+    thread_counters_ref& ref = registry.get(m_id, [this] {
+      return make_thread_counters();
+    });
+    return *ref.raw;
+  }
+
+  std::unique_ptr<thread_counters_ref> make_thread_counters()
+  {
+    auto counters = std::make_shared<thread_counters>();
+    {
+      lock_t lock(m_threads_mutex); // NOLINT(modernize-use-scoped-lock)
+      counters->index = m_threads.size();
+      m_threads.push_back(counters);
+    }
+    return std::make_unique<thread_counters_ref>(thread_counters_ref{counters, counters.get()});
+  }
+
+  void record(bool allocation, void_ptr p, std::size_t bytes, std::size_t alignment, std::size_t thread)
+  {
+    if (m_trace.empty())
+    {
+      return;
+    }
+
+    allocation_event event;
+    event.allocation = allocation;
+    event.address    = reinterpret_cast<std::uintptr_t>(::cuda::std::to_address(p));
+    event.bytes      = bytes;
+    event.alignment  = alignment;
+    event.thread     = thread;
+
+    lock_t lock(m_trace_mutex); // NOLINT(modernize-use-scoped-lock)
+    event.sequence                           = m_trace_count;
+    m_trace[m_trace_count % m_trace.size()] = event;
+    ++m_trace_count;
+  }
+
+  Upstream* m_upstream;
+  std::uint64_t m_id;
+
+  std::atomic<std::size_t> m_bytes_in_use{0};
+  std::atomic<std::size_t> m_peak_bytes_in_use{0};
+
+  mutable std::mutex m_threads_mutex;
+  std::vector<std::shared_ptr<thread_counters>> m_threads;
+
+  mutable std::mutex m_trace_mutex;
+  std::vector<allocation_event> m_trace;
+  std::uint64_t m_trace_count = 0;
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -19,11 +19,8 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/random/uniform_real_distribution.h>
 
-#include <cuda/std/__cmath/logarithms.h>
-#include <cuda/std/__cmath/roots.h>
-#include <cuda/std/__cmath/trigonometric_functions.h>
+#include <cuda/std/__random/ziggurat.h>
 #include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
@@ -68,52 +65,46 @@ protected:
   _CCCL_HOST_DEVICE void reset() {}
 };
 
+// Thrust's engines expose min and max as static data members, while the Ziggurat method expects the interface of
+// a UniformRandomBitGenerator
+template <typename UniformRandomNumberGenerator>
+struct ziggurat_urng_adaptor
+{
+  using result_type = typename UniformRandomNumberGenerator::result_type;
+
+  UniformRandomNumberGenerator& urng;
+
+  _CCCL_HOST_DEVICE static constexpr result_type min()
+  {
+    return UniformRandomNumberGenerator::min;
+  }
+  _CCCL_HOST_DEVICE static constexpr result_type max()
+  {
+    return UniformRandomNumberGenerator::max;
+  }
+  _CCCL_HOST_DEVICE result_type operator()()
+  {
+    return urng();
+  }
+};
+
 // this version samples the normal distribution using
-// Marsaglia's "polar method"
+// the Ziggurat method of Marsaglia and Tsang
 template <typename RealType>
-class normal_distribution_portable
+class normal_distribution_ziggurat
 {
 protected:
-  void reset()
-  {
-    m_valid = false;
-  }
+  // no-op
+  _CCCL_HOST_DEVICE void reset() {}
 
-  // note that we promise to call this member function with the same mean and stddev
   template <typename UniformRandomNumberGenerator>
   _CCCL_HOST_DEVICE RealType sample(UniformRandomNumberGenerator& urng, const RealType mean, const RealType stddev)
   {
-    // implementation from Boost
-    // allow for Koenig lookup
-    using ::cuda::std::cos;
-    using ::cuda::std::log;
-    using ::cuda::std::sin;
-    using ::cuda::std::sqrt;
-
-    if (!m_valid)
-    {
-      uniform_real_distribution<RealType> u01;
-      m_r1         = u01(urng);
-      m_r2         = u01(urng);
-      m_cached_rho = sqrt(-RealType(2) * log(RealType(1) - m_r2));
-
-      m_valid = true;
-    }
-    else
-    {
-      m_valid = false;
-    }
-
-    const RealType pi = RealType(3.14159265358979323846);
-
-    RealType result = m_cached_rho * (m_valid ? cos(RealType(2) * pi * m_r1) : sin(RealType(2) * pi * m_r1));
-
-    return mean + stddev * result;
+    using adaptor_type = ziggurat_urng_adaptor<UniformRandomNumberGenerator>;
+    adaptor_type adaptor{urng};
+    ::cuda::std::__ziggurat_bits<adaptor_type> bits{adaptor, 64};
+    return mean + stddev * static_cast<RealType>(::cuda::std::__ziggurat_normal(bits));
   }
-
-private:
-  RealType m_r1{}, m_r2{}, m_cached_rho{};
-  bool m_valid{false};
 };
 
 template <typename RealType>
@@ -123,7 +114,7 @@ struct normal_distribution_base
   using type = normal_distribution_nvcc<RealType>;
 #else // ^^^ _CCCL_CUDA_COMPILATION() && !_CCCL_CUDA_COMPILER(NVHPC) ^^^ /
       // vvv !_CCCL_CUDA_COMPILATION() || _CCCL_CUDA_COMPILER(NVHPC) vvv
-  using type = normal_distribution_portable<RealType>;
+  using type = normal_distribution_ziggurat<RealType>;
 #endif // ^^^ !_CCCL_CUDA_COMPILATION() || _CCCL_CUDA_COMPILER(NVHPC) ^^^
 };
 } // namespace random::detail
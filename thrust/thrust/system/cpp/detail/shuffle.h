@@ -0,0 +1,330 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief Host implementation of shuffle and shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/random/uniform_int_distribution.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/__random/generate.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__random/philox_engine.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::cpp::detail
+{
+namespace shuffle_detail
+{
+// The input is split into chunks, whose elements are scattered to buckets chosen uniformly at random. Every bucket is
+// then shuffled on its own with Fisher-Yates, which results in a uniformly random permutation. The scatter writes to
+// one sequential stream per bucket, and the buckets are small enough to be shuffled in cache, unlike a gather from
+// random positions of the whole input.
+//
+// The number of buckets is bounded, since every chunk writes to one stream per bucket, so the buckets grow beyond
+// bucket_size elements for more than max_buckets * bucket_size elements. A bucket of more than max_bucket_size elements
+// is scattered once more to buckets of its own before they are shuffled, which bounds the size of the shuffled buckets
+// for any number of elements.
+//
+// Every chunk and every bucket draws from its own stream of a Philox engine, whose key is drawn from the URBG of the
+// caller. The number of chunks and buckets only depends on the number of elements, so the permutation does not depend
+// on the number of threads that process them.
+constexpr std::size_t chunk_granularity = std::size_t{1} << 16;
+constexpr std::size_t max_chunks        = 256;
+constexpr std::size_t bucket_size       = std::size_t{1} << 15;
+constexpr std::size_t max_buckets       = 1024;
+
+// The second scatter costs another pass over the elements, so it is only worth it for buckets that are far too large
+// for the cache
+constexpr std::size_t max_bucket_size = bucket_size << 4;
+
+// Seeds the key of the engine, in the form of a seed sequence
+struct key_sequence
+{
+  std::uint32_t words[2];
+
+  template <typename Iterator>
+  void generate(Iterator first, Iterator last) const
+  {
+    for (const std::uint32_t* word = words; first != last; ++first, ++word)
+    {
+      *first = *word;
+    }
+  }
+};
+
+// Draws uniform integers from a stream of the engine, with Lemire's multiply and reject method
+class random_source
+{
+  using engine = ::cuda::std::philox4x32;
+
+  static constexpr std::size_t buffer_size = 256;
+
+  engine m_engine;
+  engine::result_type m_buffer[buffer_size];
+  std::size_t m_next = buffer_size;
+
+public:
+  random_source(key_sequence key, std::uint64_t stream)
+      : m_engine(key)
+  {
+    m_engine.set_counter({0, static_cast<std::uint32_t>(stream >> 32), static_cast<std::uint32_t>(stream), 0});
+  }
+
+  // Returns 32 random bits
+  std::uint32_t next()
+  {
+    if (m_next == buffer_size)
+    {
+      ::cuda::generate(m_engine, ::cuda::std::span<engine::result_type>{m_buffer});
+      m_next = 0;
+    }
+    return static_cast<std::uint32_t>(m_buffer[m_next++]);
+  }
+
+  // Returns a value in [0, bound)
+  std::uint64_t below(std::uint64_t bound)
+  {
+    if (bound <= 0xFFFFFFFFull)
+    {
+      const auto bound32 = static_cast<std::uint32_t>(bound);
+      std::uint64_t m    = std::uint64_t{next()} * bound32;
+      if (static_cast<std::uint32_t>(m) < bound32)
+      {
+        const std::uint32_t threshold = static_cast<std::uint32_t>(0u - bound32) % bound32;
+        while (static_cast<std::uint32_t>(m) < threshold)
+        {
+          m = std::uint64_t{next()} * bound32;
+        }
+      }
+      return m >> 32;
+    }
+    std::uint64_t x = (std::uint64_t{next()} << 32) | next();
+    if (x * bound < bound)
+    {
+      const std::uint64_t threshold = (0ull - bound) % bound;
+      while (x * bound < threshold)
+      {
+        x = (std::uint64_t{next()} << 32) | next();
+      }
+    }
+    return ::cuda::mul_hi(x, bound);
+  }
+};
+
+using decomposition = thrust::system::detail::internal::uniform_decomposition<std::size_t>;
+
+// Counts the elements of every chunk that go to each bucket
+struct count_op
+{
+  key_sequence key;
+  decomposition chunks;
+  std::size_t num_buckets;
+  std::size_t* counts;
+
+  void operator()(std::size_t chunk) const
+  {
+    random_source source(key, chunk);
+    std::size_t* chunk_counts = counts + chunk * num_buckets;
+    for (std::size_t i = chunks[chunk].begin(); i < chunks[chunk].end(); ++i)
+    {
+      ++chunk_counts[source.below(num_buckets)];
+    }
+  }
+};
+
+// Draws the same buckets as count_op, and writes every element to the next position of its bucket
+template <typename RandomIterator, typename OutputIterator>
+struct scatter_op
+{
+  key_sequence key;
+  decomposition chunks;
+  std::size_t num_buckets;
+  std::size_t* offsets;
+  RandomIterator first;
+  OutputIterator result;
+
+  void operator()(std::size_t chunk) const
+  {
+    random_source source(key, chunk);
+    std::size_t* chunk_offsets = offsets + chunk * num_buckets;
+    for (std::size_t i = chunks[chunk].begin(); i < chunks[chunk].end(); ++i)
+    {
+      result[chunk_offsets[source.below(num_buckets)]++] = first[i];
+    }
+  }
+};
+
+// Shuffles the n elements at first. The elements of a bucket that is too large to be shuffled in cache are scattered to
+// buckets of their own first. Their number is a power of two, so that every draw picks the buckets of several elements.
+template <typename OutputIterator, typename ValueType>
+void shuffle_bucket(random_source& source, OutputIterator first, std::size_t n)
+{
+  if (n > max_bucket_size)
+  {
+    int bits = 1;
+    while ((bucket_size << bits) < n && (std::size_t{1} << bits) < max_buckets)
+    {
+      ++bits;
+    }
+    const std::size_t num_buckets = std::size_t{1} << bits;
+    const std::uint32_t mask      = static_cast<std::uint32_t>(num_buckets - 1);
+
+    std::vector<std::size_t> offsets(num_buckets + 1, 0);
+    std::vector<std::uint16_t> buckets(n);
+    for (std::size_t i = 0; i < n;)
+    {
+      std::uint32_t word = source.next();
+      for (int k = 0; k < 32 / bits && i < n; ++k, ++i, word >>= bits)
+      {
+        buckets[i] = static_cast<std::uint16_t>(word & mask);
+        ++offsets[buckets[i] + 1];
+      }
+    }
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      offsets[bucket + 1] += offsets[bucket];
+    }
+    const std::vector<std::size_t> begins = offsets;
+
+    std::vector<ValueType> values(first, first + n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      first[offsets[buckets[i]]++] = values[i];
+    }
+
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      shuffle_bucket<OutputIterator, ValueType>(source, first + begins[bucket], begins[bucket + 1] - begins[bucket]);
+    }
+    return;
+  }
+
+  for (std::size_t i = n; i > 1; --i)
+  {
+    const std::size_t j = source.below(i);
+    ValueType tmp       = first[i - 1];
+    first[i - 1]        = first[j];
+    first[j]            = tmp;
+  }
+}
+
+// Shuffles the elements of a bucket
+template <typename OutputIterator, typename ValueType>
+struct shuffle_bucket_op
+{
+  key_sequence key;
+  const std::size_t* bucket_begins;
+  OutputIterator result;
+
+  void operator()(std::size_t bucket) const
+  {
+    random_source source(key, max_chunks + bucket);
+    shuffle_bucket<OutputIterator, ValueType>(
+      source, result + bucket_begins[bucket], bucket_begins[bucket + 1] - bucket_begins[bucket]);
+  }
+};
+} // namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  using namespace shuffle_detail;
+  using value_type = thrust::detail::it_value_t<RandomIterator>;
+
+  key_sequence key;
+  thrust::uniform_int_distribution<std::uint32_t> dist;
+  for (auto& word : key.words)
+  {
+    word = dist(g);
+  }
+
+  const auto n                   = static_cast<std::size_t>(last - first);
+  const std::size_t num_buckets  = ::cuda::std::min(max_buckets, (n + bucket_size - 1) / bucket_size);
+  const decomposition chunks(n, chunk_granularity, max_chunks);
+  const std::size_t num_chunks = chunks.size();
+
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> bucket_begins(exec, num_buckets + 1);
+  std::size_t* begins = thrust::raw_pointer_cast(bucket_begins.data());
+  begins[0]           = 0;
+  begins[num_buckets] = n;
+
+  if (num_buckets <= 1)
+  {
+    thrust::copy(exec, first, last, result);
+  }
+  else
+  {
+    // The offsets of every chunk in every bucket, ordered by bucket and then by chunk
+    thrust::detail::temporary_array<std::size_t, DerivedPolicy> offsets(exec, num_chunks * num_buckets);
+    std::size_t* counts = thrust::raw_pointer_cast(offsets.data());
+    for (std::size_t i = 0; i < num_chunks * num_buckets; ++i)
+    {
+      counts[i] = 0;
+    }
+
+    thrust::counting_iterator<std::size_t> indices(0);
+    thrust::for_each_n(exec, indices, num_chunks, count_op{key, chunks, num_buckets, counts});
+
+    std::size_t offset = 0;
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      begins[bucket] = offset;
+      for (std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+      {
+        const std::size_t count               = counts[chunk * num_buckets + bucket];
+        counts[chunk * num_buckets + bucket] = offset;
+        offset += count;
+      }
+    }
+
+    thrust::for_each_n(exec,
+                       indices,
+                       num_chunks,
+                       scatter_op<RandomIterator, OutputIterator>{key, chunks, num_buckets, counts, first, result});
+  }
+
+  thrust::for_each_n(exec,
+                     thrust::counting_iterator<std::size_t>(0),
+                     num_buckets,
+                     shuffle_bucket_op<OutputIterator, value_type>{key, begins, result});
+}
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  using InputType = thrust::detail::it_value_t<RandomIterator>;
+
+  // copy input to temp buffer
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+  cpp::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+}
+} // end namespace system::cpp::detail
+THRUST_NAMESPACE_END
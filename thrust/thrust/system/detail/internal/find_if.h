@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file find_if.h
+ *  \brief Early exit search shared by the parallel host backends.
+ *
+ *  The input is cut into fixed size chunks which the workers claim in
+ *  ascending order from a shared counter. A worker that finds a match
+ *  publishes its index through an atomic minimum. Because chunks are claimed
+ *  in order, every chunk behind the lowest published match is never started
+ *  and a chunk in flight stops as soon as it passes that match. The backends
+ *  only launch one worker per thread.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstdint>
+
+#include <atomic>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace find_if_detail
+{
+// Small enough that a worker does not scan far past a match found by another worker, large enough that claiming a chunk
+// is negligible
+inline constexpr ::cuda::std::int64_t elements_per_chunk = 1 << 12;
+} // namespace find_if_detail
+
+template <typename RandomAccessIterator, typename Predicate>
+class find_if_chunks
+{
+public:
+  find_if_chunks(RandomAccessIterator first, ::cuda::std::int64_t n, Predicate pred)
+      : first(first)
+      , n(n)
+      , num_chunks(::cuda::ceil_div(n, find_if_detail::elements_per_chunk))
+      , pred{pred}
+      , next_chunk(0)
+      , found(n)
+  {}
+
+  find_if_chunks(const find_if_chunks&)            = delete;
+  find_if_chunks& operator=(const find_if_chunks&) = delete;
+
+  // the number of workers that can make progress at the same time
+  ::cuda::std::int64_t max_workers() const
+  {
+    return num_chunks;
+  }
+
+  // the lowest index of a match, n if there is none
+  ::cuda::std::int64_t result() const
+  {
+    return found.load(std::memory_order_relaxed);
+  }
+
+  // claims chunks until the input is exhausted or the lowest match lies in front of the next chunk
+  void operator()()
+  {
+    for (;;)
+    {
+      const ::cuda::std::int64_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= num_chunks)
+      {
+        return;
+      }
+
+      ::cuda::std::int64_t i         = chunk * find_if_detail::elements_per_chunk;
+      const ::cuda::std::int64_t end = (::cuda::std::min) (i + find_if_detail::elements_per_chunk, n);
+
+      RandomAccessIterator iter = first + i;
+      for (; i != end; ++i, ++iter)
+      {
+        if (result() < i)
+        {
+          return;
+        }
+        if (pred(*iter))
+        {
+          publish(i);
+          return;
+        }
+      }
+    }
+  }
+
+private:
+  void publish(::cuda::std::int64_t i)
+  {
+    ::cuda::std::int64_t expected = found.load(std::memory_order_relaxed);
+    while (i < expected && !found.compare_exchange_weak(expected, i, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  RandomAccessIterator first;
+  ::cuda::std::int64_t n;
+  ::cuda::std::int64_t num_chunks;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+  std::atomic<::cuda::std::int64_t> next_chunk;
+  std::atomic<::cuda::std::int64_t> found;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file merge_path.h
+ *  \brief Merge path partitioning shared by the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Returns the number of elements of [a, a + a_size) among the first `diag`
+// elements of the stable merge of [a, a + a_size) and [b, b + b_size).
+// Equivalent elements are taken from a first, which matches thrust::merge.
+template <typename Iterator1, typename Iterator2, typename Size, typename StrictWeakOrdering>
+Size merge_path(Iterator1 a, Size a_size, Iterator2 b, Size b_size, Size diag, StrictWeakOrdering comp)
+{
+  Size lo = ::cuda::std::max(Size{0}, diag - b_size);
+  Size hi = ::cuda::std::min(diag, a_size);
+
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+
+    if (comp(b[diag - 1 - mid], a[mid]))
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
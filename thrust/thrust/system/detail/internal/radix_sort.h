@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file radix_sort.h
+ *  \brief Building blocks of the LSD radix sort shared by the parallel host backends.
+ *
+ *  The input is split into contiguous chunks, one per worker. Each pass over a
+ *  digit counts the digits of every chunk, scans the counts in digit-major,
+ *  chunk-minor order and lets every worker scatter its own chunk, which keeps
+ *  the sort stable. The backends only provide the parallel loop over chunks.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace radix_sort_detail
+{
+template <::cuda::std::size_t KeySize>
+struct unsigned_bits;
+
+template <>
+struct unsigned_bits<1>
+{
+  using type = ::cuda::std::uint8_t;
+};
+
+template <>
+struct unsigned_bits<2>
+{
+  using type = ::cuda::std::uint16_t;
+};
+
+template <>
+struct unsigned_bits<4>
+{
+  using type = ::cuda::std::uint32_t;
+};
+
+template <>
+struct unsigned_bits<8>
+{
+  using type = ::cuda::std::uint64_t;
+};
+} // namespace radix_sort_detail
+
+// Each pass sorts one byte of the encoded key
+inline constexpr int radix_bits    = 8;
+inline constexpr int radix_buckets = 1 << radix_bits;
+
+// Maps a key to an unsigned integer whose natural ordering matches the
+// requested key ordering. Descending order is obtained by complementing the
+// bits, which keeps the sort stable without reversing the result.
+template <typename KeyType, bool Descending>
+struct radix_key_encoder
+{
+  using bits_type = typename radix_sort_detail::unsigned_bits<sizeof(KeyType)>::type;
+
+  static constexpr int num_passes = static_cast<int>(8 * sizeof(bits_type) / radix_bits);
+
+  bits_type operator()(KeyType key) const
+  {
+    bits_type bits;
+
+    if constexpr (::cuda::std::is_floating_point_v<KeyType>)
+    {
+      bits = static_cast<bits_type>(sequential::radix_sort_detail::RadixEncoder<KeyType>{}(key));
+    }
+    else if constexpr (::cuda::std::is_signed_v<KeyType>)
+    {
+      bits = static_cast<bits_type>(static_cast<bits_type>(key) ^ (bits_type{1} << (8 * sizeof(KeyType) - 1)));
+    }
+    else
+    {
+      bits = static_cast<bits_type>(key);
+    }
+
+    if constexpr (Descending)
+    {
+      bits = static_cast<bits_type>(~bits);
+    }
+
+    return bits;
+  }
+
+  int digit(KeyType key, int shift) const
+  {
+    return static_cast<int>((operator()(key) >> shift) & (radix_buckets - 1));
+  }
+
+  // varying_bits has a bit set for every bit that differs between two keys
+  static bool pass_is_trivial(bits_type varying_bits, int shift)
+  {
+    return ((varying_bits >> shift) & (radix_buckets - 1)) == 0;
+  }
+};
+
+// Accumulates the bits set in every key (and_bits) and in any key (or_bits) of
+// [begin, end). A digit for which (and_bits ^ or_bits) is zero is the same in
+// every key, so its pass can be skipped.
+template <typename Encoder, typename KeyIterator, typename Size>
+void radix_reduce_bits(
+  Encoder encode,
+  KeyIterator keys,
+  Size begin,
+  Size end,
+  typename Encoder::bits_type& and_bits,
+  typename Encoder::bits_type& or_bits)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    const auto x = encode(keys[i]);
+    and_bits &= x;
+    or_bits |= x;
+  }
+}
+
+template <typename Encoder, typename KeyIterator, typename Size>
+void radix_count(Encoder encode, KeyIterator keys, Size begin, Size end, int shift, ::cuda::std::size_t* histogram)
+{
+  for (int b = 0; b < radix_buckets; ++b)
+  {
+    histogram[b] = 0;
+  }
+
+  for (Size i = begin; i < end; ++i)
+  {
+    ++histogram[encode.digit(keys[i], shift)];
+  }
+}
+
+// Replaces the per-chunk counts in histograms[chunk * radix_buckets + digit]
+// with the output offset of the chunk's first element of that digit.
+inline void radix_scan_histograms(::cuda::std::size_t* histograms, ::cuda::std::size_t num_chunks)
+{
+  ::cuda::std::size_t sum = 0;
+
+  for (int b = 0; b < radix_buckets; ++b)
+  {
+    for (::cuda::std::size_t c = 0; c < num_chunks; ++c)
+    {
+      const ::cuda::std::size_t count = histograms[c * radix_buckets + b];
+      histograms[c * radix_buckets + b] = sum;
+      sum += count;
+    }
+  }
+}
+
+template <bool HasValues,
+          typename Encoder,
+          typename KeyIterator1,
+          typename ValueIterator1,
+          typename KeyIterator2,
+          typename ValueIterator2,
+          typename Size>
+void radix_scatter(
+  Encoder encode,
+  KeyIterator1 keys_in,
+  ValueIterator1 vals_in,
+  Size begin,
+  Size end,
+  int shift,
+  ::cuda::std::size_t* histogram,
+  KeyIterator2 keys_out,
+  ValueIterator2 vals_out)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    const ::cuda::std::size_t dst = histogram[encode.digit(keys_in[i], shift)]++;
+
+    keys_out[dst] = keys_in[i];
+    if constexpr (HasValues)
+    {
+      vals_out[dst] = vals_in[i];
+    }
+  }
+}
+
+template <bool HasValues,
+          typename KeyIterator1,
+          typename ValueIterator1,
+          typename KeyIterator2,
+          typename ValueIterator2,
+          typename Size>
+void radix_copy(
+  KeyIterator1 keys_in, ValueIterator1 vals_in, Size begin, Size end, KeyIterator2 keys_out, ValueIterator2 vals_out)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    keys_out[i] = keys_in[i];
+    if constexpr (HasValues)
+    {
+      vals_out[i] = vals_in[i];
+    }
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
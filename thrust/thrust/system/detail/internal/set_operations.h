@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file set_operations.h
+ *  \brief Building blocks of the set operations shared by the parallel host backends.
+ *
+ *  Both inputs are split into one partition per worker along evenly spaced
+ *  diagonals of the merge of the inputs. Every partition computes the size of
+ *  its output with the sequential algorithm, the sizes are scanned and every
+ *  partition runs the sequential algorithm again to write its output directly
+ *  to its final position. The backends only provide the parallel loop over
+ *  partitions.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/binary_search.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace set_operations_detail
+{
+template <typename Iterator1, typename Iterator2, typename Iterator3, typename Size, typename StrictWeakOrdering>
+::cuda::std::pair<Size, Size> balance_split(
+  Iterator1 a, Size a_size, Iterator2 b, Size b_size, Size a_split, Size b_split, Iterator3 x, StrictWeakOrdering comp)
+{
+  // the copies of *x are at the end of the prefixes and the start of the suffixes
+  const Size a_first = thrust::lower_bound(thrust::seq, a, a + a_split, *x, comp) - a;
+  const Size b_first = thrust::lower_bound(thrust::seq, b, b + b_split, *x, comp) - b;
+  const Size a_count = thrust::upper_bound(thrust::seq, a + a_split, a + a_size, *x, comp) - a - a_first;
+  const Size b_count = thrust::upper_bound(thrust::seq, b + b_split, b + b_size, *x, comp) - b - b_first;
+
+  // the number of copies in front of the split
+  const Size before  = (a_split - a_first) + (b_split - b_first);
+  const Size matched = ::cuda::std::min(a_count, b_count);
+
+  Size a_before;
+  Size b_before;
+
+  if (before <= 2 * matched)
+  {
+    // keep the matched copies in pairs, the partition may shrink by one
+    a_before = before / 2;
+    b_before = before / 2;
+  }
+  else if (a_count > b_count)
+  {
+    b_before = b_count;
+    a_before = before - b_count;
+  }
+  else
+  {
+    a_before = a_count;
+    b_before = before - a_count;
+  }
+
+  return ::cuda::std::make_pair(a_first + a_before, b_first + b_before);
+}
+} // namespace set_operations_detail
+
+// Like merge_path, but returns the split of both inputs at diagonal `diag`
+// (or `diag - 1`), rebalanced within a run of equivalent elements so that the
+// k-th copy of an element in [a, a + a_size) and the k-th equivalent copy in
+// [b, b + b_size) end up in the same partition. The set operations match
+// equivalent elements this way, so every partition can be processed
+// independently. The splits returned for increasing diagonals are monotonic.
+template <typename Iterator1, typename Iterator2, typename Size, typename StrictWeakOrdering>
+::cuda::std::pair<Size, Size>
+balanced_path(Iterator1 a, Size a_size, Iterator2 b, Size b_size, Size diag, StrictWeakOrdering comp)
+{
+  const Size a_split = merge_path(a, a_size, b, b_size, diag, comp);
+  const Size b_split = diag - a_split;
+
+  if (a_split == a_size && b_split == b_size)
+  {
+    return ::cuda::std::make_pair(a_split, b_split);
+  }
+
+  // rebalance the run of the element which follows the split in the merged order
+  if (a_split < a_size && (b_split == b_size || !comp(b[b_split], a[a_split])))
+  {
+    return set_operations_detail::balance_split(a, a_size, b, b_size, a_split, b_split, a + a_split, comp);
+  }
+
+  return set_operations_detail::balance_split(a, a_size, b, b_size, a_split, b_split, b + b_split, comp);
+}
+
+// The sequential set operations run on every partition
+struct serial_set_difference
+{
+  template <typename InputIterator1,
+            typename InputIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename InputIterator1,
+            typename InputIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename InputIterator1,
+            typename InputIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename InputIterator1,
+            typename InputIterator2,
+            typename OutputIterator,
+            typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+// Returns the size of the output of set_op on the given partition
+template <typename SetOperation,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+Size set_operation_count(
+  SetOperation set_op,
+  InputIterator1 first1,
+  Size a_begin,
+  Size a_end,
+  InputIterator2 first2,
+  Size b_begin,
+  Size b_end,
+  StrictWeakOrdering comp)
+{
+  const auto discard = thrust::make_discard_iterator();
+
+  return static_cast<Size>(
+    set_op(first1 + a_begin, first1 + a_end, first2 + b_begin, first2 + b_end, discard, comp) - discard);
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -13,12 +13,130 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace copy_if_detail
+{
+// Below this many elements per chunk the parallel overhead dominates
+inline constexpr size_t min_elements_per_chunk = 1024;
+
+// Stream compaction in two passes over the input and O(threads) extra memory:
+// the input is split into one chunk per thread, every chunk counts its
+// selected elements, the counts are scanned and every chunk writes its
+// elements directly to their final position.
+//
+// The elements of [first, first + n) for which pred(stencil[i]) holds are
+// copied to out_true. If WriteFalse, the other elements are copied to
+// out_false, or right behind the selected elements in out_true if
+// FalseFollowsTrue. Returns the number of selected elements.
+template <bool WriteFalse,
+          bool FalseFollowsTrue,
+          typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename Predicate>
+Size partition_copy_n(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  Size n,
+  InputIterator2 stencil,
+  OutputIterator1 out_true,
+  [[maybe_unused]] OutputIterator2 out_false,
+  Predicate pred)
+{
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  const Size num_chunks = static_cast<Size>(::cuda::std::min<size_t>(
+    static_cast<size_t>(omp_get_max_threads()), ::cuda::ceil_div(static_cast<size_t>(n), min_elements_per_chunk)));
+  const Size chunk_size = ::cuda::ceil_div(n, num_chunks);
+
+  // counts[c + 1] is the number of selected elements in chunk c
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts_storage(exec, num_chunks + 1);
+  Size* counts = thrust::raw_pointer_cast(counts_storage.data());
+
+  // 1. count the selected elements of every chunk
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size c = 0; c < num_chunks; ++c)
+  {
+    const Size begin = ::cuda::std::min(n, c * chunk_size);
+    const Size end   = ::cuda::std::min(n, begin + chunk_size);
+
+    Size count = 0;
+    for (Size i = begin; i < end; ++i)
+    {
+      if (wrapped_pred(stencil[i]))
+      {
+        ++count;
+      }
+    }
+    counts[c + 1] = count;
+  }
+
+  // 2. scan the counts to find each chunk's output offset
+  counts[0] = 0;
+  for (Size c = 0; c < num_chunks; ++c)
+  {
+    counts[c + 1] += counts[c];
+  }
+
+  const Size num_true = counts[num_chunks];
+
+  // 3. every chunk writes its elements to their final position
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size c = 0; c < num_chunks; ++c)
+  {
+    const Size begin = ::cuda::std::min(n, c * chunk_size);
+    const Size end   = ::cuda::std::min(n, begin + chunk_size);
+
+    Size true_idx  = counts[c];
+    Size false_idx = begin - counts[c];
+    if constexpr (FalseFollowsTrue)
+    {
+      false_idx += num_true;
+    }
+
+    for (Size i = begin; i < end; ++i)
+    {
+      if (wrapped_pred(stencil[i]))
+      {
+        out_true[true_idx++] = first[i];
+      }
+      else if constexpr (WriteFalse)
+      {
+        if constexpr (FalseFollowsTrue)
+        {
+          out_true[false_idx++] = first[i];
+        }
+        else
+        {
+          out_false[false_idx++] = first[i];
+        }
+      }
+    }
+  }
+
+  return num_true;
+}
+} // namespace copy_if_detail
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -32,8 +150,16 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  using difference_type = thrust::detail::it_difference_t<InputIterator1>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  return result + copy_if_detail::partition_copy_n<false, false>(exec, first, n, stencil, result, result, pred);
 } // end copy_if()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -17,17 +17,44 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/find.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/find_if.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+// find_if_not, mismatch, all_of, any_of and none_of are implemented in terms of find_if, so they exit early as well
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
-InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
+InputIterator find_if(execution_policy<DerivedPolicy>&, InputIterator first, InputIterator last, Predicate pred)
 {
-  // omp prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  using namespace thrust::system::detail::internal;
+
+  const ::cuda::std::int64_t n = ::cuda::std::distance(first, last);
+
+  find_if_chunks<InputIterator, Predicate> chunks(first, n, pred);
+
+  const int num_threads = static_cast<int>(
+    (::cuda::std::min) (static_cast<::cuda::std::int64_t>(omp_get_max_threads()), chunks.max_workers()));
+
+  if (num_threads <= 1)
+  {
+    chunks();
+  }
+  else
+  {
+    THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
+    chunks();
+  }
+
+  return first + static_cast<thrust::detail::it_difference_t<InputIterator>>(chunks.result());
 }
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
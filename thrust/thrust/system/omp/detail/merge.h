@@ -13,5 +13,155 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits merge
-#include <thrust/system/cpp/detail/merge.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace merge_detail
+{
+// Below this many output elements per partition the parallel overhead dominates
+inline constexpr size_t min_elements_per_partition = 1 << 13;
+
+template <typename Size>
+Size num_partitions(Size n)
+{
+  return static_cast<Size>(::cuda::std::min<size_t>(
+    static_cast<size_t>(omp_get_max_threads()), ::cuda::ceil_div(static_cast<size_t>(n), min_elements_per_partition)));
+}
+} // namespace merge_detail
+
+// The output is split into one equally sized partition per thread. Every
+// partition finds the elements of both inputs which it consumes with merge
+// path and merges them sequentially, so the work is balanced no matter how
+// the elements are distributed between the inputs.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>&,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n1 = ::cuda::std::distance(first1, last1);
+  const Size n2 = static_cast<Size>(::cuda::std::distance(first2, last2));
+  const Size n  = n1 + n2;
+
+  const Size num_partitions = merge_detail::num_partitions(n);
+
+  if (num_partitions <= 1)
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size p = 0; p < num_partitions; ++p)
+  {
+    const Size diag_begin = n * p / num_partitions;
+    const Size diag_end   = n * (p + 1) / num_partitions;
+
+    const Size a_begin = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, diag_begin, comp);
+    const Size a_end   = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, diag_end, comp);
+
+    thrust::merge(thrust::seq,
+                  first1 + a_begin,
+                  first1 + a_end,
+                  first2 + (diag_begin - a_begin),
+                  first2 + (diag_end - a_end),
+                  result + diag_begin,
+                  comp);
+  }
+
+  return result + n;
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>&,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first3,
+  InputIterator4 values_first4,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n1 = ::cuda::std::distance(keys_first1, keys_last1);
+  const Size n2 = static_cast<Size>(::cuda::std::distance(keys_first2, keys_last2));
+  const Size n  = n1 + n2;
+
+  const Size num_partitions = merge_detail::num_partitions(n);
+
+  if (num_partitions <= 1)
+  {
+    return thrust::merge_by_key(
+      thrust::seq,
+      keys_first1,
+      keys_last1,
+      keys_first2,
+      keys_last2,
+      values_first3,
+      values_first4,
+      keys_result,
+      values_result,
+      comp);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size p = 0; p < num_partitions; ++p)
+  {
+    const Size diag_begin = n * p / num_partitions;
+    const Size diag_end   = n * (p + 1) / num_partitions;
+
+    const Size a_begin =
+      thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, diag_begin, comp);
+    const Size a_end = thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, diag_end, comp);
+
+    thrust::merge_by_key(
+      thrust::seq,
+      keys_first1 + a_begin,
+      keys_first1 + a_end,
+      keys_first2 + (diag_begin - a_begin),
+      keys_first2 + (diag_end - a_end),
+      values_first3 + a_begin,
+      values_first4 + (diag_begin - a_begin),
+      keys_result + diag_begin,
+      values_result + diag_begin,
+      comp);
+  }
+
+  return ::cuda::std::make_pair(keys_result + n, values_result + n);
+} // end merge_by_key()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
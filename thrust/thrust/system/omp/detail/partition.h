@@ -17,9 +17,12 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/copy_if.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -29,8 +32,21 @@ template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  using InputType       = thrust::detail::it_value_t<ForwardIterator>;
+  using difference_type = thrust::detail::it_difference_t<ForwardIterator>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  // copy input to temp buffer
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+
+  return first
+       + copy_if_detail::partition_copy_n<true, true>(exec, temp.begin(), n, temp.begin(), first, first, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -41,44 +57,66 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  using InputType       = thrust::detail::it_value_t<ForwardIterator>;
+  using difference_type = thrust::detail::it_difference_t<ForwardIterator>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+
+  if (n == 0)
+  {
+    return first;
+  }
+
+  // copy input to temp buffer
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+
+  return first + copy_if_detail::partition_copy_n<true, true>(exec, temp.begin(), n, stencil, first, first, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy,
-          typename InputIterator,
+          typename InputIterator1,
+          typename InputIterator2,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator first,
-  InputIterator last,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  using difference_type = thrust::detail::it_difference_t<InputIterator1>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+
+  if (n == 0)
+  {
+    return ::cuda::std::make_pair(out_true, out_false);
+  }
+
+  const difference_type num_true =
+    copy_if_detail::partition_copy_n<true, false>(exec, first, n, stencil, out_true, out_false, pred);
+
+  return ::cuda::std::make_pair(out_true + num_true, out_false + (n - num_true));
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
-          typename InputIterator1,
-          typename InputIterator2,
+          typename InputIterator,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator1 first,
-  InputIterator1 last,
-  InputIterator2 stencil,
+  InputIterator first,
+  InputIterator last,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return thrust::system::omp::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
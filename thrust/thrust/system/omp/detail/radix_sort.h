@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file radix_sort.h
+ *  \brief OpenMP parallel LSD radix sort for primitive key types.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace radix_sort_detail
+{
+// Below this many elements per thread the per-pass barriers dominate and the
+// sequential primitive sort is faster
+inline constexpr ::cuda::std::size_t min_elements_per_thread = 1 << 14;
+
+inline bool use_parallel_radix_sort(::cuda::std::size_t n)
+{
+  return omp_get_max_threads() > 1 && n >= 2 * min_elements_per_thread;
+}
+
+inline int num_radix_sort_threads(::cuda::std::size_t n)
+{
+  return static_cast<int>(
+    ::cuda::std::min<::cuda::std::size_t>(omp_get_max_threads(), ::cuda::ceil_div(n, min_elements_per_thread)));
+}
+
+template <bool HasValues,
+          typename Encoder,
+          typename KeyIterator1,
+          typename KeyIterator2,
+          typename ValueIterator1,
+          typename ValueIterator2>
+void radix_sort(
+  Encoder encode,
+  KeyIterator1 keys1,
+  KeyIterator2 keys2,
+  ValueIterator1 vals1,
+  ValueIterator2 vals2,
+  ::cuda::std::size_t n,
+  int max_threads,
+  ::cuda::std::size_t* histograms)
+{
+  using namespace thrust::system::detail::internal;
+  using bits_type = typename Encoder::bits_type;
+
+  bits_type and_bits = static_cast<bits_type>(~bits_type{0});
+  bits_type or_bits  = 0;
+
+  // the runtime may provide fewer threads than requested, e.g. in a nested parallel region, so the chunks are sized
+  // from the threads of the team
+  THRUST_PRAGMA_OMP(parallel num_threads(max_threads))
+  {
+    const int num_threads                = omp_get_num_threads();
+    const int tid                        = omp_get_thread_num();
+    const ::cuda::std::size_t chunk_size = ::cuda::ceil_div(n, static_cast<::cuda::std::size_t>(num_threads));
+    const ::cuda::std::size_t begin      = ::cuda::std::min(n, tid * chunk_size);
+    const ::cuda::std::size_t end        = ::cuda::std::min(n, begin + chunk_size);
+
+    ::cuda::std::size_t* my_histogram = histograms + tid * radix_buckets;
+
+    // find the digits which are identical in every key
+    {
+      bits_type my_and_bits = static_cast<bits_type>(~bits_type{0});
+      bits_type my_or_bits  = 0;
+
+      radix_reduce_bits(encode, keys1, begin, end, my_and_bits, my_or_bits);
+
+      THRUST_PRAGMA_OMP(critical)
+      {
+        and_bits &= my_and_bits;
+        or_bits |= my_or_bits;
+      }
+    }
+
+    THRUST_PRAGMA_OMP(barrier)
+
+    const bits_type varying_bits = static_cast<bits_type>(and_bits ^ or_bits);
+
+    // false if the most recent data is stored in (keys1,vals1)
+    bool flip = false;
+
+    for (int pass = 0; pass < Encoder::num_passes; ++pass)
+    {
+      const int shift = pass * radix_bits;
+
+      if (Encoder::pass_is_trivial(varying_bits, shift))
+      {
+        continue;
+      }
+
+      if (flip)
+      {
+        radix_count(encode, keys2, begin, end, shift, my_histogram);
+      }
+      else
+      {
+        radix_count(encode, keys1, begin, end, shift, my_histogram);
+      }
+
+      THRUST_PRAGMA_OMP(barrier)
+
+      THRUST_PRAGMA_OMP(single)
+      {
+        radix_scan_histograms(histograms, num_threads);
+      } // implicit barrier
+
+      if (flip)
+      {
+        radix_scatter<HasValues>(encode, keys2, vals2, begin, end, shift, my_histogram, keys1, vals1);
+      }
+      else
+      {
+        radix_scatter<HasValues>(encode, keys1, vals1, begin, end, shift, my_histogram, keys2, vals2);
+      }
+
+      THRUST_PRAGMA_OMP(barrier)
+
+      flip = !flip;
+    }
+
+    // ensure final values are in (keys1,vals1)
+    if (flip)
+    {
+      radix_copy<HasValues>(keys2, vals2, begin, end, keys1, vals1);
+    }
+  }
+}
+} // namespace radix_sort_detail
+
+template <bool Descending, typename DerivedPolicy, typename RandomAccessIterator>
+void stable_radix_sort(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const ::cuda::std::size_t n = static_cast<::cuda::std::size_t>(last - first);
+  const int num_threads       = radix_sort_detail::num_radix_sort_threads(n);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
+  thrust::detail::temporary_array<::cuda::std::size_t, DerivedPolicy> histograms(
+    exec, num_threads * thrust::system::detail::internal::radix_buckets);
+
+  radix_sort_detail::radix_sort<false>(
+    thrust::system::detail::internal::radix_key_encoder<KeyType, Descending>{},
+    first,
+    thrust::raw_pointer_cast(temp.data()),
+    static_cast<int*>(nullptr),
+    static_cast<int*>(nullptr),
+    n,
+    num_threads,
+    thrust::raw_pointer_cast(histograms.data()));
+}
+
+template <bool Descending, typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void stable_radix_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  const ::cuda::std::size_t n = static_cast<::cuda::std::size_t>(keys_last - keys_first);
+  const int num_threads       = radix_sort_detail::num_radix_sort_threads(n);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp1(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, n);
+  thrust::detail::temporary_array<::cuda::std::size_t, DerivedPolicy> histograms(
+    exec, num_threads * thrust::system::detail::internal::radix_buckets);
+
+  radix_sort_detail::radix_sort<true>(
+    thrust::system::detail::internal::radix_key_encoder<KeyType, Descending>{},
+    keys_first,
+    thrust::raw_pointer_cast(temp1.data()),
+    values_first,
+    thrust::raw_pointer_cast(temp2.data()),
+    n,
+    num_threads,
+    thrust::raw_pointer_cast(histograms.data()));
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
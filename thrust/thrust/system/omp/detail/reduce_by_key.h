@@ -1,8 +1,8 @@
 // SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
-/*! \file reduce.h
- *  \brief OpenMP implementation of reduce algorithms.
+/*! \file reduce_by_key.h
+ *  \brief OpenMP implementation of reduce_by_key.
  */
 
 #pragma once
@@ -17,12 +17,39 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace reduce_by_key_detail
+{
+// Below this many elements per chunk the parallel overhead dominates
+inline constexpr size_t min_elements_per_chunk = 1 << 12;
+} // namespace reduce_by_key_detail
+
+// The input is split into one chunk per thread. Every chunk counts the
+// segments which end inside of it, the counts are scanned and every chunk
+// reduces its segments straight into their final position. A segment which
+// is still open at the end of a chunk is left in a per-chunk carry, and the
+// carries are folded into the first segment of the following chunks serially.
+//
+// Like the other parallel backends, the keys are compared pairwise with their
+// predecessor, and the key of a segment is the first key of the segment.
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -40,9 +67,143 @@ template <typename DerivedPolicy,
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  using difference_type = thrust::detail::it_difference_t<InputIterator1>;
+  using key_type        = thrust::detail::it_value_t<InputIterator1>;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using value_type = thrust::detail::it_value_t<InputIterator2>;
+
+  const difference_type n = ::cuda::std::distance(keys_first, keys_last);
+
+  const difference_type num_chunks = static_cast<difference_type>(::cuda::std::min<size_t>(
+    static_cast<size_t>(omp_get_max_threads()),
+    ::cuda::ceil_div(static_cast<size_t>(n), reduce_by_key_detail::min_elements_per_chunk)));
+
+  if (num_chunks <= 1)
+  {
+    // don't bother parallelizing for small n
+    return thrust::reduce_by_key(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_pred{binary_pred};
+  thrust::detail::wrapped_function<BinaryFunction, value_type> wrapped_op{binary_op};
+
+  const difference_type chunk_size = ::cuda::ceil_div(n, num_chunks);
+
+  // true if the segment containing element i continues at element i + 1
+  auto continues = [&](difference_type i) {
+    return i + 1 < n && wrapped_pred(keys_first[i], keys_first[i + 1]);
+  };
+
+  // counts[c + 1] is the number of segments which end in chunk c
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> counts_storage(exec, num_chunks + 1);
+  difference_type* counts = thrust::raw_pointer_cast(counts_storage.data());
+
+  // the segment which is still open at the end of chunk c
+  thrust::detail::temporary_array<key_type, DerivedPolicy> carry_keys(exec, num_chunks);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> carry_values(exec, num_chunks);
+
+  // 1. count the segments which end in every chunk
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (difference_type c = 0; c < num_chunks; ++c)
+  {
+    const difference_type begin = ::cuda::std::min(n, c * chunk_size);
+    const difference_type end   = ::cuda::std::min(n, begin + chunk_size);
+
+    difference_type count = 0;
+    for (difference_type i = begin; i < end; ++i)
+    {
+      if (!continues(i))
+      {
+        ++count;
+      }
+    }
+    counts[c + 1] = count;
+  }
+
+  // 2. scan the counts to find each chunk's output offset
+  counts[0] = 0;
+  for (difference_type c = 0; c < num_chunks; ++c)
+  {
+    counts[c + 1] += counts[c];
+  }
+
+  // 3. every chunk reduces the segments which end inside of it
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (difference_type c = 0; c < num_chunks; ++c)
+  {
+    const difference_type begin = ::cuda::std::min(n, c * chunk_size);
+    const difference_type end   = ::cuda::std::min(n, begin + chunk_size);
+
+    if (begin == end)
+    {
+      continue;
+    }
+
+    difference_type out = counts[c];
+
+    key_type key     = keys_first[begin];
+    value_type value = values_first[begin];
+
+    for (difference_type i = begin; i + 1 < end; ++i)
+    {
+      if (continues(i))
+      {
+        value = wrapped_op(value, values_first[i + 1]);
+      }
+      else
+      {
+        keys_output[out]   = key;
+        values_output[out] = value;
+        ++out;
+
+        key   = keys_first[i + 1];
+        value = values_first[i + 1];
+      }
+    }
+
+    if (continues(end - 1))
+    {
+      carry_keys[c]   = key;
+      carry_values[c] = value;
+    }
+    else
+    {
+      keys_output[out]   = key;
+      values_output[out] = value;
+    }
+  }
+
+  // 4. fold every carry into the first segment which ends after it
+  for (difference_type c = 1; c < num_chunks; ++c)
+  {
+    const difference_type begin = ::cuda::std::min(n, c * chunk_size);
+    const difference_type end   = ::cuda::std::min(n, begin + chunk_size);
+
+    if (begin == end || !continues(begin - 1))
+    {
+      continue;
+    }
+
+    if (counts[c + 1] == counts[c])
+    {
+      // the whole chunk continues the open segment, carry it on
+      carry_keys[c]   = carry_keys[c - 1];
+      carry_values[c] = wrapped_op(carry_values[c - 1], carry_values[c]);
+    }
+    else
+    {
+      const difference_type out = counts[c];
+
+      keys_output[out]   = carry_keys[c - 1];
+      values_output[out] = wrapped_op(carry_values[c - 1], values_output[out]);
+    }
+  }
+
+  const difference_type num_segments = counts[num_chunks];
+
+  return ::cuda::std::make_pair(keys_output + num_segments, values_output + num_segments);
 } // end reduce_by_key()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
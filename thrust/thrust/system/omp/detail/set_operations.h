@@ -13,5 +13,188 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace set_operations_detail
+{
+// Below this many input elements per partition the parallel overhead dominates
+inline constexpr size_t min_elements_per_partition = 1 << 13;
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using namespace thrust::system::detail::internal;
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n1 = ::cuda::std::distance(first1, last1);
+  const Size n2 = static_cast<Size>(::cuda::std::distance(first2, last2));
+
+  const Size num_partitions = static_cast<Size>(::cuda::std::min<size_t>(
+    static_cast<size_t>(omp_get_max_threads()),
+    ::cuda::ceil_div(static_cast<size_t>(n1 + n2), min_elements_per_partition)));
+
+  if (num_partitions <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // partition p consumes [splits1[p], splits1[p + 1]) and [splits2[p], splits2[p + 1])
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits1_storage(exec, num_partitions + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits2_storage(exec, num_partitions + 1);
+  Size* splits1 = thrust::raw_pointer_cast(splits1_storage.data());
+  Size* splits2 = thrust::raw_pointer_cast(splits2_storage.data());
+
+  // offsets[p + 1] is the size of the output of partition p
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets_storage(exec, num_partitions + 1);
+  Size* offsets = thrust::raw_pointer_cast(offsets_storage.data());
+
+  // 1. split the inputs along evenly spaced diagonals
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size p = 0; p <= num_partitions; ++p)
+  {
+    const Size diag = (n1 + n2) * p / num_partitions;
+
+    const ::cuda::std::pair<Size, Size> split = balanced_path(first1, n1, first2, n2, diag, comp);
+    splits1[p]                                = split.first;
+    splits2[p]                                = split.second;
+  }
+
+  // 2. count the output of every partition
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size p = 0; p < num_partitions; ++p)
+  {
+    offsets[p + 1] =
+      set_operation_count(set_op, first1, splits1[p], splits1[p + 1], first2, splits2[p], splits2[p + 1], comp);
+  }
+
+  // 3. scan the counts to find each partition's output offset
+  offsets[0] = 0;
+  for (Size p = 0; p < num_partitions; ++p)
+  {
+    offsets[p + 1] += offsets[p];
+  }
+
+  // 4. every partition writes its output to its final position
+  THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+  for (Size p = 0; p < num_partitions; ++p)
+  {
+    set_op(first1 + splits1[p],
+           first1 + splits1[p + 1],
+           first2 + splits2[p],
+           first2 + splits2[p + 1],
+           result + offsets[p],
+           comp);
+  }
+
+  return result + offsets[num_partitions];
+}
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference{});
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection{});
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::serial_set_symmetric_difference{});
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union{});
+} // end set_union()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -20,59 +20,105 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
-#include <thrust/system/detail/generic/select_system.h>
-#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/radix_sort.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 namespace sort_detail
 {
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// Merges every pair of adjacent sorted runs of length `width` in [src, src + n)
+// into dst. The output is split evenly between the threads with merge path, so
+// thread `tid` of `num_threads` writes dst[n * tid / num_threads, n * (tid + 1) / num_threads)
+// no matter how many runs are left.
+template <typename Iterator1, typename Iterator2, typename Size, typename StrictWeakOrdering>
+void merge_runs(
+  Iterator1 src, Iterator2 dst, Size n, Size width, Size tid, Size num_threads, StrictWeakOrdering comp)
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  const Size out_begin = n * tid / num_threads;
+  const Size out_end   = n * (tid + 1) / num_threads;
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
-
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  for (Size pair_begin = out_begin / (2 * width) * (2 * width); pair_begin < out_end; pair_begin += 2 * width)
+  {
+    const Size mid      = ::cuda::std::min(pair_begin + width, n);
+    const Size pair_end = ::cuda::std::min(mid + width, n);
+
+    const Size diag_begin = ::cuda::std::max(out_begin, pair_begin) - pair_begin;
+    const Size diag_end   = ::cuda::std::min(out_end, pair_end) - pair_begin;
+
+    const Size a_begin = thrust::system::detail::internal::merge_path(
+      src + pair_begin, mid - pair_begin, src + mid, pair_end - mid, diag_begin, comp);
+    const Size a_end = thrust::system::detail::internal::merge_path(
+      src + pair_begin, mid - pair_begin, src + mid, pair_end - mid, diag_end, comp);
+
+    thrust::merge(thrust::seq,
+                  src + pair_begin + a_begin,
+                  src + pair_begin + a_end,
+                  src + mid + (diag_begin - a_begin),
+                  src + mid + (diag_end - a_end),
+                  dst + pair_begin + diag_begin,
+                  comp);
+  }
 }
 
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
-          typename RandomAccessIterator2,
+template <typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename Size,
           typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
+void merge_runs_by_key(
+  Iterator1 keys_src,
+  Iterator2 values_src,
+  Iterator3 keys_dst,
+  Iterator4 values_dst,
+  Size n,
+  Size width,
+  Size tid,
+  Size num_threads,
   StrictWeakOrdering comp)
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
-
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
-
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  const Size out_begin = n * tid / num_threads;
+  const Size out_end   = n * (tid + 1) / num_threads;
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+  for (Size pair_begin = out_begin / (2 * width) * (2 * width); pair_begin < out_end; pair_begin += 2 * width)
+  {
+    const Size mid      = ::cuda::std::min(pair_begin + width, n);
+    const Size pair_end = ::cuda::std::min(mid + width, n);
+
+    const Size diag_begin = ::cuda::std::max(out_begin, pair_begin) - pair_begin;
+    const Size diag_end   = ::cuda::std::min(out_end, pair_end) - pair_begin;
+
+    const Size a_begin = thrust::system::detail::internal::merge_path(
+      keys_src + pair_begin, mid - pair_begin, keys_src + mid, pair_end - mid, diag_begin, comp);
+    const Size a_end = thrust::system::detail::internal::merge_path(
+      keys_src + pair_begin, mid - pair_begin, keys_src + mid, pair_end - mid, diag_end, comp);
+
+    thrust::merge_by_key(
+      thrust::seq,
+      keys_src + pair_begin + a_begin,
+      keys_src + pair_begin + a_end,
+      keys_src + mid + (diag_begin - a_begin),
+      keys_src + mid + (diag_end - a_end),
+      values_src + pair_begin + a_begin,
+      values_src + mid + (diag_begin - a_begin),
+      keys_dst + pair_begin + diag_begin,
+      values_dst + pair_begin + diag_begin,
+      comp);
+  }
 }
 } // namespace sort_detail
 
@@ -92,59 +138,81 @@ void stable_sort(
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator>;
 
   if (first == last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  namespace seq_sort_detail = thrust::system::detail::sequential::sort_detail;
+  if constexpr (seq_sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+    if (radix_sort_detail::use_parallel_radix_sort(last - first))
     {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
+      thrust::system::omp::detail::stable_radix_sort<seq_sort_detail::needs_reverse<KeyType, StrictWeakOrdering>>(
+        exec, first, last);
+      return;
     }
+  }
+
+  const IndexType n     = last - first;
+  const int max_threads = omp_get_max_threads();
+
+  if (max_threads == 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
 
-    THRUST_PRAGMA_OMP(barrier)
+  // the merge levels ping-pong between the input and this buffer, which is copied from the input so that the keys need
+  // not be default constructible
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, first, last);
 
-    // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-    ;
+  THRUST_PRAGMA_OMP(parallel num_threads(max_threads))
+  {
+    const IndexType num_threads = omp_get_num_threads();
+    const IndexType p_i         = omp_get_thread_num();
+    const IndexType tile_size   = ::cuda::ceil_div(n, num_threads);
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+    // every thread sorts its own tile
+    const IndexType tile_begin = ::cuda::std::min(n, p_i * tile_size);
+    const IndexType tile_end   = ::cuda::std::min(n, tile_begin + tile_size);
+    thrust::stable_sort(thrust::seq, first + tile_begin, first + tile_end, comp);
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    // false if the most recent data is stored in [first, last)
+    bool flip = false;
 
-    while (nseg > 1)
+    for (IndexType width = tile_size; width < n; width *= 2)
     {
-      if (c >= decomp.size())
+      THRUST_PRAGMA_OMP(barrier)
+
+      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
+      ;
+
+      // every thread merges an equal share of the output of this level
+      if (flip)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_runs(temp.begin(), first, n, width, p_i, num_threads, comp);
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_runs(first, temp.begin(), n, width, p_i, num_threads, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      flip = !flip;
+    }
 
+    if (flip)
+    {
       THRUST_PRAGMA_OMP(barrier)
 
       // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
       ;
+
+      const IndexType copy_begin = n * p_i / num_threads;
+      const IndexType copy_end   = n * (p_i + 1) / num_threads;
+      thrust::copy(thrust::seq, temp.begin() + copy_begin, temp.begin() + copy_end, first + copy_begin);
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
@@ -173,70 +241,89 @@ void stable_sort_by_key(
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
 
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  namespace seq_sort_detail = thrust::system::detail::sequential::sort_detail;
+  if constexpr (seq_sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+    if (radix_sort_detail::use_parallel_radix_sort(keys_last - keys_first))
     {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
+      thrust::system::omp::detail::stable_radix_sort_by_key<
+        seq_sort_detail::needs_reverse<KeyType, StrictWeakOrdering>>(exec, keys_first, keys_last, values_first);
+      return;
     }
+  }
 
-    THRUST_PRAGMA_OMP(barrier)
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-    // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-    ;
+  const IndexType n     = keys_last - keys_first;
+  const int max_threads = omp_get_max_threads();
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  if (max_threads == 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  // the merge levels ping-pong between the input and these buffers, which are copied from the input so that the keys
+  // and values need not be default constructible
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_temp(exec, keys_first, keys_last);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_temp(exec, values_first, values_first + n);
 
-    while (nseg > 1)
+  THRUST_PRAGMA_OMP(parallel num_threads(max_threads))
+  {
+    const IndexType num_threads = omp_get_num_threads();
+    const IndexType p_i         = omp_get_thread_num();
+    const IndexType tile_size   = ::cuda::ceil_div(n, num_threads);
+
+    // every thread sorts its own tile
+    const IndexType tile_begin = ::cuda::std::min(n, p_i * tile_size);
+    const IndexType tile_end   = ::cuda::std::min(n, tile_begin + tile_size);
+    thrust::stable_sort_by_key(
+      thrust::seq, keys_first + tile_begin, keys_first + tile_end, values_first + tile_begin, comp);
+
+    // false if the most recent data is stored in [keys_first, keys_last)
+    bool flip = false;
+
+    for (IndexType width = tile_size; width < n; width *= 2)
     {
-      if (c >= decomp.size())
+      THRUST_PRAGMA_OMP(barrier)
+
+      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
+      ;
+
+      // every thread merges an equal share of the output of this level
+      if (flip)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_runs_by_key(
+          keys_temp.begin(), values_temp.begin(), keys_first, values_first, n, width, p_i, num_threads, comp);
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_runs_by_key(
+          keys_first, values_first, keys_temp.begin(), values_temp.begin(), n, width, p_i, num_threads, comp);
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      flip = !flip;
+    }
 
+    if (flip)
+    {
       THRUST_PRAGMA_OMP(barrier)
 
       // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
       ;
+
+      const IndexType copy_begin = n * p_i / num_threads;
+      const IndexType copy_end   = n * (p_i + 1) / num_threads;
+      thrust::copy(thrust::seq, keys_temp.begin() + copy_begin, keys_temp.begin() + copy_end, keys_first + copy_begin);
+      thrust::copy(
+        thrust::seq, values_temp.begin() + copy_begin, values_temp.begin() + copy_end, values_first + copy_begin);
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
@@ -19,15 +19,38 @@
 
 #include <thrust/mr/fancy_pointer_resource.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/page.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/pointer.h>
 
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp // NOLINT(modernize-concat-nested-namespaces)
 {
 //! \cond
 namespace detail
 {
-using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::omp::pointer<void>>;
+// touches the pages of new allocations with the threads of the OpenMP system, in the static schedule of its algorithms,
+// so that every page is placed on the NUMA node of the thread that will use it
+struct first_touch
+{
+  void operator()(char* p, std::size_t bytes, std::size_t page_size) const
+  {
+    const ::cuda::std::ptrdiff_t pages = static_cast<::cuda::std::ptrdiff_t>(::cuda::ceil_div(bytes, page_size));
+
+    THRUST_PRAGMA_OMP(parallel for schedule(static))
+    for (::cuda::std::ptrdiff_t i = 0; i < pages; ++i)
+    {
+      p[i * page_size] = 0;
+    }
+  }
+};
+
+using page_resource = thrust::mr::page_resource<first_touch>;
+
+using native_resource = thrust::mr::fancy_pointer_resource<page_resource, thrust::omp::pointer<void>>;
 
 using universal_native_resource =
   thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::omp::universal_pointer<void>>;
@@ -39,8 +62,9 @@ using universal_native_resource =
  *  \{
  */
 
-/*! The memory resource for the OpenMP system. Uses \p mr::new_delete_resource
- *  and tags it with \p omp::pointer.
+/*! The memory resource for the OpenMP system. Uses \p mr::page_resource, which
+ *  touches the pages of large allocations with the threads of the OpenMP
+ *  system, and tags it with \p omp::pointer.
  */
 using memory_resource = detail::native_resource;
 /*! The unified memory resource for the OpenMP system. Uses
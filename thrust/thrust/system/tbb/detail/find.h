@@ -12,17 +12,68 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/find.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/find_if.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
+namespace find_detail
+{
+template <typename Chunks>
+struct body
+{
+  Chunks& chunks;
+
+  void operator()(const ::tbb::blocked_range<::cuda::std::int64_t>& r) const
+  {
+    for (auto worker = r.begin(); worker != r.end(); ++worker)
+    {
+      chunks();
+    }
+  }
+};
+} // namespace find_detail
+
+// find_if_not, mismatch, all_of, any_of and none_of are implemented in terms of find_if, so they exit early as well
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
-InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
+InputIterator find_if(execution_policy<DerivedPolicy>&, InputIterator first, InputIterator last, Predicate pred)
 {
-  // tbb prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  using namespace thrust::system::detail::internal;
+  using Chunks = find_if_chunks<InputIterator, Predicate>;
+
+  const ::cuda::std::int64_t n = ::cuda::std::distance(first, last);
+
+  Chunks chunks(first, n, pred);
+
+  // the arena of the caller may be limited to fewer threads than the machine has
+  const ::cuda::std::int64_t num_workers = (::cuda::std::min) (
+    static_cast<::cuda::std::int64_t>(::cuda::std::max(1, ::tbb::this_task_arena::max_concurrency())),
+    chunks.max_workers());
+
+  if (num_workers <= 1)
+  {
+    chunks();
+  }
+  else
+  {
+    // force grainsize == 1 so that every worker is its own task
+    ::tbb::parallel_for(::tbb::blocked_range<::cuda::std::int64_t>(0, num_workers, 1),
+                        find_detail::body<Chunks>{chunks},
+                        ::tbb::simple_partitioner());
+  }
+
+  return first + static_cast<thrust::detail::it_difference_t<InputIterator>>(chunks.result());
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
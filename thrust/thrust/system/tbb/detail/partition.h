@@ -12,14 +12,111 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/partition.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/__iterator/advance.h>
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/pair.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_scan.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
+namespace partition_detail
+{
+// Like copy_if_detail::body, but the rejected elements are written to
+// out_false. Their offset is the number of rejected elements before the
+// range, i.e. r.begin() - sum.
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate,
+          typename Size>
+struct body
+{
+  InputIterator1 first;
+  InputIterator2 stencil;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+  Size sum;
+
+  body(InputIterator1 first,
+       InputIterator2 stencil,
+       OutputIterator1 out_true,
+       OutputIterator2 out_false,
+       Predicate pred)
+      : first(first)
+      , stencil(stencil)
+      , out_true(out_true)
+      , out_false(out_false)
+      , pred{pred}
+      , sum(0)
+  {}
+
+  body(body& b, ::tbb::split)
+      : first(b.first)
+      , stencil(b.stencil)
+      , out_true(b.out_true)
+      , out_false(b.out_false)
+      , pred{b.pred}
+      , sum(0)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    InputIterator2 iter = stencil + r.begin();
+
+    for (Size i = r.begin(); i != r.end(); ++i, ++iter)
+    {
+      if (pred(*iter))
+      {
+        ++sum;
+      }
+    }
+  }
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    InputIterator1 iter1  = first + r.begin();
+    InputIterator2 iter2  = stencil + r.begin();
+    OutputIterator1 iter3 = out_true + sum;
+    OutputIterator2 iter4 = out_false + (r.begin() - sum);
+
+    for (Size i = r.begin(); i != r.end(); ++i, ++iter1, ++iter2)
+    {
+      if (pred(*iter2))
+      {
+        *iter3 = *iter1;
+        ++sum;
+        ++iter3;
+      }
+      else
+      {
+        *iter4 = *iter1;
+        ++iter4;
+      }
+    }
+  }
+
+  void reverse_join(body& b)
+  {
+    sum = b.sum + sum;
+  }
+
+  void assign(body& b)
+  {
+    sum = b.sum;
+  }
+}; // end body
+} // namespace partition_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
@@ -41,39 +138,51 @@ ForwardIterator stable_partition(
 } // end stable_partition()
 
 template <typename DerivedPolicy,
-          typename InputIterator,
+          typename InputIterator1,
+          typename InputIterator2,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
-  execution_policy<DerivedPolicy>& exec,
-  InputIterator first,
-  InputIterator last,
+  execution_policy<DerivedPolicy>&,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+  using Body =
+    partition_detail::body<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, Predicate, Size>;
+
+  Size n = ::cuda::std::distance(first, last);
+
+  if (n != 0)
+  {
+    Body body(first, stencil, out_true, out_false, pred);
+    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
+    ::cuda::std::advance(out_true, body.sum);
+    ::cuda::std::advance(out_false, n - body.sum);
+  }
+
+  return ::cuda::std::make_pair(out_true, out_false);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
-          typename InputIterator1,
-          typename InputIterator2,
+          typename InputIterator,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator1 first,
-  InputIterator1 last,
-  InputIterator2 stencil,
+  InputIterator first,
+  InputIterator last,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return thrust::system::tbb::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file radix_sort.h
+ *  \brief TBB parallel LSD radix sort for primitive key types.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace radix_sort_detail
+{
+// Below this many elements per chunk the per-pass synchronization dominates and
+// the sequential primitive sort is faster
+inline constexpr ::cuda::std::size_t min_elements_per_chunk = 1 << 14;
+
+inline ::cuda::std::size_t num_radix_sort_chunks(::cuda::std::size_t n)
+{
+  // the arena of the caller may be limited to fewer threads than the machine has
+  const auto p = static_cast<::cuda::std::size_t>(::cuda::std::max(1, ::tbb::this_task_arena::max_concurrency()));
+  return ::cuda::std::min(p, ::cuda::ceil_div(n, min_elements_per_chunk));
+}
+
+inline bool use_parallel_radix_sort(::cuda::std::size_t n)
+{
+  return num_radix_sort_chunks(n) > 1;
+}
+
+enum class radix_phase
+{
+  reduce_bits,
+  count,
+  scatter,
+  copy
+};
+
+template <bool HasValues,
+          typename Encoder,
+          typename KeyIterator1,
+          typename KeyIterator2,
+          typename ValueIterator1,
+          typename ValueIterator2>
+struct radix_sort_body
+{
+  using bits_type = typename Encoder::bits_type;
+
+  radix_phase phase;
+  Encoder encode;
+  KeyIterator1 keys1;
+  KeyIterator2 keys2;
+  ValueIterator1 vals1;
+  ValueIterator2 vals2;
+  ::cuda::std::size_t n;
+  ::cuda::std::size_t chunk_size;
+  ::cuda::std::size_t* histograms;
+  bits_type* and_bits;
+  bits_type* or_bits;
+  int shift;
+  bool flip;
+
+  void operator()(const ::tbb::blocked_range<::cuda::std::size_t>& r) const
+  {
+    using namespace thrust::system::detail::internal;
+
+    for (::cuda::std::size_t chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      const ::cuda::std::size_t begin = ::cuda::std::min(n, chunk * chunk_size);
+      const ::cuda::std::size_t end   = ::cuda::std::min(n, begin + chunk_size);
+
+      ::cuda::std::size_t* my_histogram = histograms + chunk * radix_buckets;
+
+      switch (phase)
+      {
+        case radix_phase::reduce_bits:
+          and_bits[chunk] = static_cast<bits_type>(~bits_type{0});
+          or_bits[chunk]  = 0;
+          radix_reduce_bits(encode, keys1, begin, end, and_bits[chunk], or_bits[chunk]);
+          break;
+        case radix_phase::count:
+          if (flip)
+          {
+            radix_count(encode, keys2, begin, end, shift, my_histogram);
+          }
+          else
+          {
+            radix_count(encode, keys1, begin, end, shift, my_histogram);
+          }
+          break;
+        case radix_phase::scatter:
+          if (flip)
+          {
+            radix_scatter<HasValues>(encode, keys2, vals2, begin, end, shift, my_histogram, keys1, vals1);
+          }
+          else
+          {
+            radix_scatter<HasValues>(encode, keys1, vals1, begin, end, shift, my_histogram, keys2, vals2);
+          }
+          break;
+        case radix_phase::copy:
+          radix_copy<HasValues>(keys2, vals2, begin, end, keys1, vals1);
+          break;
+      }
+    }
+  }
+};
+
+template <bool HasValues,
+          typename DerivedPolicy,
+          typename Encoder,
+          typename KeyIterator1,
+          typename KeyIterator2,
+          typename ValueIterator1,
+          typename ValueIterator2>
+void radix_sort(
+  execution_policy<DerivedPolicy>& exec,
+  Encoder encode,
+  KeyIterator1 keys1,
+  KeyIterator2 keys2,
+  ValueIterator1 vals1,
+  ValueIterator2 vals2,
+  ::cuda::std::size_t n)
+{
+  using namespace thrust::system::detail::internal;
+  using bits_type = typename Encoder::bits_type;
+
+  const ::cuda::std::size_t num_chunks = num_radix_sort_chunks(n);
+
+  thrust::detail::temporary_array<::cuda::std::size_t, DerivedPolicy> histograms(exec, num_chunks * radix_buckets);
+  thrust::detail::temporary_array<bits_type, DerivedPolicy> and_bits(exec, num_chunks);
+  thrust::detail::temporary_array<bits_type, DerivedPolicy> or_bits(exec, num_chunks);
+
+  radix_sort_body<HasValues, Encoder, KeyIterator1, KeyIterator2, ValueIterator1, ValueIterator2> body{
+    radix_phase::reduce_bits,
+    encode,
+    keys1,
+    keys2,
+    vals1,
+    vals2,
+    n,
+    ::cuda::ceil_div(n, num_chunks),
+    thrust::raw_pointer_cast(histograms.data()),
+    thrust::raw_pointer_cast(and_bits.data()),
+    thrust::raw_pointer_cast(or_bits.data()),
+    0,
+    false};
+
+  // force grainsize == 1 so that every chunk is its own task
+  const ::tbb::blocked_range<::cuda::std::size_t> chunks(0, num_chunks, 1);
+
+  // find the digits which are identical in every key
+  ::tbb::parallel_for(chunks, body, ::tbb::simple_partitioner());
+
+  bits_type all_and_bits = static_cast<bits_type>(~bits_type{0});
+  bits_type all_or_bits  = 0;
+  for (::cuda::std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    all_and_bits &= body.and_bits[chunk];
+    all_or_bits |= body.or_bits[chunk];
+  }
+  const bits_type varying_bits = static_cast<bits_type>(all_and_bits ^ all_or_bits);
+
+  for (int pass = 0; pass < Encoder::num_passes; ++pass)
+  {
+    body.shift = pass * radix_bits;
+
+    if (Encoder::pass_is_trivial(varying_bits, body.shift))
+    {
+      continue;
+    }
+
+    body.phase = radix_phase::count;
+    ::tbb::parallel_for(chunks, body, ::tbb::simple_partitioner());
+
+    radix_scan_histograms(body.histograms, num_chunks);
+
+    body.phase = radix_phase::scatter;
+    ::tbb::parallel_for(chunks, body, ::tbb::simple_partitioner());
+
+    body.flip = !body.flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (body.flip)
+  {
+    body.phase = radix_phase::copy;
+    ::tbb::parallel_for(chunks, body, ::tbb::simple_partitioner());
+  }
+}
+} // namespace radix_sort_detail
+
+template <bool Descending, typename DerivedPolicy, typename RandomAccessIterator>
+void stable_radix_sort(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const ::cuda::std::size_t n = static_cast<::cuda::std::size_t>(last - first);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
+
+  radix_sort_detail::radix_sort<false>(
+    exec,
+    thrust::system::detail::internal::radix_key_encoder<KeyType, Descending>{},
+    first,
+    thrust::raw_pointer_cast(temp.data()),
+    static_cast<int*>(nullptr),
+    static_cast<int*>(nullptr),
+    n);
+}
+
+template <bool Descending, typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void stable_radix_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  const ::cuda::std::size_t n = static_cast<::cuda::std::size_t>(keys_last - keys_first);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp1(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, n);
+
+  radix_sort_detail::radix_sort<true>(
+    exec,
+    thrust::system::detail::internal::radix_key_encoder<KeyType, Descending>{},
+    keys_first,
+    thrust::raw_pointer_cast(temp1.data()),
+    values_first,
+    thrust::raw_pointer_cast(temp2.data()),
+    n);
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
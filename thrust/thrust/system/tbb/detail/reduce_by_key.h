@@ -69,11 +69,11 @@ reduce_last_segment_backward(
   thrust::detail::it_value_t<InputIterator1> result_key                        = *keys_first_r;
   typename partial_sum_type<InputIterator2, BinaryFunction>::type result_value = *values_first_r;
 
-  // consume the entirety of the first key's sequence
+  // consume the entirety of the first key's sequence, keeping the values in input order for binary_op
   for (++keys_first_r, ++values_first_r; (keys_first_r != keys_last_r) && binary_pred(*keys_first_r, result_key);
        ++keys_first_r, ++values_first_r)
   {
-    result_value = binary_op(result_value, *values_first_r);
+    result_value = binary_op(*values_first_r, result_value);
   }
 
   return ::cuda::std::make_pair(keys_first_r.base(), ::cuda::std::make_pair(result_key, result_value));
@@ -359,8 +359,9 @@ template <typename DerivedPolicy,
 
   // sequentially accumulate the carries
   // note that the last interval does not have a carry
+  // the carries are visited backwards, so that a segment spanning several intervals is reduced in input order
   // XXX find a way to express this loop via a sequential algorithm, perhaps reduce_by_key
-  for (typename thrust::detail::temporary_array<carry_type, DerivedPolicy>::size_type i = 0; i < carries.size(); ++i)
+  for (auto i = carries.size(); i-- > 0;)
   {
     // if our interval has a carry, then we need to sum the carry to the next interval's output offset
     // if it does not have a carry, then we need to ignore carry_value[i]
@@ -368,7 +369,7 @@ template <typename DerivedPolicy,
     {
       difference_type output_idx = interval_output_offsets[i + 1];
 
-      values_result[output_idx] = binary_op(values_result[output_idx], carries[i]);
+      values_result[output_idx] = binary_op(carries[i], values_result[output_idx]);
     }
   }
 
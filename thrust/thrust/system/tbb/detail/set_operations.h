@@ -13,5 +13,240 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace set_operations_detail
+{
+// Below this many input elements per partition the parallel overhead dominates
+inline constexpr size_t min_elements_per_partition = 1 << 13;
+
+enum class set_operation_phase
+{
+  split,
+  count,
+  write
+};
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation,
+          typename Size>
+struct set_operation_body
+{
+  set_operation_phase phase;
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+  Size n1;
+  Size n2;
+  Size num_partitions;
+  Size* splits1;
+  Size* splits2;
+  Size* offsets;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    using namespace thrust::system::detail::internal;
+
+    for (Size p = r.begin(); p != r.end(); ++p)
+    {
+      switch (phase)
+      {
+        case set_operation_phase::split: {
+          const ::cuda::std::pair<Size, Size> split =
+            balanced_path(first1, n1, first2, n2, (n1 + n2) * p / num_partitions, comp);
+          splits1[p] = split.first;
+          splits2[p] = split.second;
+          break;
+        }
+        case set_operation_phase::count:
+          offsets[p + 1] =
+            set_operation_count(set_op, first1, splits1[p], splits1[p + 1], first2, splits2[p], splits2[p + 1], comp);
+          break;
+        case set_operation_phase::write:
+          set_op(first1 + splits1[p],
+                 first1 + splits1[p + 1],
+                 first2 + splits2[p],
+                 first2 + splits2[p + 1],
+                 result + offsets[p],
+                 comp);
+          break;
+      }
+    }
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const Size n1 = ::cuda::std::distance(first1, last1);
+  const Size n2 = static_cast<Size>(::cuda::std::distance(first2, last2));
+
+  // the arena of the caller may be limited to fewer threads than the machine has
+  const size_t p = static_cast<size_t>(::cuda::std::max(1, ::tbb::this_task_arena::max_concurrency()));
+
+  const Size num_partitions = static_cast<Size>(
+    ::cuda::std::min(p, ::cuda::ceil_div(static_cast<size_t>(n1 + n2), min_elements_per_partition)));
+
+  if (num_partitions <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // partition p consumes [splits1[p], splits1[p + 1]) and [splits2[p], splits2[p + 1])
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits1(exec, num_partitions + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits2(exec, num_partitions + 1);
+
+  // offsets[p + 1] is the size of the output of partition p
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_partitions + 1);
+
+  set_operation_body<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering, SetOperation, Size> body{
+    set_operation_phase::split,
+    first1,
+    first2,
+    result,
+    comp,
+    set_op,
+    n1,
+    n2,
+    num_partitions,
+    thrust::raw_pointer_cast(splits1.data()),
+    thrust::raw_pointer_cast(splits2.data()),
+    thrust::raw_pointer_cast(offsets.data())};
+
+  // force grainsize == 1 so that every partition is its own task
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_partitions + 1, 1), body, ::tbb::simple_partitioner());
+
+  body.phase = set_operation_phase::count;
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_partitions, 1), body, ::tbb::simple_partitioner());
+
+  // scan the counts to find each partition's output offset
+  body.offsets[0] = 0;
+  for (Size i = 0; i < num_partitions; ++i)
+  {
+    body.offsets[i + 1] += body.offsets[i];
+  }
+
+  body.phase = set_operation_phase::write;
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_partitions, 1), body, ::tbb::simple_partitioner());
+
+  return result + body.offsets[num_partitions];
+}
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference{});
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection{});
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::serial_set_symmetric_difference{});
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union{});
+} // end set_union()
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -18,7 +18,9 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/sequential/sort.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/radix_sort.h>
 
 #include <cuda/std/__iterator/distance.h>
 
@@ -243,6 +245,17 @@ void stable_sort(
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
+  namespace seq_sort_detail = thrust::system::detail::sequential::sort_detail;
+  if constexpr (seq_sort_detail::use_primitive_sort<key_type, StrictWeakOrdering>)
+  {
+    if (radix_sort_detail::use_parallel_radix_sort(last - first))
+    {
+      thrust::system::tbb::detail::stable_radix_sort<seq_sort_detail::needs_reverse<key_type, StrictWeakOrdering>>(
+        exec, first, last);
+      return;
+    }
+  }
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
   sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
@@ -262,6 +275,17 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
+  namespace seq_sort_detail = thrust::system::detail::sequential::sort_detail;
+  if constexpr (seq_sort_detail::use_primitive_sort<key_type, StrictWeakOrdering>)
+  {
+    if (radix_sort_detail::use_parallel_radix_sort(last1 - first1))
+    {
+      thrust::system::tbb::detail::stable_radix_sort_by_key<
+        seq_sort_detail::needs_reverse<key_type, StrictWeakOrdering>>(exec, first1, last1, first2);
+      return;
+    }
+  }
+
   RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
@@ -18,15 +18,43 @@
 #endif // no system header
 #include <thrust/mr/fancy_pointer_resource.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/page.h>
 #include <thrust/system/tbb/pointer.h>
 
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb // NOLINT(modernize-concat-nested-namespaces)
 {
 //! \cond
 namespace detail
 {
-using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::tbb::pointer<void>>;
+// touches the pages of new allocations with the threads of the TBB system, split statically between them, so that
+// every page is placed on the NUMA node of a thread that will use it
+struct first_touch
+{
+  void operator()(char* p, std::size_t bytes, std::size_t page_size) const
+  {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<std::size_t>(0, ::cuda::ceil_div(bytes, page_size)),
+      [=](const ::tbb::blocked_range<std::size_t>& range) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i)
+        {
+          p[i * page_size] = 0;
+        }
+      },
+      ::tbb::static_partitioner());
+  }
+};
+
+using page_resource = thrust::mr::page_resource<first_touch>;
+
+using native_resource = thrust::mr::fancy_pointer_resource<page_resource, thrust::tbb::pointer<void>>;
 
 using universal_native_resource =
   thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::tbb::universal_pointer<void>>;
@@ -38,8 +66,9 @@ using universal_native_resource =
  *  \{
  */
 
-/*! The memory resource for the TBB system. Uses \p mr::new_delete_resource and
- *  tags it with \p tbb::pointer.
+/*! The memory resource for the TBB system. Uses \p mr::page_resource, which
+ *  touches the pages of large allocations with the threads of the TBB system,
+ *  and tags it with \p tbb::pointer.
  */
 using memory_resource = detail::native_resource;
 /*! The unified memory resource for the TBB system. Uses